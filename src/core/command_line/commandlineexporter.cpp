@@ -0,0 +1,576 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "commandlineexporter.h"
+
+// C++ classes
+#include <memory>
+#include <cstring>
+using namespace std;
+
+// Qt classes
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFileInfo>
+#include <QDir>
+#include <QFile>
+#include <QProcess>
+#include <QThread>
+#include <QTextStream>
+#include <QGraphicsScene>
+
+// StateS classes
+#include "states.h"
+#include "machinemanager.h"
+#include "machine.h"
+#include "fsm.h"
+#include "graphicmachine.h"
+#include "genericscene.h"
+#include "machinexmlparser.h"
+#include "xmlimportexportbuilder.h"
+#include "statesxmlanalyzer.h"
+#include "machineimageexporter.h"
+#include "fsmhdlmodel.h"
+#include "fsmvhdlexport.h"
+#include "fsmsystemverilogexport.h"
+#include "fsmcppexport.h"
+
+
+/**
+ * @brief CommandLineExporter::isExportCommand must be called
+ * before the application object is built, as this command
+ * requires an offscreen platform.
+ */
+bool CommandLineExporter::isExportCommand(int argc, char* argv[])
+{
+	if (argc < 2) return false;
+
+
+	return (strcmp(argv[1], "export") == 0);
+}
+
+/**
+ * @brief CommandLineExporter::run
+ * @return Application exit code: 0 if all files were exported.
+ */
+int CommandLineExporter::run(const QStringList& arguments)
+{
+	// Displaying help is not a failure
+	if (this->parseArguments(arguments) == false) return (this->helpRequested == true) ? 0 : 1;
+
+
+	uint jobsCount = this->jobs;
+	if (jobsCount == 0)
+	{
+		jobsCount = qMax(QThread::idealThreadCount(), 1);
+	}
+
+	if ( (jobsCount > 1) && (this->files.count() > 1) )
+	{
+		this->jobs = jobsCount;
+		return this->runWorkers();
+	}
+
+
+	bool allExported = true;
+	for (const auto& filePath : this->files)
+	{
+		if (this->exportFile(filePath) == false)
+		{
+			allExported = false;
+		}
+	}
+
+	if (allExported == true)
+	{
+		return 0;
+	}
+	else
+	{
+		return 1;
+	}
+}
+
+bool CommandLineExporter::parseArguments(const QStringList& arguments)
+{
+	QCommandLineParser parser;
+	parser.setApplicationDescription(tr("Exports StateS machines to images, VHDL, SystemVerilog and C++ without user interface."));
+	parser.addHelpOption();
+	parser.addPositionalArgument("export", tr("Export command."));
+	parser.addPositionalArgument("files", tr("Machine files to export."), "<files...>");
+
+	QCommandLineOption formatOption   ({"f", "format"}, tr("Comma separated list of formats among pdf, svg, png, jpg, vhdl, sv and cpp (default: svg,vhdl)."), "formats", "svg,vhdl");
+	QCommandLineOption outputOption   ({"o", "output"}, tr("Output directory (default: next to each machine file)."), "directory");
+	QCommandLineOption jobsOption     ({"j", "jobs"},   tr("Number of files exported in parallel (default: one per core)."), "count", "0");
+	QCommandLineOption scaleOption    ("scale",          tr("Png and Jpeg resolution multiplier (default: 1)."), "factor", "1");
+	QCommandLineOption resetOption    ("negative-reset", tr("Use a negative reset logic in VHDL and SystemVerilog."));
+	QCommandLineOption prefixOption   ("prefix-signals", tr("Prefix VHDL, SystemVerilog and C++ inputs and outputs names."));
+	QCommandLineOption encodingOption ("state-encoding", tr("VHDL and SystemVerilog state encoding among symbolic, binary, gray, one-hot and johnson, or automatic choice optimized for timing or area (default: timing)."), "encoding", "timing");
+	QCommandLineOption mealyOption    ("registered-mealy", tr("Register VHDL, SystemVerilog and C++ pulse actions on transitions: active after transition is crossed."));
+	parser.addOptions({formatOption, outputOption, jobsOption, scaleOption, resetOption, prefixOption, encodingOption, mealyOption});
+
+	if (parser.parse(arguments) == false)
+	{
+		this->printError(parser.errorText());
+		this->printMessage(parser.helpText());
+		return false;
+	}
+
+	if (parser.isSet("help") == true)
+	{
+		this->printMessage(parser.helpText());
+		this->helpRequested = true;
+		return false;
+	}
+
+
+	// First positional argument is the command itself
+	this->files = parser.positionalArguments().mid(1);
+	if (this->files.isEmpty() == true)
+	{
+		this->printError(tr("No machine file given."));
+		this->printMessage(parser.helpText());
+		return false;
+	}
+
+	for (const auto& format : parser.value(formatOption).split(',', Qt::SkipEmptyParts))
+	{
+		QString cleanFormat = format.trimmed().toLower();
+		if (cleanFormat == "pdf")
+		{
+			this->imageFormats.append(ImageFormat_t::pdf);
+		}
+		else if (cleanFormat == "svg")
+		{
+			this->imageFormats.append(ImageFormat_t::svg);
+		}
+		else if (cleanFormat == "png")
+		{
+			this->imageFormats.append(ImageFormat_t::png);
+		}
+		else if ( (cleanFormat == "jpg") || (cleanFormat == "jpeg") )
+		{
+			this->imageFormats.append(ImageFormat_t::jpg);
+		}
+		else if ( (cleanFormat == "vhdl") || (cleanFormat == "vhd") )
+		{
+			this->doExportVhdl = true;
+		}
+		else if ( (cleanFormat == "sv") || (cleanFormat == "systemverilog") )
+		{
+			this->doExportSystemVerilog = true;
+		}
+		else if ( (cleanFormat == "cpp") || (cleanFormat == "c++") )
+		{
+			this->doExportCpp = true;
+		}
+		else
+		{
+			this->printError(tr("Unknown format:") + " " + format);
+			return false;
+		}
+	}
+
+	if ( (this->imageFormats.isEmpty() == true) && (this->doExportVhdl == false) && (this->doExportSystemVerilog == false) && (this->doExportCpp == false) )
+	{
+		this->printError(tr("No export format given."));
+		return false;
+	}
+
+	if (parser.isSet(outputOption) == true)
+	{
+		this->outputDirectory = parser.value(outputOption);
+		if (QDir().mkpath(this->outputDirectory) == false)
+		{
+			this->printError(tr("Unable to create output directory:") + " " + this->outputDirectory);
+			return false;
+		}
+	}
+
+	bool ok;
+	this->jobs = parser.value(jobsOption).toUInt(&ok);
+	if (ok == false)
+	{
+		this->printError(tr("Invalid number of jobs:") + " " + parser.value(jobsOption));
+		return false;
+	}
+
+	this->bitmapScale = parser.value(scaleOption).toDouble(&ok);
+	if ( (ok == false) || (this->bitmapScale <= 0) )
+	{
+		this->printError(tr("Invalid scale:") + " " + parser.value(scaleOption));
+		return false;
+	}
+
+	this->resetLogicPositive = (parser.isSet(resetOption) == false);
+	this->prefixSignals      = parser.isSet(prefixOption);
+	this->registerMealyOutputs = parser.isSet(mealyOption);
+
+	this->stateEncoding = parser.value(encodingOption).toLower();
+	QStringList encodings = {"timing", "area", "symbolic", "binary", "gray", "one-hot", "johnson"};
+	if (encodings.contains(this->stateEncoding) == false)
+	{
+		this->printError(tr("Unknown state encoding:") + " " + parser.value(encodingOption));
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief CommandLineExporter::runWorkers splits files between
+ * several instances of the application, which inherit the
+ * offscreen platform from this one. Outputs are forwarded.
+ * @return 0 if all workers succeeded.
+ */
+int CommandLineExporter::runWorkers()
+{
+	uint workersCount = qMin(this->jobs, (uint)this->files.count());
+
+	QStringList formats;
+	for (auto format : this->imageFormats)
+	{
+		switch (format)
+		{
+		case ImageFormat_t::pdf:
+			formats.append("pdf");
+			break;
+		case ImageFormat_t::svg:
+			formats.append("svg");
+			break;
+		case ImageFormat_t::png:
+			formats.append("png");
+			break;
+		case ImageFormat_t::jpg:
+			formats.append("jpg");
+			break;
+		}
+	}
+	if (this->doExportVhdl == true)
+	{
+		formats.append("vhdl");
+	}
+	if (this->doExportSystemVerilog == true)
+	{
+		formats.append("sv");
+	}
+	if (this->doExportCpp == true)
+	{
+		formats.append("cpp");
+	}
+
+	QStringList commonArguments = {"export", "--jobs", "1", "--format", formats.join(','), "--scale", QString::number(this->bitmapScale), "--state-encoding", this->stateEncoding};
+	if (this->outputDirectory.isEmpty() == false)
+	{
+		commonArguments += {"--output", this->outputDirectory};
+	}
+	if (this->resetLogicPositive == false)
+	{
+		commonArguments.append("--negative-reset");
+	}
+	if (this->prefixSignals == true)
+	{
+		commonArguments.append("--prefix-signals");
+	}
+	if (this->registerMealyOutputs == true)
+	{
+		commonArguments.append("--registered-mealy");
+	}
+
+	QList<shared_ptr<QProcess>> workers;
+	for (uint i = 0 ; i < workersCount ; i++)
+	{
+		QStringList workerArguments = commonArguments;
+		for (uint j = i ; j < (uint)this->files.count() ; j += workersCount)
+		{
+			workerArguments.append(this->files.at(j));
+		}
+
+		auto worker = make_shared<QProcess>();
+		worker->setProcessChannelMode(QProcess::ForwardedChannels);
+		worker->start(QCoreApplication::applicationFilePath(), workerArguments);
+		workers.append(worker);
+	}
+
+	int result = 0;
+	for (const auto& worker : workers)
+	{
+		worker->waitForFinished(-1);
+		if ( (worker->exitStatus() != QProcess::NormalExit) || (worker->exitCode() != 0) )
+		{
+			result = 1;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief CommandLineExporter::exportFile loads a machine
+ * file and exports it to all requested formats.
+ * @return False if any step failed.
+ */
+bool CommandLineExporter::exportFile(const QString& filePath)
+{
+	QFileInfo fileInfo(filePath);
+	if (fileInfo.exists() == false)
+	{
+		this->printError(filePath + ": " + tr("file not found."));
+		return false;
+	}
+
+
+	auto file = make_shared<QFile>(filePath);
+	auto analyzer = make_shared<StateSXmlAnalyzer>(file);
+	shared_ptr<MachineXmlParser> parser = XmlImportExportBuilder::buildFileParser(file, analyzer);
+	if (parser == nullptr)
+	{
+		this->printError(filePath + ": " + tr("not a readable StateS machine file."));
+		return false;
+	}
+
+
+	parser->doParse();
+	for (const auto& issue : parser->getIssues())
+	{
+		this->printError(filePath + ": " + issue);
+	}
+
+	auto machine = parser->getMachine();
+	if (machine == nullptr)
+	{
+		this->printError(filePath + ": " + tr("unable to load machine."));
+		return false;
+	}
+
+
+	machineManager->clearMachine();
+	machineManager->setMachine(machine, parser->getGraphicMachineConfiguration());
+
+	QString directory = this->outputDirectory;
+	if (directory.isEmpty() == true)
+	{
+		directory = fileInfo.absolutePath();
+	}
+	QString basePath = QDir(directory).filePath(fileInfo.completeBaseName());
+
+	bool allExported = true;
+	for (auto format : this->imageFormats)
+	{
+		if (this->exportImage(basePath, format) == false)
+		{
+			allExported = false;
+		}
+	}
+
+	if (this->doExportVhdl == true)
+	{
+		if (this->exportVhdl(basePath) == false)
+		{
+			allExported = false;
+		}
+	}
+
+	if (this->doExportSystemVerilog == true)
+	{
+		if (this->exportSystemVerilog(basePath) == false)
+		{
+			allExported = false;
+		}
+	}
+
+	if (this->doExportCpp == true)
+	{
+		if (this->exportCpp(basePath) == false)
+		{
+			allExported = false;
+		}
+	}
+
+	machineManager->clearMachine();
+
+	return allExported;
+}
+
+bool CommandLineExporter::exportImage(const QString& basePath, ImageFormat_t format)
+{
+	auto graphicMachine = machineManager->getGraphicMachine();
+	if (graphicMachine == nullptr) return false;
+
+
+	QString path = basePath;
+	switch (format)
+	{
+	case ImageFormat_t::pdf:
+		path += ".pdf";
+		break;
+	case ImageFormat_t::svg:
+		path += ".svg";
+		break;
+	case ImageFormat_t::png:
+		path += ".png";
+		break;
+	case ImageFormat_t::jpg:
+		path += ".jpg";
+		break;
+	}
+
+	// Same content as the interactive export default options
+	unique_ptr<GenericScene> scene(graphicMachine->getGraphicScene());
+	auto componentScene = make_shared<QGraphicsScene>();
+	componentScene->addItem(graphicMachine->getComponentVisualization());
+
+	MachineImageExporter exporter(scene.get(), componentScene);
+	exporter.setDisplayComponent(true);
+	exporter.setBitmapScale(this->bitmapScale);
+
+	QFile::remove(path);
+	bool exported = exporter.doExport(path, format, tr("Created with") + " StateS v." + StateS::getVersion());
+
+	if ( (exported == false) || (QFileInfo::exists(path) == false) )
+	{
+		this->printError(path + ": " + tr("unable to write file."));
+		return false;
+	}
+
+
+	this->printMessage(path);
+
+	return true;
+}
+
+bool CommandLineExporter::exportVhdl(const QString& basePath)
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return false;
+
+
+	QString path = basePath + ".vhdl";
+
+	FsmVhdlExport exporter;
+	exporter.setOptions(this->resetLogicPositive, this->prefixSignals, this->getStateEncoding(fsm->getAllStatesIds().count()), this->registerMealyOutputs);
+
+	if (exporter.writeToFile(path) == false)
+	{
+		this->printError(path + ": " + tr("unable to write file."));
+		return false;
+	}
+
+
+	this->printMessage(path);
+
+	return true;
+}
+
+bool CommandLineExporter::exportSystemVerilog(const QString& basePath)
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return false;
+
+
+	QString path = basePath + ".sv";
+
+	FsmSystemVerilogExport exporter;
+	exporter.setOptions(this->resetLogicPositive, this->prefixSignals, this->getStateEncoding(fsm->getAllStatesIds().count()), this->registerMealyOutputs);
+
+	if (exporter.writeToFile(path) == false)
+	{
+		this->printError(path + ": " + tr("unable to write file."));
+		return false;
+	}
+
+
+	this->printMessage(path);
+
+	return true;
+}
+
+bool CommandLineExporter::exportCpp(const QString& basePath)
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return false;
+
+
+	QString path = basePath + ".h";
+
+	FsmCppExport exporter;
+	exporter.setOptions(this->prefixSignals, this->registerMealyOutputs);
+
+	if (exporter.isSupported() == false)
+	{
+		this->printError(path + ": " + tr("C++ export only supports variables and conditions up to 64 bits, at most 255 variables and at most 65535 states, transitions and actions."));
+		return false;
+	}
+
+	if (exporter.writeToFile(path) == false)
+	{
+		this->printError(path + ": " + tr("unable to write file."));
+		return false;
+	}
+
+
+	this->printMessage(path);
+
+	return true;
+}
+
+HdlStateEncoding_t CommandLineExporter::getStateEncoding(uint statesCount) const
+{
+	if (this->stateEncoding == "timing")
+	{
+		return FsmHdlModel::getRecommendedStateEncoding(statesCount, HdlOptimizationGoal_t::timing);
+	}
+	else if (this->stateEncoding == "area")
+	{
+		return FsmHdlModel::getRecommendedStateEncoding(statesCount, HdlOptimizationGoal_t::area);
+	}
+	else if (this->stateEncoding == "binary")
+	{
+		return HdlStateEncoding_t::binary;
+	}
+	else if (this->stateEncoding == "gray")
+	{
+		return HdlStateEncoding_t::gray;
+	}
+	else if (this->stateEncoding == "one-hot")
+	{
+		return HdlStateEncoding_t::oneHot;
+	}
+	else if (this->stateEncoding == "johnson")
+	{
+		return HdlStateEncoding_t::johnson;
+	}
+	else
+	{
+		return HdlStateEncoding_t::symbolic;
+	}
+}
+
+void CommandLineExporter::printMessage(const QString& message) const
+{
+	QTextStream(stdout) << message << Qt::endl;
+}
+
+void CommandLineExporter::printError(const QString& message) const
+{
+	QTextStream(stderr) << message << Qt::endl;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMMANDLINEEXPORTER_H
+#define COMMANDLINEEXPORTER_H
+
+// Parent
+#include <QObject>
+
+// Qt classes
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+// StateS classes
+#include "statestypes.h"
+
+
+/**
+ * @brief The CommandLineExporter class handles the "export"
+ * command, which converts machine files to images and VHDL
+ * without displaying any window.
+ *
+ * Machines are handled through the machine manager, which only
+ * holds one machine at a time, and scenes can only be painted
+ * from the main thread. Files are thus processed in parallel
+ * by launching several instances of the application, each one
+ * exporting its share of the files in sequence.
+ */
+class CommandLineExporter : public QObject
+{
+	Q_OBJECT
+
+	/////
+	// Static functions
+public:
+	static bool isExportCommand(int argc, char* argv[]);
+
+	/////
+	// Constructors/destructors
+public:
+	explicit CommandLineExporter() = default;
+
+	/////
+	// Object functions
+public:
+	int run(const QStringList& arguments);
+
+private:
+	bool parseArguments(const QStringList& arguments);
+	int  runWorkers();
+	bool exportFile(const QString& filePath);
+	bool exportImage(const QString& basePath, ImageFormat_t format);
+	bool exportVhdl(const QString& basePath);
+	bool exportSystemVerilog(const QString& basePath);
+	bool exportCpp(const QString& basePath);
+	HdlStateEncoding_t getStateEncoding(uint statesCount) const;
+
+	void printMessage(const QString& message) const;
+	void printError  (const QString& message) const;
+
+	/////
+	// Object variables
+private:
+	bool helpRequested = false;
+
+	QStringList files;
+	QList<ImageFormat_t> imageFormats;
+	bool doExportVhdl          = false;
+	bool doExportSystemVerilog = false;
+	bool doExportCpp           = false;
+
+	QString outputDirectory; // Empty = next to each source file
+	uint  jobs        = 0;   // 0 = one per core
+	qreal bitmapScale = 1;
+
+	bool resetLogicPositive = true;
+	bool prefixSignals      = false;
+	bool registerMealyOutputs = false;
+	QString stateEncoding   = "timing"; // Encoding name or optimization goal
+
+};
+
+#endif // COMMANDLINEEXPORTER_H
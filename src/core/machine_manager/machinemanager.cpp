@@ -22,6 +22,9 @@
 // Current class
 #include "machinemanager.h"
 
+// Qt classes
+#include <QTimer>
+
 // StateS classes
 #include "machine.h"
 #include "fsm.h"
@@ -38,6 +41,10 @@
 #include "graphicfsm.h"
 
 
+/////
+// Static variables
+const int MachineManager::simulatedDisplayRefreshPeriod = 16;
+
 /////
 // Public global object
 unique_ptr<MachineManager> machineManager = make_unique<MachineManager>();
@@ -218,6 +225,32 @@ void MachineManager::notifyMachineEdited()
 	}
 }
 
+/**
+ * @brief MachineManager::notifyMachineRestructured This call
+ *        replaces notifyMachineEdited() after a diff edit that
+ *        the graphic machine does not follow, such as transitions
+ *        redirected by an automated transformation. The graphic
+ *        machine is rebuilt with the same graphic attributes,
+ *        then a diff undo command is built.
+ */
+void MachineManager::notifyMachineRestructured()
+{
+	shared_ptr<Fsm> fsm = dynamic_pointer_cast<Fsm>(this->machine);
+	if ( (fsm != nullptr) && (this->graphicMachine != nullptr) )
+	{
+		auto graphicAttributes = this->graphicMachine->getGraphicAttributes();
+
+		this->graphicMachine.reset();
+		this->graphicMachine = make_shared<GraphicFsm>();
+		this->graphicMachine->build(graphicAttributes);
+	}
+
+	this->notifyMachineEdited();
+
+	// Notify machine updated
+	emit this->machineUpdatedEvent();
+}
+
 void MachineManager::setUndoRedoMode(bool undoRedoMode)
 {
 	this->undoRedoMode = undoRedoMode;
@@ -234,6 +267,14 @@ void MachineManager::setSimulationMode(SimulationMode_t newMode)
 	switch (newMode)
 	{
 	case SimulationMode_t::editMode:
+		// Drop pending display updates as simulated components are about to be deleted
+		if (this->simulatedDisplayRefreshTimer != nullptr)
+		{
+			this->simulatedDisplayRefreshTimer->stop();
+		}
+		this->simulatedComponentsToRefresh.clear();
+		this->simulatedDisplayFrozen = false;
+
 		this->machineSimulator.reset();
 		this->graphicMachine->clearSimulation();
 
@@ -268,6 +309,26 @@ SimulationMode_t MachineManager::getCurrentSimulationMode() const
 	return this->currentSimulationMode;
 }
 
+/**
+ * @brief MachineManager::setSimulatedDisplayFrozen allows
+ * to stop refreshing the simulated components display,
+ * e.g. when simulation steps are too fast to be followed.
+ * Updates are still recorded and will be displayed when
+ * display is unfrozen.
+ */
+void MachineManager::setSimulatedDisplayFrozen(bool frozen)
+{
+	if (frozen == this->simulatedDisplayFrozen) return;
+
+
+	this->simulatedDisplayFrozen = frozen;
+
+	if (frozen == false)
+	{
+		this->refreshSimulatedDisplay();
+	}
+}
+
 /////
 // Slots
 
@@ -308,11 +369,52 @@ void MachineManager::componentEditedEventHandler(componentId_t componentId)
 
 void MachineManager::simulatedComponentUpdatedEventHandler(componentId_t componentId)
 {
-	auto simulatedGraphicComponent = this->graphicMachine->getSimulatedGraphicComponent(componentId);
-	if (simulatedGraphicComponent == nullptr) return;
+	this->simulatedComponentsToRefresh.insert(componentId);
+
+	if (this->simulatedDisplayFrozen == true) return;
+
+
+	if (this->simulatedDisplayRefreshTimer == nullptr)
+	{
+		this->simulatedDisplayRefreshTimer = make_shared<QTimer>();
+		this->simulatedDisplayRefreshTimer->setSingleShot(true);
+		this->simulatedDisplayRefreshTimer->setInterval(MachineManager::simulatedDisplayRefreshPeriod);
+		connect(this->simulatedDisplayRefreshTimer.get(), &QTimer::timeout, this, &MachineManager::refreshSimulatedDisplay);
+	}
+
+	if (this->simulatedDisplayRefreshTimer->isActive() == false)
+	{
+		this->simulatedDisplayRefreshTimer->start();
+	}
+}
+
+void MachineManager::refreshSimulatedDisplay()
+{
+	if (this->simulatedDisplayRefreshTimer != nullptr)
+	{
+		this->simulatedDisplayRefreshTimer->stop();
+	}
 
+	if (this->graphicMachine == nullptr) return;
 
-	simulatedGraphicComponent->refreshSimulatedDisplay();
+
+	// Swap the set, as refreshing components may trigger new updates
+	QSet<componentId_t> componentsToRefresh;
+	componentsToRefresh.swap(this->simulatedComponentsToRefresh);
+
+	for (auto componentId : componentsToRefresh)
+	{
+		auto simulatedGraphicComponent = this->graphicMachine->getSimulatedGraphicComponent(componentId);
+		if (simulatedGraphicComponent == nullptr) continue;
+
+
+		simulatedGraphicComponent->refreshSimulatedDisplay();
+	}
+
+	if (componentsToRefresh.isEmpty() == false)
+	{
+		emit this->simulatedDisplayRefreshedEvent();
+	}
 }
 
 /////
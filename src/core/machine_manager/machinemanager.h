@@ -29,6 +29,10 @@
 #include <memory>
 using namespace std;
 
+// Qt classes
+#include <QSet>
+class QTimer;
+
 // StateS classes
 #include "statestypes.h"
 #include "undoredomanager.h"
@@ -60,6 +64,12 @@ class MachineManager : public QObject
 {
 	Q_OBJECT
 
+	/////
+	// Static variables
+private:
+	// Minimum delay between two refreshes of the simulated display (ms)
+	static const int simulatedDisplayRefreshPeriod;
+
 	/////
 	// Constructors/destructors
 public:
@@ -90,6 +100,7 @@ public:
 	void notifyMachineEdited(StatesUndoCommand* undoCommand);
 	void notifyMachineEdited(const QString& undoDescription);
 	void notifyMachineEdited();
+	void notifyMachineRestructured();
 
 	void setUndoRedoMode(bool undoRedoMode);
 
@@ -97,6 +108,8 @@ public:
 	void setSimulationMode(SimulationMode_t newMode);
 	SimulationMode_t getCurrentSimulationMode() const;
 
+	void setSimulatedDisplayFrozen(bool frozen);
+
 private slots:
 	// Undo/redo
 	void freshMachineAvailableFromUndoRedo(shared_ptr<Machine> updatedMachine, shared_ptr<GraphicAttributes> updatedGraphicAttributes);
@@ -105,6 +118,7 @@ private slots:
 	void componentDeletedEventHandler(componentId_t componentId);
 	void componentEditedEventHandler(componentId_t componentId);
 	void simulatedComponentUpdatedEventHandler(componentId_t componentId);
+	void refreshSimulatedDisplay();
 
 private:
 	void setMachineInternal(shared_ptr<Machine> newMachine, shared_ptr<GraphicAttributes> newGraphicAttributes);
@@ -125,6 +139,9 @@ signals:
 
 	void simulationModeChangedEvent(SimulationMode_t newMode);
 
+	// Indicates simulated components display has been refreshed
+	void simulatedDisplayRefreshedEvent();
+
 	///
 	// Undo/redo manager events propagated by the manager
 
@@ -152,6 +169,12 @@ private:
 	bool undoRedoMode = false;
 	SimulationMode_t currentSimulationMode = SimulationMode_t::editMode;
 
+	// Simulated components updates are not displayed immediately:
+	// they are stored then displayed at once, at most once per frame.
+	QSet<componentId_t> simulatedComponentsToRefresh;
+	shared_ptr<QTimer> simulatedDisplayRefreshTimer;
+	bool simulatedDisplayFrozen = false;
+
 };
 
 
@@ -31,10 +31,16 @@
 #include "graphicmachine.h"
 #include "fsm.h"
 #include "simulatedfsm.h"
+#include "fastsimulationrunner.h"
+#include "simulationbreakpoints.h"
+#include "simulationhistory.h"
 
 
 MachineSimulator::MachineSimulator()
 {
+	this->breakpoints = make_shared<SimulationBreakpoints>();
+	this->history     = make_shared<SimulationHistory>();
+
 	auto machine = machineManager->getMachine();
 	if (machine == nullptr) return;
 
@@ -61,8 +67,12 @@ void MachineSimulator::initialize()
 
 	this->simulatedMachine->build();
 	this->simulatedMachine->reset();
+	this->history->initialize(dynamic_pointer_cast<Fsm>(machineManager->getMachine()), dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine));
+	this->initializeCoverage();
 
 	graphicMachine->forceRefreshSimulatedDisplay();
+
+	emit this->simulationCycleChangedEvent(0, 0);
 }
 
 void MachineSimulator::reset()
@@ -72,15 +82,30 @@ void MachineSimulator::reset()
 
 
 	this->suspend();
+	this->endFastSimulation(false);
 	this->simulatedMachine->reset();
+	this->history->initialize(dynamic_pointer_cast<Fsm>(machineManager->getMachine()), dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine));
+	this->breakpoints->resynchronize();
+
+	// Coverage is kept over resets, only count initial state
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine);
+	if (simulatedFsm != nullptr)
+	{
+		this->coverage.recordStateVisit(this->coverageEngine.getStateIndex(simulatedFsm->getActiveStateId()));
+		emit this->coverageChangedEvent();
+	}
 
 	graphicMachine->forceRefreshSimulatedDisplay();
 
 	emit this->timelineResetEvent();
+	emit this->simulationCycleChangedEvent(0, 0);
 }
 
 void MachineSimulator::doStep()
 {
+	if (this->isFastSimulationRunning() == true) return;
+
+
 	// emergencyShutDown can change asynchronously
 	// as the result of signals. Read comments in
 	// the order they are numbered.
@@ -88,6 +113,7 @@ void MachineSimulator::doStep()
 	// 2.
 	// Do not redo prepareStep if we are resuming from
 	// shutdown mode...
+	bool resumingFromShutDown = this->emergencyShutDown;
 	if (this->emergencyShutDown == false)
 	{
 		this->simulatedMachine->prepareStep();
@@ -105,12 +131,33 @@ void MachineSimulator::doStep()
 
 	if (this->emergencyShutDown == false)
 	{
-		this->simulatedMachine->prepareActions();
-		emit this->timelineDoStepEvent();
-		this->simulatedMachine->doStep();
+		// When resuming from shutdown mode, the transition has been chosen by user
+		this->finishStep(resumingFromShutDown);
 	}
 }
 
+/**
+ * @brief MachineSimulator::doStepThroughTransition does a step
+ * crossing the given transition, which must be leaving the active
+ * state, whatever its condition. This is used to replay a step
+ * where multiple transitions were crossable.
+ */
+void MachineSimulator::doStepThroughTransition(componentId_t transitionId)
+{
+	if (this->isFastSimulationRunning() == true) return;
+
+	if (this->emergencyShutDown == true) return;
+
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine);
+	if (simulatedFsm == nullptr) return;
+
+
+	if (simulatedFsm->forceTransitionToBeCrossed(transitionId) == false) return;
+
+
+	this->finishStep(true);
+}
+
 void MachineSimulator::start(uint period)
 {
 	if (this->timer == nullptr)
@@ -122,11 +169,22 @@ void MachineSimulator::start(uint period)
 	this->timer->setInterval(period);
 	this->timer->start();
 
+	if (period < this->displayFreezePeriod)
+	{
+		machineManager->setSimulatedDisplayFrozen(true);
+	}
+
 	emit this->autoSimulationToggledEvent(true);
 }
 
 void MachineSimulator::suspend()
 {
+	// Fast simulation end is notified asynchronously
+	if (this->fastSimulationRunner != nullptr)
+	{
+		this->fastSimulationRunner->requestStop();
+	}
+
 	if (this->timer == nullptr) return;
 
 	if (this->timer->isActive() == false) return;
@@ -134,9 +192,191 @@ void MachineSimulator::suspend()
 
 	this->timer->stop();
 
+	machineManager->setSimulatedDisplayFrozen(false);
+
 	emit this->autoSimulationToggledEvent(false);
 }
 
+/**
+ * @brief MachineSimulator::startFastSimulation runs the
+ * simulation as fast as possible in a worker thread, starting
+ * from current simulation state. The display is refreshed
+ * periodically from the worker snapshots. Simulation stops on
+ * user request (suspend()), on a transition conflict, or when
+ * one of the provided stop conditions is met.
+ * Unused stop conditions are set to 0 or nullId.
+ * Inputs keep the value they had when starting.
+ */
+void MachineSimulator::startFastSimulation(quint64 maxCycles, componentId_t stopStateId, componentId_t stopVariableId, const LogicValue& stopVariableValue)
+{
+	if (this->isFastSimulationRunning() == true) return;
+
+	if (this->emergencyShutDown == true) return;
+
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine);
+	if (simulatedFsm == nullptr) return;
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	this->suspend();
+
+	this->fastSimulationEngine = FsmSimulationEngine(fsm, simulatedFsm);
+	if (this->fastSimulationEngine.isSupported() == false)
+	{
+		emit this->fastSimulationEndedEvent(FastSimulationStopReason_t::unsupportedMachine, 0, 0);
+		return;
+	}
+
+	this->fastSimulationEngine.loadFromSimulatedFsm(simulatedFsm);
+	if (this->fastSimulationEngine.getActiveState() < 0)
+	{
+		emit this->fastSimulationEndedEvent(FastSimulationStopReason_t::noActiveState, 0, 0);
+		return;
+	}
+
+
+	// Compile breakpoints before engine is copied to the runner
+	FastSimulationRunner::StopConditions_t conditions;
+	conditions.breakpoints = this->breakpoints->compile(this->fastSimulationEngine);
+	conditions.maxCycles = maxCycles;
+	if (stopStateId != nullId)
+	{
+		conditions.stopState = this->fastSimulationEngine.getStateIndex(stopStateId);
+	}
+	if (stopVariableId != nullId)
+	{
+		int stopVariable = this->fastSimulationEngine.getVariableIndex(stopVariableId);
+		if ( (stopVariable >= 0) && (this->fastSimulationEngine.getVariableSize(stopVariable) == stopVariableValue.getSize()) )
+		{
+			conditions.stopVariable      = stopVariable;
+			conditions.stopVariableValue = FsmSimulationEngine::packValue(stopVariableValue);
+		}
+	}
+
+	this->history->beginFastSimulation(simulatedFsm);
+
+	this->fastSimulationRunner = make_shared<FastSimulationRunner>(this->fastSimulationEngine, conditions);
+	this->fastSimulationRunner->setCheckpointing(this->history->getCurrentCycle(), SimulationHistory::fastCheckpointInterval);
+	connect(this->fastSimulationRunner.get(), &FastSimulationRunner::runFinishedEvent, this, &MachineSimulator::fastSimulationFinishedEventHandler);
+
+	if (this->fastSimulationDisplayTimer == nullptr)
+	{
+		this->fastSimulationDisplayTimer = make_shared<QTimer>();
+		this->fastSimulationDisplayTimer->setInterval(FastSimulationRunner::snapshotPeriod);
+		connect(this->fastSimulationDisplayTimer.get(), &QTimer::timeout, this, &MachineSimulator::fastSimulationDisplayTimerEventHandler);
+	}
+
+	// The whole run is displayed as a single step in timeline
+	emit this->timelineDoStepEvent();
+
+	this->fastSimulationRunner->start();
+	this->fastSimulationDisplayTimer->start();
+
+	emit this->fastSimulationToggledEvent(true);
+	emit this->autoSimulationToggledEvent(true);
+}
+
+/**
+ * @brief MachineSimulator::stepBack restores
+ * simulation state as it was before the last step.
+ */
+void MachineSimulator::stepBack()
+{
+	auto currentCycle = this->history->getCurrentCycle();
+	if (currentCycle == 0) return;
+
+
+	this->goToCycle(currentCycle - 1);
+}
+
+/**
+ * @brief MachineSimulator::goToCycle restores simulation
+ * state at any step already simulated since last reset.
+ * Doing a step from a previous state discards the
+ * steps that were simulated after it.
+ * @return False if step is not available.
+ */
+bool MachineSimulator::goToCycle(quint64 cycle)
+{
+	if (this->isFastSimulationRunning() == true) return false;
+
+	if (this->emergencyShutDown == true) return false;
+
+	auto graphicMachine = machineManager->getGraphicMachine();
+	if (graphicMachine == nullptr) return false;
+
+
+	this->suspend();
+
+	if (this->history->goToCycle(cycle, dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine)) == false) return false;
+
+
+	this->breakpoints->resynchronize();
+
+	graphicMachine->forceRefreshSimulatedDisplay();
+
+	// Timeline restarts from restored state
+	emit this->timelineResetEvent();
+	emit this->simulationCycleChangedEvent(this->history->getCurrentCycle(), this->history->getLastCycle());
+
+	return true;
+}
+
+quint64 MachineSimulator::getCurrentCycle() const
+{
+	return this->history->getCurrentCycle();
+}
+
+quint64 MachineSimulator::getLastCycle() const
+{
+	return this->history->getLastCycle();
+}
+
+/**
+ * @brief MachineSimulator::forceStateActivation activates
+ * a state without doing a step. As this can't be replayed,
+ * history is notified.
+ */
+void MachineSimulator::forceStateActivation(componentId_t stateId)
+{
+	if (this->isFastSimulationRunning() == true) return;
+
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine);
+	if (simulatedFsm == nullptr) return;
+
+
+	simulatedFsm->forceStateActivation(stateId);
+	this->history->recordDiscontinuity(simulatedFsm);
+
+	emit this->simulationCycleChangedEvent(this->history->getCurrentCycle(), this->history->getLastCycle());
+}
+
+bool MachineSimulator::isFastSimulationRunning() const
+{
+	if (this->fastSimulationRunner != nullptr)
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+/**
+ * @brief MachineSimulator::setDisplayFreezePeriod sets
+ * the auto-simulation period under which the simulated
+ * display is not refreshed during simulation, and only
+ * updated when simulation is suspended. Use 0 to always
+ * refresh display.
+ */
+void MachineSimulator::setDisplayFreezePeriod(uint period)
+{
+	this->displayFreezePeriod = period;
+}
+
 void MachineSimulator::setMemorizedStateActionBehavior(SimulationBehavior_t behv)
 {
 	if (this->simulatedMachine == nullptr) return;
@@ -174,6 +414,86 @@ shared_ptr<SimulatedMachine> MachineSimulator::getSimulatedMachine() const
 	return this->simulatedMachine;
 }
 
+shared_ptr<SimulationBreakpoints> MachineSimulator::getBreakpoints() const
+{
+	return this->breakpoints;
+}
+
+shared_ptr<SimulationHistory> MachineSimulator::getHistory() const
+{
+	return this->history;
+}
+
+const FsmCoverage& MachineSimulator::getCoverage() const
+{
+	return this->coverage;
+}
+
+void MachineSimulator::clearCoverage()
+{
+	this->coverage.clear();
+
+	emit this->coverageChangedEvent();
+
+	if (this->coverageOverlayEnabled == false) return;
+
+	auto graphicMachine = machineManager->getGraphicMachine();
+	if (graphicMachine == nullptr) return;
+
+
+	graphicMachine->forceRefreshSimulatedDisplay();
+}
+
+/**
+ * @brief MachineSimulator::mergeCoverage adds coverage obtained
+ * outside of the interactive simulator, e.g. by a random regression,
+ * to the simulator coverage.
+ */
+void MachineSimulator::mergeCoverage(const FsmCoverage& otherCoverage)
+{
+	if (this->coverage.merge(otherCoverage) == false) return;
+
+
+	emit this->coverageChangedEvent();
+
+	if (this->coverageOverlayEnabled == false) return;
+
+	auto graphicMachine = machineManager->getGraphicMachine();
+	if (graphicMachine == nullptr) return;
+
+
+	graphicMachine->forceRefreshSimulatedDisplay();
+}
+
+/**
+ * @brief MachineSimulator::setCoverageOverlayEnabled toggles
+ * the display of uncovered states and transitions on the
+ * simulated machine.
+ */
+void MachineSimulator::setCoverageOverlayEnabled(bool enabled)
+{
+	if (enabled == this->coverageOverlayEnabled) return;
+
+
+	this->coverageOverlayEnabled = enabled;
+
+	auto graphicMachine = machineManager->getGraphicMachine();
+	if (graphicMachine == nullptr) return;
+
+
+	graphicMachine->forceRefreshSimulatedDisplay();
+}
+
+bool MachineSimulator::getCoverageOverlayEnabled() const
+{
+	return this->coverageOverlayEnabled;
+}
+
+bool MachineSimulator::getTermsCoverageSupported() const
+{
+	return this->termsCoverageSupported;
+}
+
 void MachineSimulator::timerTimeoutEventHandler()
 {
 	this->doStep();
@@ -202,8 +522,145 @@ void MachineSimulator::resumeNormalActivitiesEventHandler()
 	{
 		if (this->timer != nullptr)
 		{
-			this->timer->start();
-			emit this->autoSimulationToggledEvent(true);
+			this->start(this->timer->interval());
 		}
 	}
 }
+
+void MachineSimulator::fastSimulationDisplayTimerEventHandler()
+{
+	if (this->fastSimulationRunner == nullptr) return;
+
+
+	FsmSimulationEngine::Snapshot_t snapshot;
+	quint64 cycles;
+	if (this->fastSimulationRunner->getLatestSnapshot(snapshot, cycles) == false) return;
+
+
+	this->fastSimulationEngine.restoreSnapshot(snapshot);
+	this->fastSimulationEngine.applyToSimulatedFsm(dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine));
+
+	emit this->fastSimulationProgressEvent(cycles);
+}
+
+/**
+ * @brief MachineSimulator::finishStep does the step once
+ * the transition to cross is known.
+ */
+void MachineSimulator::finishStep(bool transitionChosenByUser)
+{
+	componentId_t crossedTransitionId = nullId;
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine);
+	if (simulatedFsm != nullptr)
+	{
+		crossedTransitionId = simulatedFsm->getTransitionToBeCrossedId();
+	}
+
+	this->history->recordStep(simulatedFsm, (transitionChosenByUser == true) ? crossedTransitionId : nullId);
+
+	// Conditions terms are recorded with inputs values used for this step
+	if ( (simulatedFsm != nullptr) && (this->termsCoverageSupported == true) )
+	{
+		this->coverageEngine.loadConditionsFromSimulatedFsm(simulatedFsm, this->coverageEngine.getStateIndex(simulatedFsm->getActiveStateId()));
+		this->coverage.recordConditions(this->coverageEngine);
+	}
+
+	this->simulatedMachine->prepareActions();
+	emit this->timelineDoStepEvent();
+	this->simulatedMachine->doStep();
+
+	this->history->stepDone(simulatedFsm);
+
+	if (simulatedFsm != nullptr)
+	{
+		this->coverage.recordTransitionCrossing(this->coverageEngine.getTransitionIndex(crossedTransitionId));
+		this->coverage.recordStateVisit(this->coverageEngine.getStateIndex(simulatedFsm->getActiveStateId()));
+		emit this->coverageChangedEvent();
+	}
+	emit this->simulationCycleChangedEvent(this->history->getCurrentCycle(), this->history->getLastCycle());
+
+	this->checkBreakpoints(crossedTransitionId);
+}
+
+void MachineSimulator::checkBreakpoints(componentId_t crossedTransitionId)
+{
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine);
+	if (simulatedFsm == nullptr) return;
+
+
+	QString hitDescription;
+	if (this->breakpoints->check(crossedTransitionId, simulatedFsm->getActiveStateId(), hitDescription) == true)
+	{
+		this->suspend();
+
+		emit this->breakpointHitEvent(hitDescription);
+	}
+}
+
+/**
+ * @brief MachineSimulator::initializeCoverage builds
+ * an empty coverage for the current machine, in which
+ * the initial state is counted as visited.
+ */
+void MachineSimulator::initializeCoverage()
+{
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine);
+	if (simulatedFsm == nullptr) return;
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	this->coverageEngine = FsmSimulationEngine(fsm, simulatedFsm);
+	this->termsCoverageSupported = this->coverageEngine.isSupported();
+	this->coverage = FsmCoverage(this->coverageEngine);
+	this->coverage.recordStateVisit(this->coverageEngine.getStateIndex(simulatedFsm->getActiveStateId()));
+
+	emit this->coverageChangedEvent();
+}
+
+void MachineSimulator::fastSimulationFinishedEventHandler()
+{
+	this->endFastSimulation(true);
+}
+
+/**
+ * @brief MachineSimulator::endFastSimulation waits for the worker
+ * to finish, then applies its final state to the simulated machine
+ * if requested.
+ */
+void MachineSimulator::endFastSimulation(bool applyResult)
+{
+	// Finished event may be received after fast simulation has already been ended
+	if (this->fastSimulationRunner == nullptr) return;
+
+
+	this->fastSimulationRunner->requestStop();
+	this->fastSimulationRunner->wait();
+	this->fastSimulationDisplayTimer->stop();
+
+	auto reason = this->fastSimulationRunner->getStopReason();
+	auto cycles = this->fastSimulationRunner->getCyclesCount();
+	auto elapsedTime = this->fastSimulationRunner->getElapsedTime();
+
+	if (applyResult == true)
+	{
+		this->fastSimulationDisplayTimerEventHandler();
+		this->history->endFastSimulation(dynamic_pointer_cast<SimulatedFsm>(this->simulatedMachine), cycles, this->fastSimulationRunner->getCheckpoints());
+		this->coverage.merge(this->fastSimulationRunner->getCoverage());
+		emit this->coverageChangedEvent();
+	}
+	this->breakpoints->resynchronize();
+
+	this->fastSimulationRunner.reset();
+
+	emit this->fastSimulationToggledEvent(false);
+	emit this->autoSimulationToggledEvent(false);
+	emit this->fastSimulationEndedEvent(reason, cycles, elapsedTime);
+	emit this->simulationCycleChangedEvent(this->history->getCurrentCycle(), this->history->getLastCycle());
+
+	if (reason == FastSimulationStopReason_t::breakpointHit)
+	{
+		emit this->breakpointHitEvent(tr("Breakpoint reached after") + " " + QString::number(cycles) + " " + tr("steps of fast simulation"));
+	}
+}
@@ -34,7 +34,12 @@ class QTimer;
 
 // SateS classes
 #include "statestypes.h"
+#include "fsmsimulationengine.h"
+#include "fsmcoverage.h"
 class SimulatedMachine;
+class FastSimulationRunner;
+class SimulationBreakpoints;
+class SimulationHistory;
 
 
 class MachineSimulator : public QObject
@@ -53,15 +58,37 @@ public:
 
 	void reset();
 	void doStep();
+	void doStepThroughTransition(componentId_t transitionId);
 	void start(uint period);
 	void suspend();
 
+	void stepBack();
+	bool goToCycle(quint64 cycle);
+	quint64 getCurrentCycle() const;
+	quint64 getLastCycle() const;
+
+	void forceStateActivation(componentId_t stateId);
+
+	void startFastSimulation(quint64 maxCycles, componentId_t stopStateId, componentId_t stopVariableId, const LogicValue& stopVariableValue);
+	bool isFastSimulationRunning() const;
+
+	void setDisplayFreezePeriod(uint period);
+
 	void setMemorizedStateActionBehavior     (SimulationBehavior_t behv);
 	void setContinuousStateActionBehavior    (SimulationBehavior_t behv);
 	void setMemorizedTransitionActionBehavior(SimulationBehavior_t behv);
 	void setPulseTransitionActionBehavior    (SimulationBehavior_t behv);
 
 	shared_ptr<SimulatedMachine> getSimulatedMachine() const;
+	shared_ptr<SimulationBreakpoints> getBreakpoints() const;
+	shared_ptr<SimulationHistory> getHistory() const;
+
+	const FsmCoverage& getCoverage() const;
+	void clearCoverage();
+	void mergeCoverage(const FsmCoverage& otherCoverage);
+	void setCoverageOverlayEnabled(bool enabled);
+	bool getCoverageOverlayEnabled() const;
+	bool getTermsCoverageSupported() const;
 
 private slots:
 	void timerTimeoutEventHandler();
@@ -69,6 +96,15 @@ private slots:
 	void emergencyShutDownEventHandler();
 	void resumeNormalActivitiesEventHandler();
 
+	void fastSimulationDisplayTimerEventHandler();
+	void fastSimulationFinishedEventHandler();
+
+private:
+	void finishStep(bool transitionChosenByUser);
+	void checkBreakpoints(componentId_t crossedTransitionId);
+	void initializeCoverage();
+	void endFastSimulation(bool applyResult);
+
 	/////
 	// Signals
 signals:
@@ -77,13 +113,41 @@ signals:
 
 	void autoSimulationToggledEvent(bool simulating);
 
+	void fastSimulationToggledEvent(bool simulating);
+	void fastSimulationProgressEvent(quint64 cycles);
+	void fastSimulationEndedEvent(FastSimulationStopReason_t reason, quint64 cycles, qint64 elapsedTime);
+
+	void breakpointHitEvent(const QString& description);
+
+	void simulationCycleChangedEvent(quint64 currentCycle, quint64 lastCycle);
+
+	void coverageChangedEvent();
+
 	/////
 	// Object variables
 private:
 	shared_ptr<SimulatedMachine> simulatedMachine;
+	shared_ptr<SimulationBreakpoints> breakpoints;
+	shared_ptr<SimulationHistory> history;
 	shared_ptr<QTimer> timer;
 	bool emergencyShutDown = false;
 	bool wasAutoSimulatingBeforeShutDown;
+	// Auto simulation with a period lower than this one does not refresh display (0 = always refresh)
+	uint displayFreezePeriod = 0;
+
+	// Fast simulation runs in a worker thread using its own engine,
+	// the display being periodically updated from its snapshots
+	shared_ptr<FastSimulationRunner> fastSimulationRunner;
+	shared_ptr<QTimer> fastSimulationDisplayTimer;
+	FsmSimulationEngine fastSimulationEngine;
+
+	// Coverage is accumulated over all runs until cleared. The
+	// engine is only used to evaluate conditions terms.
+	FsmSimulationEngine coverageEngine;
+	FsmCoverage coverage;
+	bool coverageOverlayEnabled = false;
+	// Terms are not recorded if the engine can not evaluate conditions (values larger than 64 bits)
+	bool termsCoverageSupported = false;
 
 };
 
@@ -0,0 +1,223 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fastsimulationrunner.h"
+
+// Qt classes
+#include <QThread>
+#include <QElapsedTimer>
+#include <QMutexLocker>
+
+
+FastSimulationRunner::FastSimulationRunner(const FsmSimulationEngine& engine, const StopConditions_t& conditions)
+{
+	this->engine     = engine;
+	this->conditions = conditions;
+	this->coverage   = FsmCoverage(engine);
+}
+
+FastSimulationRunner::~FastSimulationRunner()
+{
+	this->requestStop();
+	this->wait();
+}
+
+/**
+ * @brief FastSimulationRunner::setCheckpointing requests
+ * the worker to record a snapshot each time the absolute
+ * cycle number is a multiple of interval. Must be called
+ * before start().
+ * @param firstCycle Absolute cycle number when starting.
+ */
+void FastSimulationRunner::setCheckpointing(quint64 firstCycle, quint64 interval)
+{
+	if (this->thread != nullptr) return;
+
+
+	this->checkpointsFirstCycle = firstCycle;
+	this->checkpointsInterval   = interval;
+}
+
+void FastSimulationRunner::start()
+{
+	if (this->thread != nullptr) return;
+
+
+	this->thread.reset(QThread::create([this]() { this->run(); }));
+	this->thread->start();
+}
+
+void FastSimulationRunner::requestStop()
+{
+	this->stopRequested = true;
+}
+
+void FastSimulationRunner::wait()
+{
+	if (this->thread == nullptr) return;
+
+
+	this->thread->wait();
+}
+
+/**
+ * @brief FastSimulationRunner::getLatestSnapshot obtains
+ * the last snapshot published by the worker.
+ * @return False if no new snapshot was published since last call.
+ */
+bool FastSimulationRunner::getLatestSnapshot(FsmSimulationEngine::Snapshot_t& snapshot, quint64& cycles)
+{
+	QMutexLocker locker(&this->snapshotMutex);
+
+	if (this->newSnapshotAvailable == false) return false;
+
+
+	snapshot = this->latestSnapshot;
+	cycles   = this->latestCycles;
+	this->newSnapshotAvailable = false;
+
+	return true;
+}
+
+FastSimulationStopReason_t FastSimulationRunner::getStopReason() const
+{
+	return this->stopReason;
+}
+
+quint64 FastSimulationRunner::getCyclesCount() const
+{
+	return this->cyclesCount;
+}
+
+qint64 FastSimulationRunner::getElapsedTime() const
+{
+	return this->elapsedTime;
+}
+
+const QMap<quint64, FsmSimulationEngine::Snapshot_t>& FastSimulationRunner::getCheckpoints() const
+{
+	return this->checkpoints;
+}
+
+/**
+ * @brief FastSimulationRunner::getCoverage obtains the coverage
+ * of the steps done by the run. The starting state is not
+ * counted, as it was already active before the run.
+ */
+const FsmCoverage& FastSimulationRunner::getCoverage() const
+{
+	return this->coverage;
+}
+
+void FastSimulationRunner::run()
+{
+	QElapsedTimer timer;
+	timer.start();
+	qint64 lastSnapshotTime = 0;
+
+	quint64 cycles = 0;
+	auto reason = FastSimulationStopReason_t::userRequest;
+
+	// Count down rather than using a modulo on each cycle
+	quint64 cyclesToNextCheckpoint = 0;
+	if (this->checkpointsInterval != 0)
+	{
+		cyclesToNextCheckpoint = this->checkpointsInterval - (this->checkpointsFirstCycle % this->checkpointsInterval);
+	}
+
+	auto& conditions = this->conditions;
+	while (true)
+	{
+		if ( (conditions.maxCycles != 0) && (cycles >= conditions.maxCycles) )
+		{
+			reason = FastSimulationStopReason_t::cycleCountReached;
+			break;
+		}
+
+		this->coverage.recordConditions(this->engine);
+		if (this->engine.doStep() != FsmSimulationEngine::StepResult_t::stepped)
+		{
+			reason = FastSimulationStopReason_t::transitionConflict;
+			break;
+		}
+		this->coverage.recordStep(this->engine);
+		cycles++;
+
+		if (cyclesToNextCheckpoint != 0)
+		{
+			cyclesToNextCheckpoint--;
+			if (cyclesToNextCheckpoint == 0)
+			{
+				this->checkpoints[this->checkpointsFirstCycle + cycles] = this->engine.getSnapshot();
+				cyclesToNextCheckpoint = this->checkpointsInterval;
+			}
+		}
+
+		if ( (conditions.stopState >= 0) && (this->engine.getActiveState() == conditions.stopState) )
+		{
+			reason = FastSimulationStopReason_t::stateReached;
+			break;
+		}
+
+		if ( (conditions.stopVariable >= 0) && (this->engine.getVariableValue(conditions.stopVariable) == conditions.stopVariableValue) )
+		{
+			reason = FastSimulationStopReason_t::variableValueReached;
+			break;
+		}
+
+		if (SimulationBreakpoints::checkCompiled(conditions.breakpoints, this->engine) == true)
+		{
+			reason = FastSimulationStopReason_t::breakpointHit;
+			break;
+		}
+
+		if ((cycles % FastSimulationRunner::pollingInterval) == 0)
+		{
+			if (this->stopRequested == true) break;
+
+
+			qint64 currentTime = timer.elapsed();
+			if ((currentTime - lastSnapshotTime) >= FastSimulationRunner::snapshotPeriod)
+			{
+				this->publishSnapshot(cycles);
+				lastSnapshotTime = currentTime;
+			}
+		}
+	}
+
+	this->publishSnapshot(cycles);
+
+	this->stopReason  = reason;
+	this->cyclesCount = cycles;
+	this->elapsedTime = timer.elapsed();
+
+	emit this->runFinishedEvent();
+}
+
+void FastSimulationRunner::publishSnapshot(quint64 cycles)
+{
+	QMutexLocker locker(&this->snapshotMutex);
+
+	this->latestSnapshot = this->engine.getSnapshot();
+	this->latestCycles   = cycles;
+	this->newSnapshotAvailable = true;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FASTSIMULATIONRUNNER_H
+#define FASTSIMULATIONRUNNER_H
+
+// Parent
+#include <QObject>
+
+// C++ classes
+#include <memory>
+#include <atomic>
+using namespace std;
+
+// Qt classes
+#include <QMutex>
+#include <QMap>
+class QThread;
+
+// StateS classes
+#include "statestypes.h"
+#include "fsmsimulationengine.h"
+#include "fsmcoverage.h"
+#include "simulationbreakpoints.h"
+
+
+/**
+ * @brief The FastSimulationRunner class runs a simulation
+ * engine as fast as possible in a worker thread.
+ *
+ * The worker never interacts with the display: it only
+ * publishes a snapshot of the simulation at a limited
+ * rate, that the GUI thread can poll when it wants to.
+ */
+class FastSimulationRunner : public QObject
+{
+	Q_OBJECT
+
+	/////
+	// Type declarations
+public:
+	struct StopConditions_t
+	{
+		quint64 maxCycles         = 0;  // 0 = no limit
+		int     stopState         = -1; // Engine state index, -1 = unused
+		int     stopVariable      = -1; // Engine variable index, -1 = unused
+		quint64 stopVariableValue = 0;
+		SimulationBreakpoints::Compiled_t breakpoints;
+	};
+
+	/////
+	// Static variables
+public:
+	// Minimum time between two published snapshots, in ms
+	static const qint64 snapshotPeriod = 33;
+
+private:
+	// Number of cycles between two checks of the stop request and snapshot timer
+	static const quint64 pollingInterval = 1024;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FastSimulationRunner(const FsmSimulationEngine& engine, const StopConditions_t& conditions);
+	~FastSimulationRunner();
+
+	/////
+	// Object functions
+public:
+	void setCheckpointing(quint64 firstCycle, quint64 interval);
+
+	void start();
+	void requestStop();
+	void wait();
+
+	bool getLatestSnapshot(FsmSimulationEngine::Snapshot_t& snapshot, quint64& cycles);
+
+	FastSimulationStopReason_t getStopReason() const;
+	quint64 getCyclesCount() const;
+	qint64 getElapsedTime() const;
+	const QMap<quint64, FsmSimulationEngine::Snapshot_t>& getCheckpoints() const;
+	const FsmCoverage& getCoverage() const;
+
+private:
+	void run();
+	void publishSnapshot(quint64 cycles);
+
+	/////
+	// Signals
+signals:
+	// Emitted from the worker thread
+	void runFinishedEvent();
+
+	/////
+	// Object variables
+private:
+	// Owned by worker thread while running
+	FsmSimulationEngine engine;
+	StopConditions_t conditions;
+	quint64 checkpointsFirstCycle = 0;
+	quint64 checkpointsInterval   = 0; // 0 = no checkpoints
+
+	unique_ptr<QThread> thread;
+	atomic<bool> stopRequested = false;
+
+	// Shared with GUI thread
+	QMutex snapshotMutex;
+	FsmSimulationEngine::Snapshot_t latestSnapshot;
+	quint64 latestCycles = 0;
+	bool newSnapshotAvailable = false;
+
+	// Only read when thread is finished
+	FastSimulationStopReason_t stopReason = FastSimulationStopReason_t::userRequest;
+	quint64 cyclesCount = 0;
+	qint64 elapsedTime  = 0;
+	// Indexed by absolute cycle number
+	QMap<quint64, FsmSimulationEngine::Snapshot_t> checkpoints;
+	FsmCoverage coverage;
+
+};
+
+#endif // FASTSIMULATIONRUNNER_H
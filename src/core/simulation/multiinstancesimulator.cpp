@@ -0,0 +1,465 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "multiinstancesimulator.h"
+
+// Qt classes
+#include <QThread>
+
+// StateS classes
+#include "fsm.h"
+#include "fsmstate.h"
+#include "variable.h"
+
+
+MultiInstanceSimulator::~MultiInstanceSimulator()
+{
+	this->requestStop();
+	this->wait();
+}
+
+/**
+ * @brief MultiInstanceSimulator::addInstance compiles the FSM to
+ * a new instance. Actions behaviors are obtained from the simulated
+ * FSM if provided. The instance is reset after being added.
+ * @return False if the FSM can not be compiled (variables larger
+ * than 64 bits) or if a run is in progress.
+ */
+bool MultiInstanceSimulator::addInstance(const QString& name, shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm)
+{
+	if (this->isRunning() == true) return false;
+
+	if (fsm == nullptr) return false;
+
+
+	Instance_t instance;
+	instance.name        = name;
+	instance.machineName = fsm->getName();
+	instance.engine      = FsmSimulationEngine(fsm, simulatedFsm);
+
+	if (instance.engine.isSupported() == false) return false;
+
+
+	for (const auto& inputId : fsm->getInputVariablesIds())
+	{
+		auto input = fsm->getVariable(inputId);
+		int variableIndex = instance.engine.getVariableIndex(inputId);
+		if ( (input == nullptr) || (variableIndex < 0) ) continue;
+
+
+		Port_t port;
+		port.name     = input->getName();
+		port.variable = variableIndex;
+		port.size     = input->getSize();
+
+		instance.inputs.append(port);
+	}
+
+	for (const auto& outputId : fsm->getOutputVariablesIds())
+	{
+		auto output = fsm->getVariable(outputId);
+		int variableIndex = instance.engine.getVariableIndex(outputId);
+		if ( (output == nullptr) || (variableIndex < 0) ) continue;
+
+
+		Port_t port;
+		port.name     = output->getName();
+		port.variable = variableIndex;
+		port.size     = output->getSize();
+
+		instance.outputs.append(port);
+	}
+
+	for (uint i = 0 ; i < instance.engine.getStatesCount() ; i++)
+	{
+		auto state = fsm->getState(instance.engine.getStateId(i));
+		if (state != nullptr)
+		{
+			instance.statesNames.append(state->getName());
+		}
+		else
+		{
+			instance.statesNames.append(QString());
+		}
+	}
+
+	instance.engine.reset();
+
+	this->instances.append(instance);
+
+	return true;
+}
+
+/**
+ * @brief MultiInstanceSimulator::removeInstance removes
+ * an instance, along with all wires connected to it.
+ */
+void MultiInstanceSimulator::removeInstance(uint instance)
+{
+	if (this->isRunning() == true) return;
+
+	if (instance >= (uint)this->instances.count()) return;
+
+
+	for (int i = this->wires.count() - 1 ; i >= 0 ; i--)
+	{
+		auto& wire = this->wires[i];
+		if ( (wire.sourceInstance == instance) || (wire.targetInstance == instance) )
+		{
+			this->wires.removeAt(i);
+			continue;
+		}
+
+		if (wire.sourceInstance > instance)
+		{
+			wire.sourceInstance--;
+		}
+		if (wire.targetInstance > instance)
+		{
+			wire.targetInstance--;
+		}
+	}
+
+	this->instances.removeAt(instance);
+}
+
+void MultiInstanceSimulator::setInstanceStepsPerRun(uint instance, quint64 steps)
+{
+	if (this->isRunning() == true) return;
+
+	if (instance >= (uint)this->instances.count()) return;
+
+
+	this->instances[instance].stepsPerRun = steps;
+}
+
+/**
+ * @brief MultiInstanceSimulator::addWire connects an output of an
+ * instance to an input of an instance. Ports must be the same size,
+ * and an input can only be driven by one wire. The input value is
+ * updated immediately.
+ * @return False if the wire could not be added.
+ */
+bool MultiInstanceSimulator::addWire(const Wire_t& wire)
+{
+	if (this->isRunning() == true) return false;
+
+	if (wire.sourceInstance >= (uint)this->instances.count()) return false;
+
+	if (wire.targetInstance >= (uint)this->instances.count()) return false;
+
+	const auto& source = this->instances.at(wire.sourceInstance);
+	const auto& target = this->instances.at(wire.targetInstance);
+	if (wire.sourceOutput >= (uint)source.outputs.count()) return false;
+
+	if (wire.targetInput >= (uint)target.inputs.count()) return false;
+
+	if (source.outputs.at(wire.sourceOutput).size != target.inputs.at(wire.targetInput).size) return false;
+
+
+	for (const auto& existingWire : this->wires)
+	{
+		if ( (existingWire.targetInstance == wire.targetInstance) && (existingWire.targetInput == wire.targetInput) ) return false;
+	}
+
+	this->wires.append(wire);
+	this->propagateWires();
+
+	return true;
+}
+
+void MultiInstanceSimulator::removeWire(uint wire)
+{
+	if (this->isRunning() == true) return;
+
+	if (wire >= (uint)this->wires.count()) return;
+
+
+	this->wires.removeAt(wire);
+}
+
+/**
+ * @brief MultiInstanceSimulator::reset resets all instances
+ * and their results, then propagates wires.
+ */
+void MultiInstanceSimulator::reset()
+{
+	if (this->isRunning() == true) return;
+
+
+	for (auto& instance : this->instances)
+	{
+		instance.engine.reset();
+		instance.steps     = 0;
+		instance.conflicts = 0;
+	}
+
+	this->propagateWires();
+}
+
+/**
+ * @brief MultiInstanceSimulator::start starts a run from the
+ * current state of the instances, with one worker per instance.
+ * runFinishedEvent is emitted when the run is over.
+ */
+void MultiInstanceSimulator::start(const Settings_t& settings)
+{
+	if (this->isRunning() == true) return;
+
+	if (this->instances.isEmpty() == true) return;
+
+	if ( (settings.mode == SteppingMode_t::lockstep) && (settings.cycles == 0) ) return;
+
+
+	// Join workers from previous run
+	this->wait();
+	this->workers.clear();
+
+	this->settings       = settings;
+	this->stopRequested  = false;
+	this->completedSteps = 0;
+
+	// Make sure instances are detached before workers access them
+	this->instances.detach();
+
+	uint instancesCount = this->instances.count();
+
+	switch (settings.mode)
+	{
+	case SteppingMode_t::lockstep:
+		this->totalSteps      = settings.cycles * instancesCount;
+		this->completedCycles = 0;
+		this->lockstepDone    = false;
+
+		this->propagateWires();
+		this->cycleBarrier = make_unique<barrier<CycleCompletion_t>>(instancesCount, CycleCompletion_t{this});
+		break;
+	case SteppingMode_t::independent:
+		this->totalSteps = 0;
+		for (const auto& instance : this->instances)
+		{
+			this->totalSteps += instance.stepsPerRun;
+		}
+
+		this->instancesIncomingWires.clear();
+		this->instancesOutgoingWires.clear();
+		this->instancesIncomingWires.resize(instancesCount);
+		this->instancesOutgoingWires.resize(instancesCount);
+
+		this->wiresValues = vector<atomic<quint64>>(this->wires.count());
+		for (uint i = 0 ; i < (uint)this->wires.count() ; i++)
+		{
+			const auto& wire = this->wires.at(i);
+			this->instancesIncomingWires[wire.targetInstance].append(i);
+			this->instancesOutgoingWires[wire.sourceInstance].append(i);
+
+			const auto& source = this->instances.at(wire.sourceInstance);
+			this->wiresValues[i] = source.engine.getVariableValue(source.outputs.at(wire.sourceOutput).variable);
+		}
+		break;
+	}
+
+	this->runningWorkers = instancesCount;
+	for (uint i = 0 ; i < instancesCount ; i++)
+	{
+		switch (settings.mode)
+		{
+		case SteppingMode_t::lockstep:
+			this->workers.emplace_back(QThread::create([this, i]() { this->runLockstepWorker(i); }));
+			break;
+		case SteppingMode_t::independent:
+			this->workers.emplace_back(QThread::create([this, i]() { this->runIndependentWorker(i); }));
+			break;
+		}
+		this->workers.back()->start();
+	}
+}
+
+void MultiInstanceSimulator::requestStop()
+{
+	this->stopRequested = true;
+}
+
+void MultiInstanceSimulator::wait()
+{
+	for (auto& worker : this->workers)
+	{
+		worker->wait();
+	}
+}
+
+bool MultiInstanceSimulator::isRunning() const
+{
+	return (this->runningWorkers != 0);
+}
+
+quint64 MultiInstanceSimulator::getCompletedSteps() const
+{
+	return this->completedSteps;
+}
+
+quint64 MultiInstanceSimulator::getTotalSteps() const
+{
+	return this->totalSteps;
+}
+
+uint MultiInstanceSimulator::getInstancesCount() const
+{
+	return this->instances.count();
+}
+
+const MultiInstanceSimulator::Instance_t& MultiInstanceSimulator::getInstance(uint instance) const
+{
+	return this->instances.at(instance);
+}
+
+const QList<MultiInstanceSimulator::Wire_t>& MultiInstanceSimulator::getWires() const
+{
+	return this->wires;
+}
+
+/**
+ * @brief MultiInstanceSimulator::runLockstepWorker steps one
+ * instance each cycle, then waits for all other instances.
+ * The last worker reaching the barrier propagates wires.
+ */
+void MultiInstanceSimulator::runLockstepWorker(uint instance)
+{
+	Instance_t& simulatedInstance = this->instances.data()[instance];
+
+	while (this->lockstepDone == false)
+	{
+		this->stepInstance(simulatedInstance);
+		this->cycleBarrier->arrive_and_wait();
+	}
+
+	this->workerDone();
+}
+
+/**
+ * @brief MultiInstanceSimulator::runIndependentWorker steps one
+ * instance, reading wires driving its inputs before each step and
+ * writing wires driven by its outputs after each step.
+ */
+void MultiInstanceSimulator::runIndependentWorker(uint instance)
+{
+	Instance_t& simulatedInstance = this->instances.data()[instance];
+	const auto& incomingWires = this->instancesIncomingWires.at(instance);
+	const auto& outgoingWires = this->instancesOutgoingWires.at(instance);
+
+	quint64 pendingSteps = 0;
+	for (quint64 step = 0 ; step < simulatedInstance.stepsPerRun ; step++)
+	{
+		if ( ((step % MultiInstanceSimulator::pollingInterval) == 0) && (this->stopRequested == true) ) break;
+
+
+		for (auto wireIndex : incomingWires)
+		{
+			const auto& input = simulatedInstance.inputs.at(this->wires.at(wireIndex).targetInput);
+			simulatedInstance.engine.setVariableValue(input.variable, this->wiresValues[wireIndex]);
+		}
+
+		this->stepInstance(simulatedInstance);
+
+		for (auto wireIndex : outgoingWires)
+		{
+			const auto& output = simulatedInstance.outputs.at(this->wires.at(wireIndex).sourceOutput);
+			this->wiresValues[wireIndex] = simulatedInstance.engine.getVariableValue(output.variable);
+		}
+
+		pendingSteps++;
+		if (pendingSteps == MultiInstanceSimulator::pollingInterval)
+		{
+			this->completedSteps += pendingSteps;
+			pendingSteps = 0;
+		}
+	}
+
+	this->completedSteps += pendingSteps;
+
+	this->workerDone();
+}
+
+void MultiInstanceSimulator::workerDone()
+{
+	// Last worker notifies the end of the run
+	if (--this->runningWorkers == 0)
+	{
+		emit this->runFinishedEvent();
+	}
+}
+
+/**
+ * @brief MultiInstanceSimulator::stepInstance does one step,
+ * following the first candidate transition on conflict.
+ * @return False if the instance has no active state.
+ */
+bool MultiInstanceSimulator::stepInstance(Instance_t& instance)
+{
+	switch (instance.engine.doStep())
+	{
+	case FsmSimulationEngine::StepResult_t::stepped:
+		break;
+	case FsmSimulationEngine::StepResult_t::transitionConflict:
+		instance.conflicts++;
+		instance.engine.doStepThroughTransition(instance.engine.getCandidateTransitions().first());
+		break;
+	case FsmSimulationEngine::StepResult_t::noActiveState:
+		return false;
+	}
+
+	instance.steps++;
+
+	return true;
+}
+
+/**
+ * @brief MultiInstanceSimulator::propagateWires copies the value
+ * of each wire source output to its target input. Must only be
+ * called when no worker is stepping.
+ */
+void MultiInstanceSimulator::propagateWires()
+{
+	Instance_t* simulatedInstances = this->instances.data();
+
+	for (const auto& wire : this->wires)
+	{
+		const auto& source = simulatedInstances[wire.sourceInstance];
+		auto&       target = simulatedInstances[wire.targetInstance];
+
+		quint64 value = source.engine.getVariableValue(source.outputs.at(wire.sourceOutput).variable);
+		target.engine.setVariableValue(target.inputs.at(wire.targetInput).variable, value);
+	}
+}
+
+void MultiInstanceSimulator::CycleCompletion_t::operator()() noexcept
+{
+	this->simulator->propagateWires();
+
+	this->simulator->completedCycles++;
+	this->simulator->completedSteps += this->simulator->instances.count();
+
+	if ( (this->simulator->completedCycles >= this->simulator->settings.cycles) || (this->simulator->stopRequested == true) )
+	{
+		this->simulator->lockstepDone = true;
+	}
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MULTIINSTANCESIMULATOR_H
+#define MULTIINSTANCESIMULATOR_H
+
+// Parent
+#include <QObject>
+
+// C++ classes
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <barrier>
+using namespace std;
+
+// Qt classes
+#include <QList>
+#include <QString>
+class QThread;
+
+// StateS classes
+#include "fsmsimulationengine.h"
+class Fsm;
+class SimulatedFsm;
+
+
+/**
+ * @brief The MultiInstanceSimulator class simulates several
+ * machines side by side, each instance being stepped in its
+ * own worker thread.
+ *
+ * Instances are compiled engines: they do not depend on the
+ * machine they were built from once added, so copies of the
+ * current machine can be simulated along with machines that
+ * were loaded previously.
+ *
+ * Outputs of an instance can drive inputs of another using wires.
+ * In lockstep mode, all instances do one step per cycle, and wires
+ * are propagated between cycles while all workers are waiting.
+ * In independent mode, each instance does its own number of steps
+ * at its own pace, and reads the last value written to its wires.
+ *
+ * Transition conflicts are resolved by following the first
+ * candidate transition, so that runs are reproducible in
+ * lockstep mode.
+ */
+class MultiInstanceSimulator : public QObject
+{
+	Q_OBJECT
+
+	/////
+	// Type declarations
+public:
+	enum class SteppingMode_t { lockstep, independent };
+
+	struct Port_t
+	{
+		QString name;
+		uint    variable; // Engine variable index
+		uint    size;
+	};
+
+	struct Instance_t
+	{
+		QString name;
+		QString machineName;
+		FsmSimulationEngine engine;
+		QList<Port_t>  inputs;
+		QList<Port_t>  outputs;
+		QList<QString> statesNames; // Indexed by engine state index
+
+		quint64 stepsPerRun = 1000; // Used in independent mode
+
+		// Last run results
+		quint64 steps     = 0;
+		quint64 conflicts = 0;
+	};
+
+	struct Wire_t
+	{
+		uint sourceInstance;
+		uint sourceOutput;
+		uint targetInstance;
+		uint targetInput;
+	};
+
+	struct Settings_t
+	{
+		SteppingMode_t mode = SteppingMode_t::lockstep;
+		quint64 cycles = 1000; // Used in lockstep mode
+	};
+
+private:
+	// Called by the barrier when all lockstep workers are done with a cycle
+	struct CycleCompletion_t
+	{
+		MultiInstanceSimulator* simulator;
+		void operator()() noexcept;
+	};
+
+	/////
+	// Static variables
+private:
+	// Number of steps between two checks of the stop request
+	static const quint64 pollingInterval = 1024;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit MultiInstanceSimulator() = default;
+	~MultiInstanceSimulator();
+
+	/////
+	// Object functions
+public:
+	// Configuration: not allowed while running
+	bool addInstance(const QString& name, shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm);
+	void removeInstance(uint instance);
+	void setInstanceStepsPerRun(uint instance, quint64 steps);
+
+	bool addWire(const Wire_t& wire);
+	void removeWire(uint wire);
+
+	void reset();
+
+	// Run
+	void start(const Settings_t& settings);
+	void requestStop();
+	void wait();
+	bool isRunning() const;
+
+	quint64 getCompletedSteps() const;
+	quint64 getTotalSteps() const;
+
+	// Results must not be accessed while running
+	uint getInstancesCount() const;
+	const Instance_t& getInstance(uint instance) const;
+	const QList<Wire_t>& getWires() const;
+
+private:
+	void runLockstepWorker(uint instance);
+	void runIndependentWorker(uint instance);
+	void workerDone();
+
+	bool stepInstance(Instance_t& instance);
+	void propagateWires();
+
+	/////
+	// Signals
+signals:
+	// Emitted from a worker thread when all instances are done or stop was requested
+	void runFinishedEvent();
+
+	/////
+	// Object variables
+private:
+	QList<Instance_t> instances;
+	QList<Wire_t>     wires;
+
+	Settings_t settings;
+
+	vector<unique_ptr<QThread>> workers;
+	atomic<bool>    stopRequested  = false;
+	atomic<uint>    runningWorkers = 0;
+	atomic<quint64> completedSteps = 0;
+	quint64         totalSteps     = 0;
+
+	// Lockstep mode
+	unique_ptr<barrier<CycleCompletion_t>> cycleBarrier;
+	quint64 completedCycles = 0; // Only accessed by the barrier completion
+	atomic<bool> lockstepDone = false;
+
+	// Independent mode: last value written by the source of each wire
+	vector<atomic<quint64>> wiresValues;
+	QList<QList<uint>> instancesIncomingWires;
+	QList<QList<uint>> instancesOutgoingWires;
+
+};
+
+#endif // MULTIINSTANCESIMULATOR_H
@@ -0,0 +1,165 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "randomregressionrunner.h"
+
+// Qt classes
+#include <QThread>
+#include <QRandomGenerator>
+
+
+RandomRegressionRunner::RandomRegressionRunner(shared_ptr<const FsmStimulusGenerator> generator, const Settings_t& settings)
+{
+	this->generator = generator;
+	this->settings  = settings;
+
+	this->results.resize(settings.seedsCount);
+	for (uint i = 0 ; i < settings.seedsCount ; i++)
+	{
+		this->results[i].seed = settings.firstSeed + i;
+	}
+}
+
+RandomRegressionRunner::~RandomRegressionRunner()
+{
+	this->requestStop();
+	this->wait();
+}
+
+void RandomRegressionRunner::start()
+{
+	if (this->workers.empty() == false) return;
+
+	if (this->generator == nullptr) return;
+
+	if (this->settings.seedsCount == 0) return;
+
+
+	uint threadsCount = this->settings.threadsCount;
+	if (threadsCount == 0)
+	{
+		threadsCount = qMax(QThread::idealThreadCount(), 1);
+	}
+	threadsCount = qBound((uint)1, threadsCount, this->settings.seedsCount);
+
+	// Make sure results are detached before workers access them
+	this->results.detach();
+
+	this->runningWorkers = threadsCount;
+	for (uint i = 0 ; i < threadsCount ; i++)
+	{
+		this->workers.emplace_back(QThread::create([this]() { this->runWorker(); }));
+		this->workers.back()->start();
+	}
+}
+
+void RandomRegressionRunner::requestStop()
+{
+	this->stopRequested = true;
+}
+
+void RandomRegressionRunner::wait()
+{
+	for (auto& worker : this->workers)
+	{
+		worker->wait();
+	}
+}
+
+uint RandomRegressionRunner::getCompletedSeedsCount() const
+{
+	return this->completedSeeds;
+}
+
+/**
+ * @brief RandomRegressionRunner::getResults must only
+ * be called once run is finished.
+ */
+const QList<RandomRegressionRunner::SeedResult_t>& RandomRegressionRunner::getResults() const
+{
+	return this->results;
+}
+
+void RandomRegressionRunner::runWorker()
+{
+	SeedResult_t* results = this->results.data();
+
+	while (this->stopRequested == false)
+	{
+		uint seedIndex = this->nextSeedIndex++;
+		if (seedIndex >= this->settings.seedsCount) break;
+
+
+		this->runSeed(results[seedIndex]);
+		this->completedSeeds++;
+	}
+
+	// Last worker notifies the end of the run
+	if (--this->runningWorkers == 0)
+	{
+		emit this->runFinishedEvent();
+	}
+}
+
+void RandomRegressionRunner::runSeed(SeedResult_t& result)
+{
+	auto engine = this->generator->getEngine();
+	engine.reset();
+
+	QRandomGenerator randomGenerator(result.seed);
+
+	result.coverage = FsmCoverage(engine);
+
+	if (engine.getActiveState() < 0) return;
+
+
+	result.coverage.recordStep(engine);
+
+	for (quint64 step = 0 ; step < this->settings.stepsPerSeed ; step++)
+	{
+		if ( ((step % RandomRegressionRunner::pollingInterval) == 0) && (this->stopRequested == true) ) return;
+
+
+		if (this->generator->generate(engine, randomGenerator) == false)
+		{
+			result.unsatisfiedConstraints++;
+		}
+
+		if (this->settings.recordTermsCoverage == true)
+		{
+			result.coverage.recordConditions(engine);
+		}
+
+		if (engine.doStep() == FsmSimulationEngine::StepResult_t::transitionConflict)
+		{
+			result.conflicts++;
+
+			auto candidateTransitions = engine.getCandidateTransitions();
+			engine.doStepThroughTransition(candidateTransitions.at(randomGenerator.bounded((int)candidateTransitions.count())));
+		}
+
+		result.coverage.recordStep(engine);
+		result.steps++;
+	}
+
+	result.done = true;
+}
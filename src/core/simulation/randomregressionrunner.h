@@ -0,0 +1,132 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RANDOMREGRESSIONRUNNER_H
+#define RANDOMREGRESSIONRUNNER_H
+
+// Parent
+#include <QObject>
+
+// C++ classes
+#include <memory>
+#include <atomic>
+#include <vector>
+using namespace std;
+
+// Qt classes
+#include <QList>
+class QThread;
+
+// StateS classes
+#include "fsmstimulusgenerator.h"
+#include "fsmcoverage.h"
+
+
+/**
+ * @brief The RandomRegressionRunner class runs many
+ * independent random simulations, one per seed, in
+ * worker threads.
+ *
+ * Each seed is simulated from reset for a given number
+ * of steps, with inputs provided by a stimulus generator.
+ * Conflicting transitions are chosen at random and counted.
+ * Coverage is collected per seed, and can be merged
+ * once the run is finished. Conditions terms coverage
+ * is optional as it is the most costly part of a step.
+ */
+class RandomRegressionRunner : public QObject
+{
+	Q_OBJECT
+
+	/////
+	// Type declarations
+public:
+	struct Settings_t
+	{
+		quint32 firstSeed    = 1;
+		uint    seedsCount   = 1;
+		quint64 stepsPerSeed = 1000;
+		uint    threadsCount = 0; // 0 = one per core
+		// Terms are evaluated by the interpreter before each step,
+		// even when transitions conditions are native
+		bool    recordTermsCoverage = true;
+	};
+
+	struct SeedResult_t
+	{
+		quint32 seed = 0;
+		bool    done = false;
+		quint64 steps                  = 0;
+		quint64 conflicts              = 0;
+		quint64 unsatisfiedConstraints = 0;
+		FsmCoverage coverage;
+	};
+
+	/////
+	// Static variables
+private:
+	// Number of steps between two checks of the stop request
+	static const quint64 pollingInterval = 1024;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit RandomRegressionRunner(shared_ptr<const FsmStimulusGenerator> generator, const Settings_t& settings);
+	~RandomRegressionRunner();
+
+	/////
+	// Object functions
+public:
+	void start();
+	void requestStop();
+	void wait();
+
+	uint getCompletedSeedsCount() const;
+	const QList<SeedResult_t>& getResults() const;
+
+private:
+	void runWorker();
+	void runSeed(SeedResult_t& result);
+
+	/////
+	// Signals
+signals:
+	// Emitted from a worker thread when all seeds are done or stop was requested
+	void runFinishedEvent();
+
+	/////
+	// Object variables
+private:
+	shared_ptr<const FsmStimulusGenerator> generator;
+	Settings_t settings;
+
+	vector<unique_ptr<QThread>> workers;
+	atomic<bool> stopRequested  = false;
+	atomic<uint> nextSeedIndex  = 0;
+	atomic<uint> completedSeeds = 0;
+	atomic<uint> runningWorkers = 0;
+
+	// Each element is only written by the worker handling this seed
+	QList<SeedResult_t> results;
+
+};
+
+#endif // RANDOMREGRESSIONRUNNER_H
@@ -0,0 +1,339 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "simulationbreakpoints.h"
+
+// Qt classes
+#include <QStringList>
+
+// StateS classes
+#include "machinemanager.h"
+#include "simulatedmachine.h"
+#include "fsm.h"
+#include "fsmstate.h"
+#include "fsmtransition.h"
+#include "equation.h"
+#include "simulatedequation.h"
+#include "fsmsimulationengine.h"
+
+
+/**
+ * @brief SimulationBreakpoints::checkCompiled checks breakpoints
+ * compiled using compile() after an engine step.
+ * @return True if a breakpoint was hit.
+ */
+bool SimulationBreakpoints::checkCompiled(Compiled_t& breakpoints, const FsmSimulationEngine& engine)
+{
+	if (breakpoints.isEmpty == true) return false;
+
+
+	bool hit = false;
+
+	// Conditions are always all evaluated to keep track of edges
+	for (int i = 0 ; i < breakpoints.conditions.count() ; i++)
+	{
+		bool value = engine.isTrue(breakpoints.conditions.at(i));
+		if ( (value == true) && (breakpoints.conditionsPreviousValues.at(i) == false) )
+		{
+			hit = true;
+		}
+		breakpoints.conditionsPreviousValues[i] = value;
+	}
+
+	int crossedTransition = engine.getLastCrossedTransition();
+	if (crossedTransition >= 0)
+	{
+		if (breakpoints.transitionsCrossed.at(crossedTransition) == true)
+		{
+			hit = true;
+		}
+		if (breakpoints.statesEntry.at(engine.getActiveState()) == true)
+		{
+			hit = true;
+		}
+	}
+
+	return hit;
+}
+
+void SimulationBreakpoints::setStateBreakpoint(componentId_t stateId, bool enabled)
+{
+	if (enabled == true)
+	{
+		this->statesBreakpoints.insert(stateId);
+	}
+	else
+	{
+		this->statesBreakpoints.remove(stateId);
+	}
+
+	emit this->breakpointsChangedEvent();
+}
+
+bool SimulationBreakpoints::hasStateBreakpoint(componentId_t stateId) const
+{
+	return this->statesBreakpoints.contains(stateId);
+}
+
+uint SimulationBreakpoints::getStateBreakpointsCount() const
+{
+	return this->statesBreakpoints.count();
+}
+
+void SimulationBreakpoints::setTransitionBreakpoint(componentId_t transitionId, bool enabled)
+{
+	if (enabled == true)
+	{
+		this->transitionsBreakpoints.insert(transitionId);
+	}
+	else
+	{
+		this->transitionsBreakpoints.remove(transitionId);
+	}
+
+	emit this->breakpointsChangedEvent();
+}
+
+bool SimulationBreakpoints::hasTransitionBreakpoint(componentId_t transitionId) const
+{
+	return this->transitionsBreakpoints.contains(transitionId);
+}
+
+uint SimulationBreakpoints::getTransitionBreakpointsCount() const
+{
+	return this->transitionsBreakpoints.count();
+}
+
+/**
+ * @brief SimulationBreakpoints::addCondition adds a watched
+ * condition. By default, simulation breaks when the condition
+ * becomes true. Must be called while in simulation mode.
+ */
+void SimulationBreakpoints::addCondition(shared_ptr<Equation> equation)
+{
+	if (equation == nullptr) return;
+
+
+	Condition_t condition;
+	condition.equation          = equation;
+	condition.simulatedEquation = make_shared<SimulatedEquation>(equation);
+	condition.previousValue     = condition.simulatedEquation->isTrue();
+
+	connect(condition.simulatedEquation.get(), &SimulatedEquation::equationCurrentValueChangedEvent, this, &SimulationBreakpoints::conditionsValuesChangedEvent);
+
+	auto simulatedMachine = machineManager->getSimulatedMachine();
+	if (simulatedMachine != nullptr)
+	{
+		simulatedMachine->registerEquation(condition.simulatedEquation);
+	}
+
+	this->conditions.append(condition);
+
+	emit this->breakpointsChangedEvent();
+}
+
+void SimulationBreakpoints::removeCondition(uint rank)
+{
+	if (rank >= (uint)this->conditions.count()) return;
+
+
+	this->conditions.removeAt(rank);
+
+	emit this->breakpointsChangedEvent();
+}
+
+void SimulationBreakpoints::setConditionBreakWhenTrue(uint rank, bool breakWhenTrue)
+{
+	if (rank >= (uint)this->conditions.count()) return;
+
+
+	this->conditions[rank].breakWhenTrue = breakWhenTrue;
+
+	emit this->breakpointsChangedEvent();
+}
+
+uint SimulationBreakpoints::getConditionsCount() const
+{
+	return this->conditions.count();
+}
+
+shared_ptr<Equation> SimulationBreakpoints::getCondition(uint rank) const
+{
+	if (rank >= (uint)this->conditions.count()) return nullptr;
+
+
+	return this->conditions.at(rank).equation;
+}
+
+bool SimulationBreakpoints::getConditionBreakWhenTrue(uint rank) const
+{
+	if (rank >= (uint)this->conditions.count()) return false;
+
+
+	return this->conditions.at(rank).breakWhenTrue;
+}
+
+LogicValue SimulationBreakpoints::getConditionCurrentValue(uint rank) const
+{
+	if (rank >= (uint)this->conditions.count()) return LogicValue::getNullValue();
+
+
+	return this->conditions.at(rank).simulatedEquation->getCurrentValue();
+}
+
+void SimulationBreakpoints::clear()
+{
+	this->statesBreakpoints.clear();
+	this->transitionsBreakpoints.clear();
+	this->conditions.clear();
+
+	emit this->breakpointsChangedEvent();
+}
+
+/**
+ * @brief SimulationBreakpoints::resynchronize must be called
+ * when simulation state changed without doing a step (e.g. on
+ * reset), so that conditions edges are detected from the new state.
+ */
+void SimulationBreakpoints::resynchronize()
+{
+	for (auto& condition : this->conditions)
+	{
+		condition.previousValue = condition.simulatedEquation->isTrue();
+	}
+}
+
+/**
+ * @brief SimulationBreakpoints::check checks breakpoints
+ * after an interactive simulation step.
+ * @param crossedTransitionId Transition crossed during the step, or nullId.
+ * @param activeStateId State active after the step.
+ * @param hitDescription Filled with a text describing the breakpoint hit.
+ * @return True if a breakpoint was hit.
+ */
+bool SimulationBreakpoints::check(componentId_t crossedTransitionId, componentId_t activeStateId, QString& hitDescription)
+{
+	QStringList hits;
+
+	// Conditions are always all evaluated to keep track of edges
+	for (auto& condition : this->conditions)
+	{
+		bool value = condition.simulatedEquation->isTrue();
+		if ( (value == true) && (condition.previousValue == false) && (condition.breakWhenTrue == true) )
+		{
+			hits.append(tr("Condition") + " " + condition.equation->getText() + " " + tr("became true"));
+		}
+		condition.previousValue = value;
+	}
+
+	if (crossedTransitionId != nullId)
+	{
+		auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+
+		if (this->transitionsBreakpoints.contains(crossedTransitionId) == true)
+		{
+			QString transitionText = tr("Transition");
+			if (fsm != nullptr)
+			{
+				auto transition = fsm->getTransition(crossedTransitionId);
+				if (transition != nullptr)
+				{
+					auto sourceState = fsm->getState(transition->getSourceStateId());
+					auto targetState = fsm->getState(transition->getTargetStateId());
+					if ( (sourceState != nullptr) && (targetState != nullptr) )
+					{
+						transitionText += " " + sourceState->getName() + " → " + targetState->getName();
+					}
+				}
+			}
+			hits.append(transitionText + " " + tr("crossed"));
+		}
+
+		if (this->statesBreakpoints.contains(activeStateId) == true)
+		{
+			QString stateText = tr("State");
+			if (fsm != nullptr)
+			{
+				auto state = fsm->getState(activeStateId);
+				if (state != nullptr)
+				{
+					stateText += " " + state->getName();
+				}
+			}
+			hits.append(stateText + " " + tr("entered"));
+		}
+	}
+
+	if (hits.isEmpty() == true) return false;
+
+
+	hitDescription = hits.join("<br />");
+	return true;
+}
+
+/**
+ * @brief SimulationBreakpoints::compile builds the breakpoints
+ * representation used by fast simulation. Conditions are compiled
+ * as engine programs, thus engine must be copied after this call.
+ */
+SimulationBreakpoints::Compiled_t SimulationBreakpoints::compile(FsmSimulationEngine& engine) const
+{
+	Compiled_t breakpoints;
+
+	breakpoints.statesEntry.fill(false, engine.getStatesCount());
+	for (const auto& stateId : this->statesBreakpoints)
+	{
+		int state = engine.getStateIndex(stateId);
+		if (state < 0) continue;
+
+
+		breakpoints.statesEntry[state] = true;
+		breakpoints.isEmpty = false;
+	}
+
+	breakpoints.transitionsCrossed.fill(false, engine.getTransitionsCount());
+	for (const auto& transitionId : this->transitionsBreakpoints)
+	{
+		int transition = engine.getTransitionIndex(transitionId);
+		if (transition < 0) continue;
+
+
+		breakpoints.transitionsCrossed[transition] = true;
+		breakpoints.isEmpty = false;
+	}
+
+	for (const auto& condition : this->conditions)
+	{
+		if (condition.breakWhenTrue == false) continue;
+
+
+		int program = engine.compileEquation(condition.equation);
+		if (program < 0) continue;
+
+
+		breakpoints.conditions.append(program);
+		breakpoints.conditionsPreviousValues.append(engine.isTrue(program));
+		breakpoints.isEmpty = false;
+	}
+
+	return breakpoints;
+}
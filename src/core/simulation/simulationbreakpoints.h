@@ -0,0 +1,133 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SIMULATIONBREAKPOINTS_H
+#define SIMULATIONBREAKPOINTS_H
+
+// Parent
+#include <QObject>
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QList>
+#include <QSet>
+
+// StateS classes
+#include "statestypes.h"
+#include "logicvalue.h"
+class Equation;
+class SimulatedEquation;
+class FsmSimulationEngine;
+
+
+/**
+ * @brief The SimulationBreakpoints class stores the breakpoints
+ * and watched conditions of a simulation.
+ *
+ * Breakpoints can be set on a state entry, on a transition
+ * being crossed, or on a condition becoming true. Conditions
+ * which do not break are only watched.
+ *
+ * In interactive simulation, conditions are kept up to date by
+ * simulated equations, thus checking breakpoints after a step
+ * only costs a few lookups. For fast simulation, breakpoints
+ * are compiled once against the engine before running.
+ */
+class SimulationBreakpoints : public QObject
+{
+	Q_OBJECT
+
+	/////
+	// Type declarations
+public:
+	struct Compiled_t
+	{
+		bool isEmpty = true;
+		QList<bool> statesEntry;        // By engine state index
+		QList<bool> transitionsCrossed; // By engine transition index
+		QList<int>  conditions;         // Engine programs
+		QList<bool> conditionsPreviousValues;
+	};
+
+private:
+	struct Condition_t
+	{
+		shared_ptr<Equation> equation;
+		shared_ptr<SimulatedEquation> simulatedEquation;
+		bool breakWhenTrue = true;
+		bool previousValue = false;
+	};
+
+	/////
+	// Static functions
+public:
+	static bool checkCompiled(Compiled_t& breakpoints, const FsmSimulationEngine& engine);
+
+	/////
+	// Constructors/destructors
+public:
+	explicit SimulationBreakpoints() = default;
+
+	/////
+	// Object functions
+public:
+	void setStateBreakpoint(componentId_t stateId, bool enabled);
+	bool hasStateBreakpoint(componentId_t stateId) const;
+	uint getStateBreakpointsCount() const;
+
+	void setTransitionBreakpoint(componentId_t transitionId, bool enabled);
+	bool hasTransitionBreakpoint(componentId_t transitionId) const;
+	uint getTransitionBreakpointsCount() const;
+
+	void addCondition(shared_ptr<Equation> equation);
+	void removeCondition(uint rank);
+	void setConditionBreakWhenTrue(uint rank, bool breakWhenTrue);
+	uint getConditionsCount() const;
+	shared_ptr<Equation> getCondition(uint rank) const;
+	bool getConditionBreakWhenTrue(uint rank) const;
+	LogicValue getConditionCurrentValue(uint rank) const;
+
+	void clear();
+
+	void resynchronize();
+	bool check(componentId_t crossedTransitionId, componentId_t activeStateId, QString& hitDescription);
+
+	Compiled_t compile(FsmSimulationEngine& engine) const;
+
+	/////
+	// Signals
+signals:
+	void breakpointsChangedEvent();
+	void conditionsValuesChangedEvent();
+
+	/////
+	// Object variables
+private:
+	QSet<componentId_t> statesBreakpoints;
+	QSet<componentId_t> transitionsBreakpoints;
+	QList<Condition_t> conditions;
+
+};
+
+#endif // SIMULATIONBREAKPOINTS_H
@@ -0,0 +1,401 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "simulationhistory.h"
+
+// C++ classes
+#include <iterator>
+
+// StateS classes
+#include "fsm.h"
+#include "simulatedfsm.h"
+#include "simulatedvariable.h"
+
+
+/**
+ * @brief SimulationHistory::initialize clears the history and
+ * records the current simulation state as step 0.
+ */
+void SimulationHistory::initialize(shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm)
+{
+	this->available    = false;
+	this->currentCycle = 0;
+	this->lastCycle    = 0;
+	this->checkpoints.clear();
+	this->inputsRecords.clear();
+	this->forcedTransitions.clear();
+	this->discontinuities.clear();
+	this->inputsIds.clear();
+	this->inputs.clear();
+	this->outputsIds.clear();
+	this->outputs.clear();
+
+	if ( (fsm == nullptr) || (simulatedFsm == nullptr) ) return;
+
+
+	this->engine = FsmSimulationEngine(fsm, simulatedFsm);
+	if (this->engine.isSupported() == false) return;
+
+
+	for (const auto& inputId : fsm->getInputVariablesIds())
+	{
+		int input = this->engine.getVariableIndex(inputId);
+		if (input < 0) continue;
+
+
+		this->inputsIds.append(inputId);
+		this->inputs.append(input);
+	}
+
+	for (const auto& outputId : fsm->getOutputVariablesIds())
+	{
+		int output = this->engine.getVariableIndex(outputId);
+		if (output < 0) continue;
+
+
+		this->outputsIds.append(outputId);
+		this->outputs.append(output);
+	}
+
+	this->available = true;
+
+	this->recordCheckpoint(simulatedFsm);
+}
+
+bool SimulationHistory::isAvailable() const
+{
+	return this->available;
+}
+
+quint64 SimulationHistory::getCurrentCycle() const
+{
+	return this->currentCycle;
+}
+
+quint64 SimulationHistory::getLastCycle() const
+{
+	return this->lastCycle;
+}
+
+/**
+ * @brief SimulationHistory::recordStep must be called before
+ * an interactive step is done, once the transition to cross is known.
+ * @param forcedTransitionId Transition chosen by user if multiple
+ * transitions were crossable, nullId otherwise.
+ */
+void SimulationHistory::recordStep(shared_ptr<const SimulatedFsm> simulatedFsm, componentId_t forcedTransitionId)
+{
+	if (this->available == false) return;
+
+
+	this->truncate();
+	this->recordInputs(simulatedFsm);
+
+	if (forcedTransitionId != nullId)
+	{
+		this->forcedTransitions[this->currentCycle] = this->engine.getTransitionIndex(forcedTransitionId);
+	}
+}
+
+/**
+ * @brief SimulationHistory::stepDone must be called after
+ * an interactive step is done.
+ */
+void SimulationHistory::stepDone(shared_ptr<const SimulatedFsm> simulatedFsm)
+{
+	if (this->available == false) return;
+
+
+	this->currentCycle++;
+	this->lastCycle = this->currentCycle;
+
+	if ((this->currentCycle % SimulationHistory::checkpointInterval) == 0)
+	{
+		this->recordCheckpoint(simulatedFsm);
+	}
+}
+
+/**
+ * @brief SimulationHistory::recordDiscontinuity must be called
+ * when simulation state is changed outside of a step, e.g. when
+ * user forces a state activation. As this can't be replayed,
+ * a checkpoint is recorded for current step.
+ */
+void SimulationHistory::recordDiscontinuity(shared_ptr<const SimulatedFsm> simulatedFsm)
+{
+	if (this->available == false) return;
+
+
+	this->truncate();
+	this->recordCheckpoint(simulatedFsm);
+
+	if ( (this->discontinuities.isEmpty() == true) || (this->discontinuities.last() != this->currentCycle) )
+	{
+		this->discontinuities.append(this->currentCycle);
+	}
+}
+
+/**
+ * @brief SimulationHistory::beginFastSimulation must be called
+ * before a fast simulation is started. Inputs do not change
+ * during fast simulation.
+ */
+void SimulationHistory::beginFastSimulation(shared_ptr<const SimulatedFsm> simulatedFsm)
+{
+	if (this->available == false) return;
+
+
+	this->truncate();
+	this->recordInputs(simulatedFsm);
+}
+
+/**
+ * @brief SimulationHistory::endFastSimulation must be called
+ * once the result of a fast simulation has been applied.
+ * @param cycles Number of steps done by fast simulation.
+ * @param checkpoints Checkpoints recorded during fast simulation.
+ */
+void SimulationHistory::endFastSimulation(shared_ptr<const SimulatedFsm> simulatedFsm, quint64 cycles, const QMap<quint64, FsmSimulationEngine::Snapshot_t>& checkpoints)
+{
+	if (this->available == false) return;
+
+
+	this->checkpoints.insert(checkpoints);
+
+	this->currentCycle += cycles;
+	this->lastCycle = this->currentCycle;
+
+	this->recordCheckpoint(simulatedFsm);
+}
+
+/**
+ * @brief SimulationHistory::computeSnapshot obtains simulation
+ * state at a given step by replaying from the nearest checkpoint.
+ * @return False if step is not in history.
+ */
+bool SimulationHistory::computeSnapshot(quint64 cycle, FsmSimulationEngine::Snapshot_t& snapshot)
+{
+	if (this->available == false) return false;
+
+	if (cycle > this->lastCycle) return false;
+
+	auto checkpoint = this->checkpoints.upperBound(cycle);
+	if (checkpoint == this->checkpoints.begin()) return false;
+
+
+	checkpoint--;
+	this->engine.restoreSnapshot(checkpoint.value());
+
+	quint64 currentCycle = checkpoint.key();
+	auto nextInputsRecord = this->inputsRecords.upperBound(currentCycle);
+	if (nextInputsRecord != this->inputsRecords.begin())
+	{
+		this->applyInputs(std::prev(nextInputsRecord).value());
+	}
+
+	while (currentCycle < cycle)
+	{
+		while ( (nextInputsRecord != this->inputsRecords.end()) && (nextInputsRecord.key() <= currentCycle) )
+		{
+			this->applyInputs(nextInputsRecord.value());
+			nextInputsRecord++;
+		}
+
+		auto forcedTransition = this->forcedTransitions.constFind(currentCycle);
+		if (forcedTransition != this->forcedTransitions.constEnd())
+		{
+			this->engine.doStepThroughTransition(forcedTransition.value());
+		}
+		else if (this->engine.doStep() != FsmSimulationEngine::StepResult_t::stepped)
+		{
+			return false;
+		}
+
+		currentCycle++;
+	}
+
+	snapshot = this->engine.getSnapshot();
+	return true;
+}
+
+/**
+ * @brief SimulationHistory::goToCycle restores simulation
+ * state at a given step in the simulated FSM.
+ * @return False if step is not in history.
+ */
+bool SimulationHistory::goToCycle(quint64 cycle, shared_ptr<SimulatedFsm> simulatedFsm)
+{
+	if (simulatedFsm == nullptr) return false;
+
+
+	FsmSimulationEngine::Snapshot_t snapshot;
+	if (this->computeSnapshot(cycle, snapshot) == false) return false;
+
+
+	this->engine.restoreSnapshot(snapshot);
+	this->engine.applyToSimulatedFsm(simulatedFsm);
+
+	this->currentCycle = cycle;
+
+	return true;
+}
+
+/**
+ * @brief SimulationHistory::extractTrace replays history from step 0
+ * to obtain the inputs and outputs of each step. The trace stops before
+ * the first discontinuity, and before the first conflict resolved by user
+ * with another transition than the first candidate, as the machine alone
+ * can not reproduce these.
+ * @return False if simulation did not start from reset.
+ */
+bool SimulationHistory::extractTrace(Trace_t& trace)
+{
+	if (this->available == false) return false;
+
+	if ( (this->discontinuities.isEmpty() == false) && (this->discontinuities.first() == 0) ) return false;
+
+	auto checkpoint = this->checkpoints.constFind(0);
+	if (checkpoint == this->checkpoints.constEnd()) return false;
+
+
+	quint64 lastTraceCycle = this->lastCycle;
+	if (this->discontinuities.isEmpty() == false)
+	{
+		lastTraceCycle = qMin(lastTraceCycle, this->discontinuities.first());
+	}
+
+	trace = Trace_t();
+	trace.inputsIds  = this->inputsIds;
+	trace.outputsIds = this->outputsIds;
+
+	this->engine.restoreSnapshot(checkpoint.value());
+	trace.initialOutputs = this->getValues(this->outputs);
+
+	auto nextInputsRecord = this->inputsRecords.constBegin();
+	for (quint64 cycle = 0 ; cycle < lastTraceCycle ; cycle++)
+	{
+		while ( (nextInputsRecord != this->inputsRecords.constEnd()) && (nextInputsRecord.key() <= cycle) )
+		{
+			this->applyInputs(nextInputsRecord.value());
+			nextInputsRecord++;
+		}
+
+		auto stepInputs = this->getValues(this->inputs);
+
+		auto forcedTransition = this->forcedTransitions.constFind(cycle);
+		if (forcedTransition != this->forcedTransitions.constEnd())
+		{
+			auto candidateTransitions = this->engine.getCandidateTransitions();
+			if (candidateTransitions.isEmpty() == true) break;
+
+			if ((int)candidateTransitions.first() != forcedTransition.value()) break;
+
+
+			this->engine.doStepThroughTransition(forcedTransition.value());
+		}
+		else if (this->engine.doStep() != FsmSimulationEngine::StepResult_t::stepped)
+		{
+			break;
+		}
+
+		trace.stepsInputs.append(stepInputs);
+		trace.stepsOutputs.append(this->getValues(this->outputs));
+	}
+
+	return true;
+}
+
+/**
+ * @brief SimulationHistory::truncate discards history
+ * after current step when simulation diverges from it.
+ */
+void SimulationHistory::truncate()
+{
+	if (this->currentCycle == this->lastCycle) return;
+
+
+	this->checkpoints.erase(this->checkpoints.upperBound(this->currentCycle), this->checkpoints.end());
+	this->inputsRecords.erase(this->inputsRecords.upperBound(this->currentCycle), this->inputsRecords.end());
+	this->forcedTransitions.erase(this->forcedTransitions.lowerBound(this->currentCycle), this->forcedTransitions.end());
+
+	while ( (this->discontinuities.isEmpty() == false) && (this->discontinuities.last() > this->currentCycle) )
+	{
+		this->discontinuities.removeLast();
+	}
+
+	this->lastCycle = this->currentCycle;
+}
+
+void SimulationHistory::recordInputs(shared_ptr<const SimulatedFsm> simulatedFsm)
+{
+	if (simulatedFsm == nullptr) return;
+
+
+	QList<quint64> inputsValues;
+	for (const auto& inputId : this->inputsIds)
+	{
+		quint64 value = 0;
+
+		auto simulatedVariable = simulatedFsm->getSimulatedVariable(inputId);
+		if (simulatedVariable != nullptr)
+		{
+			value = FsmSimulationEngine::packValue(simulatedVariable->getCurrentValue());
+		}
+
+		inputsValues.append(value);
+	}
+
+	// Only record changes
+	auto nextInputsRecord = this->inputsRecords.upperBound(this->currentCycle);
+	if (nextInputsRecord != this->inputsRecords.begin())
+	{
+		if (std::prev(nextInputsRecord).value() == inputsValues) return;
+	}
+
+
+	this->inputsRecords[this->currentCycle] = inputsValues;
+}
+
+void SimulationHistory::applyInputs(const QList<quint64>& inputsValues)
+{
+	for (int i = 0 ; (i < this->inputs.count()) && (i < inputsValues.count()) ; i++)
+	{
+		this->engine.setVariableValue(this->inputs.at(i), inputsValues.at(i));
+	}
+}
+
+QList<quint64> SimulationHistory::getValues(const QList<uint>& variables) const
+{
+	QList<quint64> values;
+	for (auto variable : variables)
+	{
+		values.append(this->engine.getVariableValue(variable));
+	}
+
+	return values;
+}
+
+void SimulationHistory::recordCheckpoint(shared_ptr<const SimulatedFsm> simulatedFsm)
+{
+	this->engine.loadFromSimulatedFsm(simulatedFsm);
+	this->checkpoints[this->currentCycle] = this->engine.getSnapshot();
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SIMULATIONHISTORY_H
+#define SIMULATIONHISTORY_H
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QList>
+#include <QMap>
+
+// StateS classes
+#include "statestypes.h"
+#include "fsmsimulationengine.h"
+class Fsm;
+class SimulatedFsm;
+
+
+/**
+ * @brief The SimulationHistory class records the simulation
+ * history to allow going back to any previous step.
+ *
+ * Full simulation snapshots (checkpoints) are stored periodically.
+ * Between checkpoints, only what can not be deduced from the machine
+ * is recorded: inputs values when they change, and the transitions
+ * chosen by user on conflicts. Any step can thus be obtained by
+ * restoring the nearest previous checkpoint and replaying forward
+ * with the simulation engine.
+ *
+ * Going back then stepping forward discards the previous future.
+ */
+class SimulationHistory
+{
+
+	/////
+	// Type declarations
+public:
+	// Inputs and outputs packed values of a simulation
+	// run which can be reproduced starting from reset.
+	struct Trace_t
+	{
+		QList<componentId_t> inputsIds;
+		QList<componentId_t> outputsIds;
+		QList<quint64> initialOutputs;
+		QList<QList<quint64>> stepsInputs;  // Inputs used by each step
+		QList<QList<quint64>> stepsOutputs; // Outputs after each step
+	};
+
+	/////
+	// Static variables
+public:
+	// Steps between two checkpoints in interactive simulation
+	static const quint64 checkpointInterval = 256;
+	// Steps between two checkpoints in fast simulation
+	static const quint64 fastCheckpointInterval = 65536;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit SimulationHistory() = default;
+
+	/////
+	// Object functions
+public:
+	void initialize(shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm);
+	bool isAvailable() const;
+
+	quint64 getCurrentCycle() const;
+	quint64 getLastCycle()    const;
+
+	// Interactive simulation recording
+	void recordStep(shared_ptr<const SimulatedFsm> simulatedFsm, componentId_t forcedTransitionId);
+	void stepDone(shared_ptr<const SimulatedFsm> simulatedFsm);
+	void recordDiscontinuity(shared_ptr<const SimulatedFsm> simulatedFsm);
+
+	// Fast simulation recording
+	void beginFastSimulation(shared_ptr<const SimulatedFsm> simulatedFsm);
+	void endFastSimulation(shared_ptr<const SimulatedFsm> simulatedFsm, quint64 cycles, const QMap<quint64, FsmSimulationEngine::Snapshot_t>& checkpoints);
+
+	// Rewind
+	bool computeSnapshot(quint64 cycle, FsmSimulationEngine::Snapshot_t& snapshot);
+	bool goToCycle(quint64 cycle, shared_ptr<SimulatedFsm> simulatedFsm);
+
+	// Export
+	bool extractTrace(Trace_t& trace);
+
+private:
+	void truncate();
+	void recordInputs(shared_ptr<const SimulatedFsm> simulatedFsm);
+	void applyInputs(const QList<quint64>& inputsValues);
+	QList<quint64> getValues(const QList<uint>& variables) const;
+	void recordCheckpoint(shared_ptr<const SimulatedFsm> simulatedFsm);
+
+	/////
+	// Object variables
+private:
+	bool available = false;
+
+	// Used to pack simulation state and to replay
+	FsmSimulationEngine engine;
+	QList<componentId_t> inputsIds;
+	QList<uint> inputs;
+	QList<componentId_t> outputsIds;
+	QList<uint> outputs;
+
+	quint64 currentCycle = 0;
+	quint64 lastCycle    = 0;
+
+	QMap<quint64, FsmSimulationEngine::Snapshot_t> checkpoints;
+	// Inputs values used for steps starting from key cycle
+	QMap<quint64, QList<quint64>> inputsRecords;
+	// Transitions chosen by user when multiple were crossable
+	QMap<quint64, int> forcedTransitions;
+	// Cycles at which simulation state was changed outside of a step
+	QList<quint64> discontinuities;
+
+};
+
+#endif // SIMULATIONHISTORY_H
@@ -0,0 +1,99 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "statespaceexplorationrunner.h"
+
+// Qt classes
+#include <QThread>
+
+// StateS classes
+#include "fsmstatespaceexplorer.h"
+
+
+StateSpaceExplorationRunner::StateSpaceExplorationRunner(shared_ptr<FsmStateSpaceExplorer> explorer, function<void()> followUpTask)
+{
+	this->explorer     = explorer;
+	this->followUpTask = followUpTask;
+}
+
+StateSpaceExplorationRunner::~StateSpaceExplorationRunner()
+{
+	this->requestStop();
+	this->wait();
+}
+
+void StateSpaceExplorationRunner::start()
+{
+	if (this->thread != nullptr) return;
+
+	if (this->explorer == nullptr) return;
+
+
+	this->thread.reset(QThread::create([this]() { this->run(); }));
+	connect(this->thread.get(), &QThread::finished, this, &StateSpaceExplorationRunner::runFinishedEvent);
+	this->thread->start();
+}
+
+void StateSpaceExplorationRunner::requestStop()
+{
+	if (this->explorer == nullptr) return;
+
+
+	this->explorer->requestStop();
+}
+
+void StateSpaceExplorationRunner::wait()
+{
+	if (this->thread == nullptr) return;
+
+
+	this->thread->wait();
+}
+
+bool StateSpaceExplorationRunner::isFinished() const
+{
+	if (this->thread == nullptr) return false;
+
+
+	return this->thread->isFinished();
+}
+
+void StateSpaceExplorationRunner::run()
+{
+	this->progressTimer.start();
+	this->explorer->setProgressCallback([this](uint configurationsCount, uint depth)
+	{
+		if (this->progressTimer.elapsed() < StateSpaceExplorationRunner::progressPeriod) return;
+
+
+		this->progressTimer.restart();
+		emit this->progressEvent(configurationsCount, depth);
+	});
+
+	auto status = this->explorer->explore();
+	this->explorer->setProgressCallback(nullptr);
+
+	if ( (status != ExplorationStatus_t::stopped) && (this->followUpTask != nullptr) )
+	{
+		this->followUpTask();
+	}
+}
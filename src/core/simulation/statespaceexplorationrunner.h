@@ -0,0 +1,97 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STATESPACEEXPLORATIONRUNNER_H
+#define STATESPACEEXPLORATIONRUNNER_H
+
+// Parent
+#include <QObject>
+
+// C++ classes
+#include <memory>
+#include <functional>
+using namespace std;
+
+// Qt classes
+#include <QElapsedTimer>
+class QThread;
+
+// StateS classes
+class FsmStateSpaceExplorer;
+
+
+/**
+ * @brief The StateSpaceExplorationRunner class runs the
+ * exploration of a FsmStateSpaceExplorer in a worker thread,
+ * so that the GUI stays responsive on large machines.
+ *
+ * A follow-up task using the exploration result can be
+ * run in the same thread, unless exploration was stopped.
+ */
+class StateSpaceExplorationRunner : public QObject
+{
+	Q_OBJECT
+
+	/////
+	// Static variables
+private:
+	// Minimum time between two progress events, in ms
+	static const qint64 progressPeriod = 100;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit StateSpaceExplorationRunner(shared_ptr<FsmStateSpaceExplorer> explorer, function<void()> followUpTask = nullptr);
+	~StateSpaceExplorationRunner();
+
+	/////
+	// Object functions
+public:
+	void start();
+	void requestStop();
+	void wait();
+
+	bool isFinished() const;
+
+private:
+	void run();
+
+	/////
+	// Signals
+signals:
+	// Emitted from the worker thread
+	void progressEvent(uint configurationsCount, uint depth);
+	// Emitted when the worker thread is finished
+	void runFinishedEvent();
+
+	/////
+	// Object variables
+private:
+	// Owned by worker thread while running
+	shared_ptr<FsmStateSpaceExplorer> explorer;
+	function<void()> followUpTask;
+	QElapsedTimer progressTimer;
+
+	unique_ptr<QThread> thread;
+
+};
+
+#endif // STATESPACEEXPLORATIONRUNNER_H
@@ -52,6 +52,12 @@ enum class MouseCursor_t                 { none, state, transition };
 enum class MachineBuilderTool_t          { none, initialState, state, transition };
 enum class MachineBuilderSingleUseTool_t { none, drawTransitionFromScene, editTransitionSource, editTransitionTarget };
 enum class SimulationBehavior_t          { prepare, immediately, after };
+enum class FastSimulationStopReason_t    { userRequest, cycleCountReached, stateReached, variableValueReached, breakpointHit, transitionConflict, unsupportedMachine, noActiveState };
+enum class ExplorationStatus_t           { complete, configurationsLimitReached, stopped, tooManyInputs, unsupportedMachine };
+enum class PropertyCheckStatus_t         { holds, holdsOnExploredPart, violated, unsupportedProperty, explorationFailed };
+enum class CodeLanguage_t                { vhdl, systemVerilog, cpp };
+enum class HdlStateEncoding_t            { symbolic, binary, gray, oneHot, johnson };
+enum class HdlOptimizationGoal_t         { timing, area };
 
 enum class OperandSource_t
 {
@@ -0,0 +1,862 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmcppexport.h"
+
+// Qt classes
+#include <QDate>
+#include <QFile>
+#include <QTextStream>
+
+// StateS classes
+#include "states.h"
+#include "machinemanager.h"
+#include "fsm.h"
+#include "fsmstate.h"
+#include "fsmtransition.h"
+#include "machineactuatorcomponent.h"
+#include "variable.h"
+#include "equation.h"
+#include "actiononvariable.h"
+#include "operand.h"
+#include "fsmsimulationengine.h"
+
+
+void FsmCppExport::setOptions(bool prefixSignals, bool registerMealyOutputs)
+{
+	this->prefixSignals        = prefixSignals;
+	this->registerMealyOutputs = registerMealyOutputs;
+}
+
+bool FsmCppExport::writeToFile(const QString& path)
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return false;
+
+	if (this->isSupported() == false) return false;
+
+
+	this->buildModel();
+	this->buildActionsTable();
+
+	QFile* file = new QFile(path);
+	if (file->open(QIODevice::WriteOnly) == false)
+	{
+		delete file;
+		return false;
+	}
+
+	QTextStream stream(file);
+
+	QString guard = this->model.getMachineName().toUpper() + "_FSM_H";
+
+	this->writeHeader(stream);
+
+	stream << "#ifndef " << guard << "\n";
+	stream << "#define " << guard << "\n\n";
+	stream << "#include <cstdint>\n\n\n";
+	stream << "namespace " << this->model.getMachineName() << "\n";
+	stream << "{\n\n";
+
+	this->writeTypes(stream);
+	this->writeVariables(stream);
+	this->writeTables(stream);
+	this->writeConditions(stream);
+	this->writeFunctions(stream);
+
+	stream << "} // namespace " << this->model.getMachineName() << "\n\n";
+	stream << "#endif // " << guard << "\n";
+
+	file->close();
+	delete file;
+
+	return true;
+}
+
+/**
+ * @brief FsmCppExport::isSupported checks that all values handled
+ * by the machine, including intermediate results of conditions,
+ * fit in a 64-bit word, and that components can be indexed by the
+ * integer types of the generated tables.
+ */
+bool FsmCppExport::isSupported() const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return false;
+
+
+	// Loops on variables use an uint8_t index compared to VARIABLES_COUNT
+	// (constants are not stored in values array)
+	if ( (fsm->getInputVariablesIds() + fsm->getWrittableVariablesIds()).count() > FsmCppExport::maxVariablesCount) return false;
+
+	if (fsm->getAllStatesIds().count()      > FsmCppExport::maxTableEntriesCount) return false;
+
+	if (fsm->getAllTransitionsIds().count() > FsmCppExport::maxTableEntriesCount) return false;
+
+
+	uint actionsCount = 0;
+	for (auto& actuatorId : fsm->getAllStatesIds() + fsm->getAllTransitionsIds())
+	{
+		auto actuator = dynamic_pointer_cast<MachineActuatorComponent>(fsm->getComponent(actuatorId));
+		if (actuator == nullptr) continue;
+
+
+		actionsCount += actuator->getActions().count();
+	}
+
+	if (actionsCount > FsmCppExport::maxTableEntriesCount) return false;
+
+
+	for (auto& variableId : fsm->getAllVariablesIds())
+	{
+		auto variable = fsm->getVariable(variableId);
+		if (variable == nullptr) continue;
+
+
+		if (variable->getSize() > 64) return false;
+	}
+
+	for (auto& transitionId : fsm->getAllTransitionsIds())
+	{
+		auto transition = fsm->getTransition(transitionId);
+
+		if (this->getEquationMaxSize(transition->getCondition()) > 64) return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief FsmCppExport::buildModel names the machine components with
+ * the identifiers of the generated code and common C++ keywords reserved,
+ * and orders variables, states and transitions in the generated tables.
+ */
+void FsmCppExport::buildModel()
+{
+	QSet<QString> reservedNames =
+	{
+		"Word", "State", "VariableIndex", "ActionType", "Action", "ActionList", "StateEntry", "TransitionEntry", "Machine",
+		"STATES_COUNT", "TRANSITIONS_COUNT", "VARIABLES_COUNT", "TEMPORARY_VARIABLES_COUNT", "INITIAL_STATE", "INITIAL_VALUES",
+		"TEMPORARY_VARIABLES", "ACTIONS", "STATES", "TRANSITIONS",
+		"isConditionTrue", "applyActions", "findCrossableTransition", "updateOutputs", "reset", "step", "v",
+		"auto", "bool", "break", "case", "char", "class", "const", "default", "delete", "do", "else", "enum", "false", "for",
+		"if", "int", "long", "namespace", "new", "return", "short", "signed", "static", "struct", "switch", "this", "true",
+		"unsigned", "void", "while"
+	};
+
+	this->model.build(this->prefixSignals, HdlStateEncoding_t::symbolic, this->registerMealyOutputs, reservedNames);
+
+	this->variablesIds.clear();
+	this->statesIds.clear();
+	this->transitionsIds.clear();
+	this->wordSize = 8;
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	this->variablesIds = fsm->getInputVariablesIds() + fsm->getWrittableVariablesIds();
+
+	this->statesIds = fsm->getAllStatesIds();
+	for (auto& stateId : this->statesIds)
+	{
+		auto state = fsm->getState(stateId);
+
+		this->transitionsIds += state->getOutgoingTransitionsIds();
+	}
+
+	uint maxSize = 1;
+	for (auto& variableId : fsm->getAllVariablesIds())
+	{
+		auto variable = fsm->getVariable(variableId);
+		if (variable == nullptr) continue;
+
+
+		maxSize = qMax(maxSize, variable->getSize());
+	}
+	for (auto& transitionId : this->transitionsIds)
+	{
+		auto transition = fsm->getTransition(transitionId);
+
+		maxSize = qMax(maxSize, this->getEquationMaxSize(transition->getCondition()));
+	}
+
+	while (this->wordSize < maxSize)
+	{
+		this->wordSize *= 2;
+	}
+}
+
+/**
+ * @brief FsmCppExport::buildActionsTable lists all actions so that
+ * the actions of each state or transition are contiguous, those on
+ * memorized variables first, then those on temporary variables.
+ */
+void FsmCppExport::buildActionsTable()
+{
+	this->actionsTexts.clear();
+	this->registerActionsFirst.clear();
+	this->registerActionsCount.clear();
+	this->outputActionsFirst.clear();
+	this->outputActionsCount.clear();
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	for (auto& actuatorId : this->statesIds + this->transitionsIds)
+	{
+		auto actuator = dynamic_pointer_cast<MachineActuatorComponent>(fsm->getComponent(actuatorId));
+		if (actuator == nullptr) continue;
+
+
+		this->registerActionsFirst[actuatorId] = this->actionsTexts.count();
+		for (auto& action : actuator->getActions())
+		{
+			auto variable = fsm->getVariable(action->getVariableActedOnId());
+			if ( (variable == nullptr) || (variable->getMemorized() == false) ) continue;
+
+
+			this->actionsTexts.append(this->generateActionText(action));
+		}
+		this->registerActionsCount[actuatorId] = this->actionsTexts.count() - this->registerActionsFirst[actuatorId];
+
+		this->outputActionsFirst[actuatorId] = this->actionsTexts.count();
+		for (auto& action : actuator->getActions())
+		{
+			auto variable = fsm->getVariable(action->getVariableActedOnId());
+			if ( (variable == nullptr) || (variable->getMemorized() == true) ) continue;
+
+
+			this->actionsTexts.append(this->generateActionText(action));
+		}
+		this->outputActionsCount[actuatorId] = this->actionsTexts.count() - this->outputActionsFirst[actuatorId];
+	}
+}
+
+void FsmCppExport::writeHeader(QTextStream& stream) const
+{
+	stream << "// FSM generated with StateS v" << StateS::getVersion() << " on " << QDate::currentDate().toString() << " at " << QTime::currentTime().toString() << "\n";
+	stream << "// https://github.com/ClementFoucher/StateS\n";
+	stream << "//\n";
+	stream << "// Usage: call reset() once, then write inputs in Machine::values and\n";
+	stream << "// call step() once per cycle. Outputs are up to date after each step,\n";
+	stream << "// call updateOutputs() to refresh them after changing inputs.\n\n";
+}
+
+void FsmCppExport::writeTypes(QTextStream& stream) const
+{
+	stream << "// Values are packed in the smallest word holding the widest variable\n";
+	stream << "using Word = uint" << this->wordSize << "_t;\n\n";
+
+	QStringList statesNames;
+	for (auto& stateId : this->statesIds)
+	{
+		statesNames.append(this->model.getStateName(stateId));
+	}
+
+	stream << "enum class State : " << ((this->statesIds.count() <= 256) ? "uint8_t" : "uint16_t") << "\n";
+	stream << "{\n";
+	stream << "\t" << statesNames.join(",\n\t") << "\n";
+	stream << "};\n\n";
+
+	stream << "enum class ActionType : uint8_t\n";
+	stream << "{\n";
+	stream << "\tassign,\n";
+	stream << "\tincrement,\n";
+	stream << "\tdecrement\n";
+	stream << "};\n\n";
+
+	stream << "struct Action\n";
+	stream << "{\n";
+	stream << "\tuint8_t    variable;\n";
+	stream << "\tActionType type;\n";
+	stream << "\tWord       mask;  // Bits acted on\n";
+	stream << "\tuint8_t    shift; // Position of the lowest bit acted on\n";
+	stream << "\tWord       value; // Value assigned, aligned on bit 0\n";
+	stream << "};\n\n";
+
+	stream << "struct ActionList\n";
+	stream << "{\n";
+	stream << "\tuint16_t first;\n";
+	stream << "\tuint16_t count;\n";
+	stream << "};\n\n";
+
+	stream << "struct StateEntry\n";
+	stream << "{\n";
+	stream << "\tuint16_t   firstTransition; // Outgoing transitions are contiguous, in priority order\n";
+	stream << "\tuint16_t   transitionsCount;\n";
+	stream << "\tActionList registerActions; // On memorized variables, applied on step while state is active\n";
+	stream << "\tActionList outputActions;   // On temporary variables, applied while state is active\n";
+	stream << "};\n\n";
+
+	stream << "struct TransitionEntry\n";
+	stream << "{\n";
+	stream << "\tState      target;\n";
+	stream << "\tActionList registerActions; // On memorized variables, applied on step when crossed\n";
+	stream << "\tActionList outputActions;   // Pulse actions\n";
+	stream << "};\n\n";
+}
+
+void FsmCppExport::writeVariables(QTextStream& stream) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	// Arrays can not be empty
+	uint valuesArraySize = qMax(this->variablesIds.count(), (qsizetype)1);
+
+	stream << "// Index of each variable in Machine::values\n";
+	stream << "enum VariableIndex : uint8_t\n";
+	stream << "{\n";
+	for (auto& variableId : this->variablesIds)
+	{
+		stream << "\t" << this->model.getVariableDrivenName(variableId) << ",\n";
+	}
+	stream << "\tVARIABLES_COUNT\n";
+	stream << "};\n\n";
+
+	for (auto& constantId : fsm->getConstantsIds())
+	{
+		auto constant = fsm->getVariable(constantId);
+		if (constant == nullptr) continue;
+
+
+		stream << "constexpr Word " << this->model.getVariableName(constantId) << " = " << this->generateWordText(FsmSimulationEngine::packValue(constant->getInitialValue())) << ";\n";
+	}
+	if (fsm->getConstantsIds().isEmpty() == false)
+	{
+		stream << "\n";
+	}
+
+	QStringList initialValues;
+	QStringList temporaryVariables;
+	for (auto& variableId : this->variablesIds)
+	{
+		auto variable = fsm->getVariable(variableId);
+		if (variable == nullptr) continue;
+
+
+		initialValues.append(this->generateWordText(FsmSimulationEngine::packValue(variable->getInitialValue())));
+
+		if ( (variable->getMemorized() == false) && (fsm->getInputVariablesIds().contains(variableId) == false) )
+		{
+			temporaryVariables.append(this->model.getVariableDrivenName(variableId));
+		}
+	}
+	if (initialValues.isEmpty() == true)
+	{
+		initialValues.append(this->generateWordText(0));
+	}
+
+	stream << "constexpr Word INITIAL_VALUES[" << valuesArraySize << "] = { " << initialValues.join(", ") << " };\n\n";
+
+	stream << "// Variables not memorized take their initial value unless acted on\n";
+	stream << "constexpr uint8_t TEMPORARY_VARIABLES_COUNT = " << temporaryVariables.count() << ";\n";
+	if (temporaryVariables.isEmpty() == true)
+	{
+		temporaryVariables.append("0");
+	}
+	stream << "constexpr uint8_t TEMPORARY_VARIABLES[" << qMax(temporaryVariables.count(), (qsizetype)1) << "] = { " << temporaryVariables.join(", ") << " };\n\n";
+
+	stream << "struct Machine\n";
+	stream << "{\n";
+	stream << "\tState   state;\n";
+	stream << "\tint32_t crossedTransition; // Transition crossed on last step, -1 if none\n";
+	stream << "\tWord    values[" << valuesArraySize << "];\n";
+	stream << "};\n\n";
+}
+
+void FsmCppExport::writeTables(QTextStream& stream) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	stream << "constexpr uint16_t STATES_COUNT      = " << this->statesIds.count() << ";\n";
+	stream << "constexpr uint16_t TRANSITIONS_COUNT = " << this->transitionsIds.count() << ";\n";
+	stream << "constexpr State    INITIAL_STATE     = State::" << this->model.getStateName(fsm->getInitialStateId()) << ";\n\n";
+
+	// Actions
+	stream << "constexpr Action ACTIONS[] =\n";
+	stream << "{\n";
+	if (this->actionsTexts.isEmpty() == false)
+	{
+		stream << "\t" << this->actionsTexts.join(",\n\t") << "\n";
+	}
+	else
+	{
+		// Arrays can not be empty
+		stream << "\t{ 0, ActionType::assign, 0, 0, 0 }\n";
+	}
+	stream << "};\n\n";
+
+	// States
+	QStringList statesEntries;
+	uint firstTransition = 0;
+	for (auto& stateId : this->statesIds)
+	{
+		auto state = fsm->getState(stateId);
+		uint transitionsCount = state->getOutgoingTransitionsIds().count();
+
+		statesEntries.append("{ " + QString::number(firstTransition) + ", " + QString::number(transitionsCount) + ", " + this->generateActionListText(stateId, true) + ", " + this->generateActionListText(stateId, false) + " }, // " + this->model.getStateName(stateId));
+
+		firstTransition += transitionsCount;
+	}
+
+	stream << "constexpr StateEntry STATES[STATES_COUNT] =\n";
+	stream << "{\n";
+	for (auto& stateEntry : statesEntries)
+	{
+		stream << "\t" << stateEntry << "\n";
+	}
+	stream << "};\n\n";
+
+	// Transitions
+	stream << "constexpr TransitionEntry TRANSITIONS[] =\n";
+	stream << "{\n";
+	for (auto& transitionId : this->transitionsIds)
+	{
+		auto transition = fsm->getTransition(transitionId);
+
+		stream << "\t{ State::" << this->model.getStateName(transition->getTargetStateId()) << ", ";
+		stream << this->generateActionListText(transitionId, true) << ", " << this->generateActionListText(transitionId, false) << " }, ";
+		stream << "// " << this->model.getStateName(transition->getSourceStateId()) << " -> " << this->model.getStateName(transition->getTargetStateId()) << "\n";
+	}
+	if (this->transitionsIds.isEmpty() == true)
+	{
+		// Arrays can not be empty
+		stream << "\t{ INITIAL_STATE, { 0, 0 }, { 0, 0 } }\n";
+	}
+	stream << "};\n\n";
+}
+
+void FsmCppExport::writeConditions(QTextStream& stream) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	stream << "// Transitions conditions, evaluated bitwise on packed values\n";
+	stream << "inline bool isConditionTrue(uint16_t transition, const Word* v)\n";
+	stream << "{\n";
+	stream << "\tswitch (transition)\n";
+	stream << "\t{\n";
+
+	for (int i = 0 ; i < this->transitionsIds.count() ; i++)
+	{
+		auto transition = fsm->getTransition(this->transitionsIds.at(i));
+		auto condition = transition->getCondition();
+
+		stream << "\tcase " << i << ":\n";
+		if (condition == nullptr)
+		{
+			// Empty condition is considered always true
+			stream << "\t\treturn true;\n";
+		}
+		else
+		{
+			stream << "\t\treturn (" << this->generateEquationText(condition) << ") == 1u;\n";
+		}
+	}
+
+	stream << "\tdefault:\n";
+	stream << "\t\treturn false;\n";
+	stream << "\t}\n";
+	stream << "}\n\n";
+}
+
+void FsmCppExport::writeFunctions(QTextStream& stream) const
+{
+	stream << "inline void applyActions(const ActionList& list, const Word* source, Word* target)\n";
+	stream << "{\n";
+	stream << "\tfor (uint16_t i = list.first ; i < list.first + list.count ; i++)\n";
+	stream << "\t{\n";
+	stream << "\t\tconst Action& action = ACTIONS[i];\n\n";
+	stream << "\t\tWord current = Word((source[action.variable] & action.mask) >> action.shift);\n";
+	stream << "\t\tWord result  = action.value;\n";
+	stream << "\t\tif (action.type == ActionType::increment)\n";
+	stream << "\t\t\tresult = Word(current + 1u);\n";
+	stream << "\t\telse if (action.type == ActionType::decrement)\n";
+	stream << "\t\t\tresult = Word(current - 1u);\n\n";
+	stream << "\t\ttarget[action.variable] = Word((target[action.variable] & ~action.mask) | ((result << action.shift) & action.mask));\n";
+	stream << "\t}\n";
+	stream << "}\n\n";
+
+	stream << "// First transition leaving current state with a true condition, -1 if none\n";
+	stream << "inline int32_t findCrossableTransition(const Machine& machine)\n";
+	stream << "{\n";
+	stream << "\tconst StateEntry& state = STATES[uint16_t(machine.state)];\n\n";
+	stream << "\tfor (uint16_t i = state.firstTransition ; i < state.firstTransition + state.transitionsCount ; i++)\n";
+	stream << "\t{\n";
+	stream << "\t\tif (isConditionTrue(i, machine.values) == true)\n";
+	stream << "\t\t\treturn i;\n";
+	stream << "\t}\n\n";
+	stream << "\treturn -1;\n";
+	stream << "}\n\n";
+
+	stream << "// Temporary variables: continuous actions of current state, then pulse actions\n";
+	if (this->registerMealyOutputs == true)
+	{
+		stream << "// of the transition crossed on last step, active until next step\n";
+	}
+	else
+	{
+		stream << "// of the transition to be crossed with current inputs (Mealy)\n";
+	}
+	stream << "inline void updateOutputs(Machine& machine)\n";
+	stream << "{\n";
+	stream << "\tfor (uint8_t i = 0 ; i < TEMPORARY_VARIABLES_COUNT ; i++)\n";
+	stream << "\t\tmachine.values[TEMPORARY_VARIABLES[i]] = INITIAL_VALUES[TEMPORARY_VARIABLES[i]];\n\n";
+	stream << "\tapplyActions(STATES[uint16_t(machine.state)].outputActions, machine.values, machine.values);\n\n";
+	if (this->registerMealyOutputs == true)
+	{
+		stream << "\tint32_t transition = machine.crossedTransition;\n";
+	}
+	else
+	{
+		stream << "\tint32_t transition = findCrossableTransition(machine);\n";
+	}
+	stream << "\tif (transition >= 0)\n";
+	stream << "\t\tapplyActions(TRANSITIONS[transition].outputActions, machine.values, machine.values);\n";
+	stream << "}\n\n";
+
+	stream << "inline void reset(Machine& machine)\n";
+	stream << "{\n";
+	stream << "\tmachine.state = INITIAL_STATE;\n";
+	stream << "\tmachine.crossedTransition = -1;\n\n";
+	stream << "\tfor (uint8_t i = 0 ; i < VARIABLES_COUNT ; i++)\n";
+	stream << "\t\tmachine.values[i] = INITIAL_VALUES[i];\n\n";
+	stream << "\tupdateOutputs(machine);\n";
+	stream << "}\n\n";
+
+	stream << "inline void step(Machine& machine)\n";
+	stream << "{\n";
+	stream << "\tint32_t transition = findCrossableTransition(machine);\n\n";
+	stream << "\t// Memorized variables are all updated from the values before the step\n";
+	stream << "\tWord previous[sizeof(machine.values) / sizeof(Word)];\n";
+	stream << "\tfor (uint8_t i = 0 ; i < VARIABLES_COUNT ; i++)\n";
+	stream << "\t\tprevious[i] = machine.values[i];\n\n";
+	stream << "\tapplyActions(STATES[uint16_t(machine.state)].registerActions, previous, machine.values);\n\n";
+	stream << "\tif (transition >= 0)\n";
+	stream << "\t{\n";
+	stream << "\t\tapplyActions(TRANSITIONS[transition].registerActions, previous, machine.values);\n";
+	stream << "\t\tmachine.state = TRANSITIONS[transition].target;\n";
+	stream << "\t}\n\n";
+	stream << "\tmachine.crossedTransition = transition;\n\n";
+	stream << "\tupdateOutputs(machine);\n";
+	stream << "}\n\n";
+}
+
+QString FsmCppExport::generateActionText(shared_ptr<ActionOnVariable> action) const
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return QString();
+
+	auto variable = machine->getVariable(action->getVariableActedOnId());
+	if (variable == nullptr) return QString();
+
+
+	int rangeL = action->getActionRangeL();
+	int rangeR = action->getActionRangeR();
+
+	uint shift;
+	uint size;
+	if (rangeL < 0)
+	{
+		shift = 0;
+		size  = variable->getSize();
+	}
+	else if (rangeR < 0)
+	{
+		shift = rangeL;
+		size  = 1;
+	}
+	else
+	{
+		shift = rangeR;
+		size  = rangeL - rangeR + 1;
+	}
+
+	quint64 mask = FsmSimulationEngine::getMask(size) << shift;
+
+	QString typeText;
+	switch (action->getActionType())
+	{
+	case ActionOnVariableType_t::none:
+	case ActionOnVariableType_t::continuous:
+	case ActionOnVariableType_t::pulse:
+	case ActionOnVariableType_t::set:
+	case ActionOnVariableType_t::reset:
+	case ActionOnVariableType_t::assign:
+		typeText = "ActionType::assign";
+		break;
+	case ActionOnVariableType_t::increment:
+		typeText = "ActionType::increment";
+		break;
+	case ActionOnVariableType_t::decrement:
+		typeText = "ActionType::decrement";
+		break;
+	}
+
+	QString text = "{ ";
+	text += this->model.getVariableDrivenName(action->getVariableActedOnId()) + ", ";
+	text += typeText + ", ";
+	text += this->generateWordText(mask) + ", ";
+	text += QString::number(shift) + ", ";
+	text += this->generateWordText(FsmSimulationEngine::packValue(action->getActionValue()));
+	text += " }";
+
+	return text;
+}
+
+QString FsmCppExport::generateActionListText(componentId_t componentId, bool onMemorizedVariables) const
+{
+	if (onMemorizedVariables == true)
+	{
+		return "{ " + QString::number(this->registerActionsFirst.value(componentId)) + ", " + QString::number(this->registerActionsCount.value(componentId)) + " }";
+	}
+	else
+	{
+		return "{ " + QString::number(this->outputActionsFirst.value(componentId)) + ", " + QString::number(this->outputActionsCount.value(componentId)) + " }";
+	}
+}
+
+/**
+ * @brief FsmCppExport::generateEquationText
+ * @return Expression of the equation value, aligned on bit 0,
+ * in which bits above the equation size are cleared.
+ */
+QString FsmCppExport::generateEquationText(shared_ptr<Equation> equation) const
+{
+	if (equation == nullptr) return "0u";
+
+
+	QString text;
+
+	OperatorType_t function = equation->getOperatorType();
+	if (function == OperatorType_t::identity) // Equation is actually a single variable or constant
+	{
+		text = this->generateOperandText(equation->getOperand(0));
+	}
+	else if (function == OperatorType_t::extractOp)
+	{
+		int rangeL = equation->getRangeL();
+		int rangeR = equation->getRangeR();
+
+		QString operandText = this->generateOperandText(equation->getOperand(0));
+		if (rangeR < 0)
+		{
+			text = "((" + operandText + " >> " + QString::number(rangeL) + ") & 1u)";
+		}
+		else
+		{
+			text = "((" + operandText + " >> " + QString::number(rangeR) + ") & " + this->generateMaskText(rangeL - rangeR + 1) + ")";
+		}
+	}
+	else if (function == OperatorType_t::notOp)
+	{
+		text = "(~" + this->generateOperandText(equation->getOperand(0)) + " & " + this->generateMaskText(equation->getSize()) + ")";
+	}
+	else if (function == OperatorType_t::concatOp)
+	{
+		// First operand is on the most significant bits
+		QStringList operandsTexts;
+		uint shift = 0;
+		for (int i = equation->getOperandCount() - 1 ; i >= 0 ; i--)
+		{
+			auto operand = equation->getOperand(i);
+
+			operandsTexts.prepend("(Word(" + this->generateOperandText(operand) + ") << " + QString::number(shift) + ")");
+			shift += this->getOperandSize(operand);
+		}
+
+		text = "(" + operandsTexts.join(" | ") + ")";
+	}
+	else
+	{
+		QStringList operandsTexts;
+		for (uint i = 0 ; i < equation->getOperandCount() ; i++)
+		{
+			operandsTexts.append(this->generateOperandText(equation->getOperand(i)));
+		}
+
+		QString mask = this->generateMaskText(equation->getSize());
+
+		switch(function)
+		{
+		case OperatorType_t::andOp:
+			text = "(" + operandsTexts.join(" & ") + ")";
+			break;
+		case OperatorType_t::orOp:
+			text = "(" + operandsTexts.join(" | ") + ")";
+			break;
+		case OperatorType_t::xorOp:
+			text = "(" + operandsTexts.join(" ^ ") + ")";
+			break;
+		case OperatorType_t::nandOp:
+			text = "(~(" + operandsTexts.join(" & ") + ") & " + mask + ")";
+			break;
+		case OperatorType_t::norOp:
+			text = "(~(" + operandsTexts.join(" | ") + ") & " + mask + ")";
+			break;
+		case OperatorType_t::xnorOp:
+			text = "(~(" + operandsTexts.join(" ^ ") + ") & " + mask + ")";
+			break;
+		case OperatorType_t::equalOp:
+			text = "Word(" + operandsTexts.join(" == ") + ")";
+			break;
+		case OperatorType_t::diffOp:
+			text = "Word(" + operandsTexts.join(" != ") + ")";
+			break;
+		case OperatorType_t::concatOp:
+		case OperatorType_t::extractOp:
+		case OperatorType_t::notOp:
+		case OperatorType_t::identity:
+			// Cases treated in another branch of the if
+			break;
+		}
+	}
+
+	return text;
+}
+
+QString FsmCppExport::generateOperandText(shared_ptr<Operand> operand) const
+{
+	if (operand == nullptr) return "0u";
+
+
+	switch (operand->getSource())
+	{
+	case OperandSource_t::equation:
+		return this->generateEquationText(operand->getEquation());
+		break;
+	case OperandSource_t::variable:
+	{
+		auto machine = machineManager->getMachine();
+		if (machine == nullptr) return "0u";
+
+
+		auto variableId = operand->getVariableId();
+		if (machine->getConstantsIds().contains(variableId) == true)
+		{
+			return this->model.getVariableName(variableId);
+		}
+		else
+		{
+			return "v[" + this->model.getVariableDrivenName(variableId) + "]";
+		}
+		break;
+	}
+	case OperandSource_t::constant:
+		return this->generateWordText(FsmSimulationEngine::packValue(operand->getConstant()));
+		break;
+	}
+
+	return "0u";
+}
+
+QString FsmCppExport::generateWordText(quint64 value) const
+{
+	QString text = "0x" + QString::number(value, 16).toUpper();
+
+	if (value > 0xFFFFFFFFu)
+	{
+		return text + "ull";
+	}
+	else
+	{
+		return text + "u";
+	}
+}
+
+QString FsmCppExport::generateMaskText(uint size) const
+{
+	return this->generateWordText(FsmSimulationEngine::getMask(size));
+}
+
+uint FsmCppExport::getOperandSize(shared_ptr<Operand> operand) const
+{
+	if (operand == nullptr) return 0;
+
+
+	switch (operand->getSource())
+	{
+	case OperandSource_t::equation:
+	{
+		auto equation = operand->getEquation();
+		if (equation == nullptr) return 0;
+
+
+		return equation->getSize();
+		break;
+	}
+	case OperandSource_t::variable:
+	{
+		auto machine = machineManager->getMachine();
+		if (machine == nullptr) return 0;
+
+		auto variable = machine->getVariable(operand->getVariableId());
+		if (variable == nullptr) return 0;
+
+
+		return variable->getSize();
+		break;
+	}
+	case OperandSource_t::constant:
+		return operand->getConstant().getSize();
+		break;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief FsmCppExport::getEquationMaxSize
+ * @return Size of the largest value computed while
+ * evaluating the equation, including operands.
+ */
+uint FsmCppExport::getEquationMaxSize(shared_ptr<Equation> equation) const
+{
+	if (equation == nullptr) return 0;
+
+
+	uint maxSize = equation->getSize();
+	for (uint i = 0 ; i < equation->getOperandCount() ; i++)
+	{
+		auto operand = equation->getOperand(i);
+		if (operand == nullptr) continue;
+
+
+		if (operand->getSource() == OperandSource_t::equation)
+		{
+			maxSize = qMax(maxSize, this->getEquationMaxSize(operand->getEquation()));
+		}
+		else
+		{
+			maxSize = qMax(maxSize, this->getOperandSize(operand));
+		}
+	}
+
+	return maxSize;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMCPPEXPORT_H
+#define FSMCPPEXPORT_H
+
+// Parent
+#include <QObject>
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QMap>
+#include <QStringList>
+class QString;
+class QTextStream;
+
+// StateS classes
+#include "statestypes.h"
+#include "fsmhdlmodel.h"
+class ActionOnVariable;
+class Equation;
+class Operand;
+
+
+/**
+ * @brief The FsmCppExport class generates a self-contained C++ header
+ * implementing the current FSM for embedded targets: states, transitions
+ * and actions are constexpr tables, and conditions are evaluated bitwise
+ * on variables values packed in the smallest word holding all of them.
+ *
+ * Generated code does not allocate nor depend on any library other than
+ * <cstdint>, and has the same behavior as the VHDL export: on each step,
+ * memorized variables are updated by the actions of the current state,
+ * then by the actions of the transition crossed, the transition being
+ * the first one with a true condition in priority order.
+ */
+class FsmCppExport : public QObject
+{
+	Q_OBJECT
+
+	/////
+	// Static variables
+public:
+	// Generated tables use uint8_t variables indexes,
+	// and uint16_t states, transitions and actions indexes
+	static const uint maxVariablesCount    = 255;
+	static const uint maxTableEntriesCount = 65535;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmCppExport() = default;
+
+	/////
+	// Object functions
+public:
+	void setOptions(bool prefixSignals, bool registerMealyOutputs);
+
+	bool writeToFile(const QString& path);
+	bool isSupported() const;
+
+private:
+	void buildModel();
+	void buildActionsTable();
+
+	void writeHeader(QTextStream& stream) const;
+	void writeTypes(QTextStream& stream) const;
+	void writeVariables(QTextStream& stream) const;
+	void writeTables(QTextStream& stream) const;
+	void writeConditions(QTextStream& stream) const;
+	void writeFunctions(QTextStream& stream) const;
+
+	QString generateActionText(shared_ptr<ActionOnVariable> action) const;
+	QString generateActionListText(componentId_t componentId, bool onMemorizedVariables) const;
+	QString generateEquationText(shared_ptr<Equation> equation) const;
+	QString generateOperandText(shared_ptr<Operand> operand) const;
+	QString generateWordText(quint64 value) const;
+	QString generateMaskText(uint size) const;
+
+	uint getOperandSize(shared_ptr<Operand> operand) const;
+	uint getEquationMaxSize(shared_ptr<Equation> equation) const;
+
+	/////
+	// Object variables
+private:
+	bool prefixSignals        = false;
+	bool registerMealyOutputs = false;
+
+	FsmHdlModel model;
+
+	// Generated tables layout
+	uint wordSize = 8;
+	QList<componentId_t> variablesIds;   // Index in values array
+	QList<componentId_t> statesIds;      // Index in states table
+	QList<componentId_t> transitionsIds; // Index in transitions table, grouped by source state in priority order
+	QStringList actionsTexts;
+	QMap<componentId_t, uint> registerActionsFirst; // First action of each state or transition on memorized variables
+	QMap<componentId_t, uint> registerActionsCount;
+	QMap<componentId_t, uint> outputActionsFirst;   // First action of each state or transition on temporary variables
+	QMap<componentId_t, uint> outputActionsCount;
+
+};
+
+#endif // FSMCPPEXPORT_H
@@ -0,0 +1,537 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmhdlmodel.h"
+
+// StateS classes
+#include "machinemanager.h"
+#include "fsm.h"
+#include "fsmstate.h"
+#include "fsmtransition.h"
+#include "variable.h"
+#include "equation.h"
+#include "actiononvariable.h"
+#include "operand.h"
+
+
+/**
+ * @brief FsmHdlModel::getRecommendedStateEncoding
+ * Timing: one-hot decodes each state from a single flip-flop,
+ * which gives the shortest next-state and output logic paths,
+ * as long as the register does not become too wide.
+ * Area: binary uses the minimal number of flip-flops. On very
+ * small machines, Johnson uses as many flip-flops as binary
+ * while decoding each state from two bits only.
+ */
+HdlStateEncoding_t FsmHdlModel::getRecommendedStateEncoding(uint statesCount, HdlOptimizationGoal_t goal)
+{
+	switch (goal)
+	{
+	case HdlOptimizationGoal_t::timing:
+		if (statesCount <= 64)
+		{
+			return HdlStateEncoding_t::oneHot;
+		}
+		else
+		{
+			return HdlStateEncoding_t::gray;
+		}
+		break;
+	case HdlOptimizationGoal_t::area:
+		if (statesCount <= 4)
+		{
+			return HdlStateEncoding_t::johnson;
+		}
+		else
+		{
+			return HdlStateEncoding_t::binary;
+		}
+		break;
+	}
+
+	return HdlStateEncoding_t::symbolic;
+}
+
+/**
+ * @brief FsmHdlModel::build analyzes the current FSM.
+ * @param reservedNames Identifiers used by the generated code,
+ * which must not be attributed to machine components.
+ */
+void FsmHdlModel::build(bool prefixSignals, HdlStateEncoding_t stateEncoding, bool registerMealyOutputs, const QSet<QString>& reservedNames)
+{
+	this->prefixSignals        = prefixSignals;
+	this->stateEncoding        = stateEncoding;
+	this->registerMealyOutputs = registerMealyOutputs;
+
+	this->variableName.clear();
+	this->outputInternalName.clear();
+	this->pulseRegisterName.clear();
+	this->stateName.clear();
+	this->stateCode.clear();
+	this->machineName.clear();
+
+	this->usedNames.clear();
+	for (auto& reservedName : reservedNames)
+	{
+		this->usedNames.insert(reservedName.toLower());
+	}
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	this->buildActuatorsIndexes();
+
+	// Machine
+	this->machineName = this->generateUniqueName(this->cleanName(fsm->getName()));
+
+	// Variables: named first so that ports names are not altered by states names
+	QString signalName;
+
+	for (auto& inputId : fsm->getInputVariablesIds())
+	{
+		auto input = fsm->getVariable(inputId);
+		if (input == nullptr) continue;
+
+
+		signalName = this->generateSignalName("I_", input->getName());
+		this->variableName[inputId] = signalName;
+	}
+	for (auto& outputId : fsm->getOutputVariablesIds())
+	{
+		auto output = fsm->getVariable(outputId);
+		if (output == nullptr) continue;
+
+
+		signalName = this->generateSignalName("O_", output->getName());
+		this->variableName[outputId] = signalName;
+	}
+	for (auto& variableId : fsm->getInternalVariablesIds())
+	{
+		auto variable = fsm->getVariable(variableId);
+		if (variable == nullptr) continue;
+
+
+		signalName = this->generateSignalName("SIG_", variable->getName());
+		this->variableName[variableId] = signalName;
+	}
+	for (auto& constantId : fsm->getConstantsIds())
+	{
+		auto constant = fsm->getVariable(constantId);
+		if (constant == nullptr) continue;
+
+
+		signalName = this->generateSignalName("CONST_", constant->getName());
+		this->variableName[constantId] = signalName;
+	}
+
+	// Out ports can not be read: outputs used in conditions
+	// or holding a value are driven through an internal signal.
+	QSet<componentId_t> readVariables;
+	for (auto& transitionId : fsm->getAllTransitionsIds())
+	{
+		auto transition = fsm->getTransition(transitionId);
+
+		this->collectReadVariables(transition->getCondition(), readVariables);
+	}
+
+	for (auto& outputId : fsm->getOutputVariablesIds())
+	{
+		auto output = fsm->getVariable(outputId);
+		if (output == nullptr) continue;
+
+
+		if ( (output->getMemorized() == true) || (readVariables.contains(outputId) == true) )
+		{
+			this->outputInternalName[outputId] = this->generateUniqueName(this->variableName[outputId] + "_int");
+		}
+	}
+
+	if (this->registerMealyOutputs == true)
+	{
+		auto writtableVariablesIds = fsm->getWrittableVariablesIds();
+		for (auto& variableId : writtableVariablesIds)
+		{
+			auto variable = fsm->getVariable(variableId);
+			if (variable == nullptr) continue;
+
+			if (variable->getMemorized() == true) continue;
+
+			if (this->variableMealyActuators.contains(variableId) == false) continue;
+
+
+			this->pulseRegisterName[variableId] = this->generateUniqueName(this->variableName[variableId] + "_pulse");
+		}
+	}
+
+	// States
+	for (auto& stateId : fsm->getAllStatesIds())
+	{
+		auto state = fsm->getState(stateId);
+
+		this->stateName[stateId] = this->generateUniqueName("S_" + this->cleanName(state->getName()));
+	}
+
+	this->generateStatesCodes();
+}
+
+QString FsmHdlModel::getMachineName() const
+{
+	return this->machineName;
+}
+
+QString FsmHdlModel::getVariableName(componentId_t variableId) const
+{
+	return this->variableName.value(variableId);
+}
+
+/**
+ * @brief FsmHdlModel::getVariableDrivenName
+ * @return Name of the signal to write or read
+ * in the generated code for this variable.
+ */
+QString FsmHdlModel::getVariableDrivenName(componentId_t variableId) const
+{
+	if (this->outputInternalName.contains(variableId) == true)
+	{
+		return this->outputInternalName[variableId];
+	}
+	else
+	{
+		return this->variableName.value(variableId);
+	}
+}
+
+QString FsmHdlModel::getStateName(componentId_t stateId) const
+{
+	return this->stateName.value(stateId);
+}
+
+bool FsmHdlModel::isStateEncoded() const
+{
+	return (this->stateCode.isEmpty() == false);
+}
+
+QString FsmHdlModel::getStateCode(componentId_t stateId) const
+{
+	return this->stateCode.value(stateId);
+}
+
+uint FsmHdlModel::getStateCodeSize() const
+{
+	if (this->stateCode.isEmpty() == true) return 0;
+
+
+	return this->stateCode.first().size();
+}
+
+const QList<componentId_t> FsmHdlModel::getBufferedOutputsIds() const
+{
+	return this->outputInternalName.keys();
+}
+
+QString FsmHdlModel::getOutputInternalName(componentId_t outputId) const
+{
+	return this->outputInternalName.value(outputId);
+}
+
+const QList<componentId_t> FsmHdlModel::getPulseRegisteredVariablesIds() const
+{
+	return this->pulseRegisterName.keys();
+}
+
+bool FsmHdlModel::isPulseRegistered(componentId_t variableId) const
+{
+	return this->pulseRegisterName.contains(variableId);
+}
+
+QString FsmHdlModel::getPulseRegisterName(componentId_t variableId) const
+{
+	return this->pulseRegisterName.value(variableId);
+}
+
+const QList<componentId_t> FsmHdlModel::getMooreActuators(componentId_t variableId) const
+{
+	return this->variableMooreActuators.value(variableId);
+}
+
+const QList<componentId_t> FsmHdlModel::getMealyActuators(componentId_t variableId) const
+{
+	return this->variableMealyActuators.value(variableId);
+}
+
+/**
+ * @brief FsmHdlModel::getLastActingTransitionIndex
+ * @return Index, among the transitions leaving the state, of the last
+ * one acting on the variable, or -1 if none does. Transitions before
+ * this one must be tested too, as they have priority over it.
+ */
+int FsmHdlModel::getLastActingTransitionIndex(componentId_t stateId, componentId_t variableId) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return -1;
+
+	auto state = fsm->getState(stateId);
+	if (state == nullptr) return -1;
+
+
+	auto actuators = this->variableMealyActuators.value(variableId);
+	auto transitionsIds = state->getOutgoingTransitionsIds();
+
+	int lastActingTransition = -1;
+	for (int i = 0 ; i < transitionsIds.count() ; i++)
+	{
+		if (actuators.contains(transitionsIds.at(i)) == true)
+		{
+			lastActingTransition = i;
+		}
+	}
+
+	return lastActingTransition;
+}
+
+/**
+ * @brief FsmHdlModel::isCombinationalMealyOutput
+ * @return True if output value depends on inputs between clock
+ * edges, i.e. is not registered and has Mealy actions.
+ */
+bool FsmHdlModel::isCombinationalMealyOutput(componentId_t outputId) const
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return false;
+
+	auto output = machine->getVariable(outputId);
+	if (output == nullptr) return false;
+
+
+	if (output->getMemorized() == true) return false;
+
+	if (this->variableMealyActuators.contains(outputId) == false) return false;
+
+	if (this->pulseRegisterName.contains(outputId) == true) return false;
+
+
+	return true;
+}
+
+/**
+ * @brief FsmHdlModel::buildActuatorsIndexes lists the
+ * states and transitions acting on each variable using
+ * a single pass over all actions.
+ */
+void FsmHdlModel::buildActuatorsIndexes()
+{
+	this->variableMooreActuators.clear();
+	this->variableMealyActuators.clear();
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	for (auto& stateId : fsm->getAllStatesIds())
+	{
+		auto state = fsm->getState(stateId);
+
+		for (auto& action : state->getActions())
+		{
+			auto& actuators = this->variableMooreActuators[action->getVariableActedOnId()];
+			if ( (actuators.isEmpty() == true) || (actuators.last() != stateId) )
+			{
+				actuators.append(stateId);
+			}
+		}
+	}
+
+	for (auto& transitionId : fsm->getAllTransitionsIds())
+	{
+		auto transition = fsm->getTransition(transitionId);
+
+		for (auto& action : transition->getActions())
+		{
+			auto& actuators = this->variableMealyActuators[action->getVariableActedOnId()];
+			if ( (actuators.isEmpty() == true) || (actuators.last() != transitionId) )
+			{
+				actuators.append(transitionId);
+			}
+		}
+	}
+}
+
+void FsmHdlModel::collectReadVariables(shared_ptr<Equation> equation, QSet<componentId_t>& readVariables) const
+{
+	if (equation == nullptr) return;
+
+
+	for (uint i = 0 ; i < equation->getOperandCount() ; i++)
+	{
+		auto operand = equation->getOperand(i);
+		if (operand == nullptr) continue;
+
+
+		switch (operand->getSource())
+		{
+		case OperandSource_t::variable:
+			readVariables.insert(operand->getVariableId());
+			break;
+		case OperandSource_t::equation:
+			this->collectReadVariables(operand->getEquation(), readVariables);
+			break;
+		case OperandSource_t::constant:
+			break;
+		}
+	}
+}
+
+/**
+ * @brief FsmHdlModel::generateStatesCodes
+ * The initial state is always given code index 0,
+ * which is the all-zeros code except for one-hot.
+ */
+void FsmHdlModel::generateStatesCodes()
+{
+	if (this->stateEncoding == HdlStateEncoding_t::symbolic) return;
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	auto statesIds = fsm->getAllStatesIds();
+	auto initialStateId = fsm->getInitialStateId();
+	if (statesIds.contains(initialStateId) == true)
+	{
+		statesIds.removeOne(initialStateId);
+		statesIds.prepend(initialStateId);
+	}
+
+	uint statesCount = statesIds.count();
+	for (uint i = 0 ; i < statesCount ; i++)
+	{
+		this->stateCode[statesIds.at(i)] = this->generateStateCode(i, statesCount);
+	}
+}
+
+/**
+ * @brief FsmHdlModel::generateStateCode
+ * @return Code of the index-th state as a bit string, MSB first.
+ */
+QString FsmHdlModel::generateStateCode(uint index, uint statesCount) const
+{
+	uint binaryWidth = 1;
+	while ( (binaryWidth < 32) && ((1u << binaryWidth) < statesCount) )
+	{
+		binaryWidth++;
+	}
+
+	QString code;
+	switch (this->stateEncoding)
+	{
+	case HdlStateEncoding_t::symbolic:
+		break;
+	case HdlStateEncoding_t::binary:
+		code = QString::number(index, 2).rightJustified(binaryWidth, '0');
+		break;
+	case HdlStateEncoding_t::gray:
+		code = QString::number(index ^ (index >> 1), 2).rightJustified(binaryWidth, '0');
+		break;
+	case HdlStateEncoding_t::oneHot:
+		code = QString(statesCount, '0');
+		code[statesCount - 1 - index] = '1';
+		break;
+	case HdlStateEncoding_t::johnson:
+	{
+		// Ones fill from the LSB, then zeros do:
+		// 000, 001, 011, 111, 110, 100
+		uint width = qMax((statesCount + 1) / 2, 1u);
+		code = QString(width, '0');
+		for (uint bit = 0 ; bit < width ; bit++)
+		{
+			bool isOne;
+			if (index <= width)
+			{
+				isOne = (bit < index);
+			}
+			else
+			{
+				isOne = (bit >= index - width);
+			}
+
+			if (isOne == true)
+			{
+				code[width - 1 - bit] = '1';
+			}
+		}
+		break;
+	}
+	}
+
+	return code;
+}
+
+/**
+ * @brief FsmHdlModel::generateUniqueName
+ * @return Radical, suffixed with a number if
+ * already used (case insensitive).
+ */
+QString FsmHdlModel::generateUniqueName(const QString& radical)
+{
+	int occurence = 2;
+	QString name = radical;
+	while (this->usedNames.contains(name.toLower()))
+	{
+		name = radical + QString::number(occurence);
+		occurence++;
+	}
+
+	this->usedNames.insert(name.toLower());
+
+	return name;
+}
+
+QString FsmHdlModel::generateSignalName(const QString& prefix, const QString& name)
+{
+	QString signalRadical;
+
+	if (this->prefixSignals)
+	{
+		signalRadical += prefix;
+	}
+
+	signalRadical += cleanName(name);
+
+	return this->generateUniqueName(signalRadical);
+}
+
+QString FsmHdlModel::cleanName(const QString& name) const
+{
+	// TODO
+	QString newName = name;
+
+	newName.replace(" ", "_");
+	newName.replace("#", "_");
+
+	while (newName.contains("__"))
+	{
+		newName.replace("__", "_");
+	}
+
+	return newName;
+}
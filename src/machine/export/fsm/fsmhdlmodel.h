@@ -0,0 +1,128 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMHDLMODEL_H
+#define FSMHDLMODEL_H
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QMap>
+#include <QSet>
+#include <QString>
+
+// StateS classes
+#include "statestypes.h"
+class Equation;
+
+
+/**
+ * @brief The FsmHdlModel class is the analysis of the current FSM
+ * shared by the hardware description backends: identifiers of the
+ * machine components, state codes, and how each variable is driven.
+ *
+ * Identifiers are legal in both VHDL and SystemVerilog, and unique
+ * regardless of case, so that ports are named the same in all
+ * languages. Each backend provides the identifiers its generated
+ * code uses, which are not attributed to machine components.
+ *
+ * A writtable variable is driven:
+ * - By a register if memorized, updated on clock edge by the actions
+ *   of the current state, then by the actions of the transition crossed,
+ * - Else combinatorially from the current state continuous actions and
+ *   from the pulse actions of the transition to be crossed (Mealy), or
+ *   from a pulse register when Mealy outputs are registered.
+ */
+class FsmHdlModel
+{
+
+	/////
+	// Static functions
+public:
+	static HdlStateEncoding_t getRecommendedStateEncoding(uint statesCount, HdlOptimizationGoal_t goal);
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmHdlModel() = default;
+
+	/////
+	// Object functions
+public:
+	void build(bool prefixSignals, HdlStateEncoding_t stateEncoding, bool registerMealyOutputs, const QSet<QString>& reservedNames);
+
+	QString getMachineName() const;
+	QString getVariableName(componentId_t variableId) const;
+	QString getVariableDrivenName(componentId_t variableId) const;
+	QString getStateName(componentId_t stateId) const;
+
+	bool isStateEncoded() const;
+	QString getStateCode(componentId_t stateId) const;
+	uint getStateCodeSize() const;
+
+	const QList<componentId_t> getBufferedOutputsIds() const;
+	QString getOutputInternalName(componentId_t outputId) const;
+
+	const QList<componentId_t> getPulseRegisteredVariablesIds() const;
+	bool isPulseRegistered(componentId_t variableId) const;
+	QString getPulseRegisterName(componentId_t variableId) const;
+
+	const QList<componentId_t> getMooreActuators(componentId_t variableId) const;
+	const QList<componentId_t> getMealyActuators(componentId_t variableId) const;
+	bool isActedOnBy(componentId_t stateId, componentId_t variableId) const;
+	int getLastActingTransitionIndex(componentId_t stateId, componentId_t variableId) const;
+	bool isCombinationalMealyOutput(componentId_t outputId) const;
+
+private:
+	void buildActuatorsIndexes();
+	void collectReadVariables(shared_ptr<Equation> equation, QSet<componentId_t>& readVariables) const;
+	void generateStatesCodes();
+	QString generateStateCode(uint index, uint statesCount) const;
+	QString generateUniqueName(const QString& radical);
+	QString generateSignalName(const QString& prefix, const QString& name);
+	QString cleanName(const QString& name) const;
+
+	/////
+	// Object variables
+private:
+	bool prefixSignals        = false;
+	bool registerMealyOutputs = false;
+	HdlStateEncoding_t stateEncoding = HdlStateEncoding_t::symbolic;
+
+	QMap<componentId_t, QString> variableName;
+	QMap<componentId_t, QString> outputInternalName; // Outputs which are read or memorized are driven through an internal signal
+	QMap<componentId_t, QString> pulseRegisterName;  // Temporary variables with registered Mealy actions
+	QMap<componentId_t, QString> stateName;
+	QMap<componentId_t, QString> stateCode; // Empty for symbolic encoding
+	QString machineName;
+
+	// Lower case version of all names already attributed
+	QSet<QString> usedNames;
+
+	// Built in a single pass over states and transitions actions.
+	QMap<componentId_t, QList<componentId_t>> variableMooreActuators; // States acting on variable
+	QMap<componentId_t, QList<componentId_t>> variableMealyActuators; // Transitions acting on variable
+
+};
+
+#endif // FSMHDLMODEL_H
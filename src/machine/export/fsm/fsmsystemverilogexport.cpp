@@ -0,0 +1,734 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmsystemverilogexport.h"
+
+// Qt classes
+#include <QDate>
+#include <QFile>
+#include <QTextStream>
+
+// StateS classes
+#include "states.h"
+#include "machinemanager.h"
+#include "fsm.h"
+#include "fsmstate.h"
+#include "fsmtransition.h"
+#include "variable.h"
+#include "equation.h"
+#include "actiononvariable.h"
+#include "operand.h"
+
+
+void FsmSystemVerilogExport::setOptions(bool resetLogicPositive, bool prefixSignals, HdlStateEncoding_t stateEncoding, bool registerMealyOutputs)
+{
+	this->resetLogicPositive   = resetLogicPositive;
+	this->prefixSignals        = prefixSignals;
+	this->stateEncoding        = stateEncoding;
+	this->registerMealyOutputs = registerMealyOutputs;
+}
+
+bool FsmSystemVerilogExport::writeToFile(const QString& path)
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return false;
+
+
+	QFile* file = new QFile(path);
+	if (file->open(QIODevice::WriteOnly) == false)
+	{
+		delete file;
+		return false;
+	}
+
+	QTextStream stream(file);
+
+	this->buildModel();
+
+	this->writeHeader(stream);
+	this->writeModuleHeader(stream);
+	this->writeModuleBody(stream);
+
+	file->close();
+	delete file;
+
+	return true;
+}
+
+/**
+ * @brief FsmSystemVerilogExport::buildModel analyzes the machine with
+ * the identifiers used by the generated module reserved.
+ */
+void FsmSystemVerilogExport::buildModel()
+{
+	QSet<QString> reservedNames = {"clock", "reset", "state_t", "current_state", "next_state", "module", "logic", "input", "output", "begin", "end"};
+
+	this->model.build(this->prefixSignals, this->stateEncoding, this->registerMealyOutputs, reservedNames);
+}
+
+void FsmSystemVerilogExport::writeHeader(QTextStream& stream) const
+{
+	stream << "// FSM generated with StateS v" << StateS::getVersion() << " on " << QDate::currentDate().toString() << " at " << QTime::currentTime().toString() << "\n";
+	stream << "// https://github.com/ClementFoucher/StateS\n\n\n";
+}
+
+void FsmSystemVerilogExport::writeModuleHeader(QTextStream& stream) const
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return;
+
+
+	QStringList ports = {"input  logic clock", "input  logic reset"};
+
+	for (auto& inputId : machine->getInputVariablesIds())
+	{
+		auto input = machine->getVariable(inputId);
+		if (input == nullptr) continue;
+
+
+		ports.append("input  " + this->generateTypeText(input->getSize()) + " " + this->model.getVariableName(inputId));
+	}
+
+	for (auto& outputId : machine->getOutputVariablesIds())
+	{
+		auto output = machine->getVariable(outputId);
+		if (output == nullptr) continue;
+
+
+		ports.append("output " + this->generateTypeText(output->getSize()) + " " + this->model.getVariableName(outputId));
+	}
+
+	stream << "module " << this->model.getMachineName() << "(\n";
+	stream << "  " << ports.join(",\n  ") << "\n";
+	stream << ");\n\n";
+}
+
+void FsmSystemVerilogExport::writeModuleBody(QTextStream& stream) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	this->writeStateType(stream);
+
+	stream << "  state_t current_state;\n";
+	stream << "  state_t next_state;\n\n";
+
+	for (auto& localVarId : fsm->getInternalVariablesIds())
+	{
+		auto variable = fsm->getVariable(localVarId);
+		if (variable == nullptr) continue;
+
+
+		this->writeDeclaration(stream, localVarId, this->model.getVariableName(localVarId), false, variable->getMemorized());
+	}
+
+	for (auto& outputId : this->model.getBufferedOutputsIds())
+	{
+		auto output = fsm->getVariable(outputId);
+		if (output == nullptr) continue;
+
+
+		this->writeDeclaration(stream, outputId, this->model.getOutputInternalName(outputId), false, output->getMemorized());
+	}
+
+	for (auto& variableId : this->model.getPulseRegisteredVariablesIds())
+	{
+		this->writeDeclaration(stream, variableId, this->model.getPulseRegisterName(variableId), false, true);
+	}
+
+	stream << "\n";
+
+	for (auto& constantId : fsm->getConstantsIds())
+	{
+		this->writeDeclaration(stream, constantId, this->model.getVariableName(constantId), true, false);
+	}
+
+	stream << "\n";
+
+	this->writeNextStateComputation(stream);
+
+	// Current state update
+	this->writeAlwaysFfHeader(stream);
+	stream << "      current_state <= " << this->model.getStateName(fsm->getInitialStateId()) << ";\n";
+	stream << "    else\n";
+	stream << "      current_state <= next_state;\n";
+	stream << "  end\n\n";
+
+	// Writtable variables computation: one block per variable
+	auto writtableVariablesIds = fsm->getWrittableVariablesIds();
+	for (auto& variableId : writtableVariablesIds)
+	{
+		auto variable = fsm->getVariable(variableId);
+		if (variable == nullptr) continue;
+
+
+		if (variable->getMemorized() == true)
+		{
+			this->writeMemorizedVariable(stream, variableId);
+		}
+		else
+		{
+			if (this->model.isPulseRegistered(variableId) == true)
+			{
+				this->writePulseRegister(stream, variableId);
+			}
+
+			this->writeTemporaryVariable(stream, variableId);
+		}
+	}
+
+	for (auto& outputId : this->model.getBufferedOutputsIds())
+	{
+		stream << "  assign " << this->model.getVariableName(outputId) << " = " << this->model.getOutputInternalName(outputId) << ";\n";
+	}
+
+	// The end
+	stream << "\nendmodule\n";
+}
+
+void FsmSystemVerilogExport::writeStateType(QTextStream& stream) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	QStringList statesValues;
+	for (auto& stateId : fsm->getAllStatesIds())
+	{
+		if (this->model.isStateEncoded() == false)
+		{
+			statesValues.append(this->model.getStateName(stateId));
+		}
+		else
+		{
+			statesValues.append(this->model.getStateName(stateId) + " = " + QString::number(this->model.getStateCodeSize()) + "'b" + this->model.getStateCode(stateId));
+		}
+	}
+
+	if (this->model.isStateEncoded() == false)
+	{
+		// Symbolic encoding: let the synthesizer choose
+		stream << "  typedef enum {\n";
+	}
+	else
+	{
+		stream << "  typedef enum " << this->generateTypeText(this->model.getStateCodeSize()) << " {\n";
+	}
+
+	stream << "    " << statesValues.join(",\n    ") << "\n";
+	stream << "  } state_t;\n\n";
+}
+
+/**
+ * @brief FsmSystemVerilogExport::writeDeclaration declares a variable.
+ * Only registers are given their initial value on declaration: other
+ * variables are entirely driven by their always_comb block.
+ */
+void FsmSystemVerilogExport::writeDeclaration(QTextStream& stream, componentId_t variableId, const QString& name, bool isConstant, bool isRegister) const
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return;
+
+	auto variable = machine->getVariable(variableId);
+	if (variable == nullptr) return;
+
+
+	stream << "  ";
+
+	if (isConstant == true)
+	{
+		stream << "localparam ";
+	}
+
+	stream << this->generateTypeText(variable->getSize()) << " " << name;
+
+	if ( (isConstant == true) || (isRegister == true) )
+	{
+		stream << " = " << this->generateValueText(variable->getInitialValue());
+	}
+
+	stream << ";\n";
+}
+
+void FsmSystemVerilogExport::writeNextStateComputation(QTextStream& stream) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	stream << "  // Next step computation\n";
+	stream << "  always_comb begin\n";
+
+	// Machine stays in current state when no transition condition is true
+	stream << "    next_state = current_state;\n";
+
+	stream << "    case (current_state)\n";
+
+	for (auto& stateId : fsm->getAllStatesIds())
+	{
+		auto state = fsm->getState(stateId);
+
+		stream << "      " << this->model.getStateName(stateId) << ": begin\n";
+
+		auto transitionsIds = state->getOutgoingTransitionsIds();
+		for (auto& transitionId : transitionsIds)
+		{
+			stream << "        ";
+
+			if (transitionId != transitionsIds.first())
+				stream << "else ";
+
+			auto transition = fsm->getTransition(transitionId);
+
+			stream << "if (" << this->generateConditionText(transition) << ")\n";
+			stream << "          next_state = " << this->model.getStateName(transition->getTargetStateId()) << ";\n";
+		}
+
+		stream << "      end\n";
+	}
+
+	if (this->model.isStateEncoded() == true)
+	{
+		// Encoded state vector has unused and meta values: recover to initial state
+		stream << "      default:\n";
+		stream << "        next_state = " << this->model.getStateName(fsm->getInitialStateId()) << ";\n";
+	}
+
+	stream << "    endcase\n";
+	stream << "  end\n\n";
+}
+
+/**
+ * @brief FsmSystemVerilogExport::writeTemporaryVariable writes the
+ * combinatorial block of a non-memorized variable: initial value (or
+ * registered pulse value), overridden by the continuous actions of the
+ * current state, then by the pulse actions of the transition to be crossed.
+ */
+void FsmSystemVerilogExport::writeTemporaryVariable(QTextStream& stream, componentId_t variableId) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+	auto variable = fsm->getVariable(variableId);
+	if (variable == nullptr) return;
+
+
+	QString targetName = this->model.getVariableDrivenName(variableId);
+	bool isPulseRegistered = this->model.isPulseRegistered(variableId);
+
+	stream << "  // " << targetName << "\n";
+	stream << "  always_comb begin\n";
+
+	if (isPulseRegistered == true)
+	{
+		stream << "    " << targetName << " = " << this->model.getPulseRegisterName(variableId) << ";\n";
+	}
+	else
+	{
+		stream << "    " << targetName << " = " << this->generateValueText(variable->getInitialValue()) << ";\n";
+	}
+
+	bool hasMooreActions = (this->model.getMooreActuators(variableId).isEmpty() == false);
+	bool hasMealyActions = ( (this->model.getMealyActuators(variableId).isEmpty() == false) && (isPulseRegistered == false) );
+	if ( (hasMooreActions == true) || (hasMealyActions == true) )
+	{
+		stream << "    case (current_state)\n";
+
+		for (auto& stateId : fsm->getAllStatesIds())
+		{
+			this->writeStateActions(stream, stateId, variableId, targetName, hasMealyActions, true, "      ");
+		}
+
+		stream << "      default: ;\n";
+		stream << "    endcase\n";
+	}
+
+	stream << "  end\n\n";
+}
+
+/**
+ * @brief FsmSystemVerilogExport::writeMemorizedVariable writes the
+ * register of a memorized variable, updated on clock edge by the actions
+ * of the current state, then by the actions of the transition crossed.
+ */
+void FsmSystemVerilogExport::writeMemorizedVariable(QTextStream& stream, componentId_t variableId) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+	auto variable = fsm->getVariable(variableId);
+	if (variable == nullptr) return;
+
+
+	QString targetName = this->model.getVariableDrivenName(variableId);
+
+	stream << "  // " << targetName << "\n";
+	this->writeAlwaysFfHeader(stream);
+	stream << "      " << targetName << " <= " << this->generateValueText(variable->getInitialValue()) << ";\n";
+
+	bool hasMooreActions = (this->model.getMooreActuators(variableId).isEmpty() == false);
+	bool hasMealyActions = (this->model.getMealyActuators(variableId).isEmpty() == false);
+	if ( (hasMooreActions == true) || (hasMealyActions == true) )
+	{
+		stream << "    else begin\n";
+		stream << "      case (current_state)\n";
+
+		for (auto& stateId : fsm->getAllStatesIds())
+		{
+			this->writeStateActions(stream, stateId, variableId, targetName, hasMealyActions, false, "        ");
+		}
+
+		stream << "        default: ;\n";
+		stream << "      endcase\n";
+		stream << "    end\n";
+	}
+
+	stream << "  end\n\n";
+}
+
+/**
+ * @brief FsmSystemVerilogExport::writePulseRegister writes the register
+ * holding the pulse actions of the transition crossed during one cycle.
+ */
+void FsmSystemVerilogExport::writePulseRegister(QTextStream& stream, componentId_t variableId) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+	auto variable = fsm->getVariable(variableId);
+	if (variable == nullptr) return;
+
+
+	QString targetName = this->model.getPulseRegisterName(variableId);
+	QString initialValue = this->generateValueText(variable->getInitialValue());
+
+	stream << "  // " << targetName << "\n";
+	this->writeAlwaysFfHeader(stream);
+	stream << "      " << targetName << " <= " << initialValue << ";\n";
+	stream << "    else begin\n";
+	stream << "      " << targetName << " <= " << initialValue << ";\n";
+	stream << "      case (current_state)\n";
+
+	for (auto& stateId : fsm->getAllStatesIds())
+	{
+		if (this->model.getLastActingTransitionIndex(stateId, variableId) < 0) continue;
+
+
+		stream << "        " << this->model.getStateName(stateId) << ": begin\n";
+		this->writeTransitionsActions(stream, stateId, variableId, targetName, false, "          ");
+		stream << "        end\n";
+	}
+
+	stream << "        default: ;\n";
+	stream << "      endcase\n";
+	stream << "    end\n";
+	stream << "  end\n\n";
+}
+
+void FsmSystemVerilogExport::writeAlwaysFfHeader(QTextStream& stream) const
+{
+	if (this->resetLogicPositive == true)
+	{
+		stream << "  always_ff @(posedge clock or posedge reset) begin\n";
+		stream << "    if (reset == 1'b1)\n";
+	}
+	else
+	{
+		stream << "  always_ff @(posedge clock or negedge reset) begin\n";
+		stream << "    if (reset == 1'b0)\n";
+	}
+}
+
+/**
+ * @brief FsmSystemVerilogExport::writeStateActions writes the case
+ * item of a state acting on the variable, if any: state actions, then
+ * actions of the transitions leaving the state if requested.
+ */
+void FsmSystemVerilogExport::writeStateActions(QTextStream& stream, componentId_t stateId, componentId_t variableId, const QString& targetName, bool withMealyActions, bool isBlocking, const QString& indent) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+	auto state = fsm->getState(stateId);
+	if (state == nullptr) return;
+
+
+	bool hasMooreActions = this->model.getMooreActuators(variableId).contains(stateId);
+	bool hasMealyActions = ( (withMealyActions == true) && (this->model.getLastActingTransitionIndex(stateId, variableId) >= 0) );
+
+	if ( (hasMooreActions == false) && (hasMealyActions == false) ) return;
+
+
+	stream << indent << this->model.getStateName(stateId) << ": begin\n";
+
+	for (auto& action : state->getActions())
+	{
+		if (action->getVariableActedOnId() == variableId)
+		{
+			this->writeAssignment(stream, action, targetName, isBlocking, indent + "  ");
+		}
+	}
+
+	if (hasMealyActions == true)
+	{
+		this->writeTransitionsActions(stream, stateId, variableId, targetName, isBlocking, indent + "  ");
+	}
+
+	stream << indent << "end\n";
+}
+
+/**
+ * @brief FsmSystemVerilogExport::writeTransitionsActions writes the actions
+ * on a variable of the transitions leaving a state. Transitions are tested
+ * in the same priority order as in next state computation, thus preceding
+ * transitions not acting on the variable are kept.
+ */
+void FsmSystemVerilogExport::writeTransitionsActions(QTextStream& stream, componentId_t stateId, componentId_t variableId, const QString& targetName, bool isBlocking, const QString& indent) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+	auto state = fsm->getState(stateId);
+	if (state == nullptr) return;
+
+
+	auto transitionsIds = state->getOutgoingTransitionsIds();
+
+	int lastActingTransition = this->model.getLastActingTransitionIndex(stateId, variableId);
+	if (lastActingTransition < 0) return;
+
+
+	for (int i = 0 ; i <= lastActingTransition ; i++)
+	{
+		auto transition = fsm->getTransition(transitionsIds.at(i));
+
+		stream << indent;
+
+		if (i != 0)
+			stream << "else ";
+
+		stream << "if (" << this->generateConditionText(transition) << ") begin\n";
+
+		for (auto& action : transition->getActions())
+		{
+			if (action->getVariableActedOnId() == variableId)
+			{
+				this->writeAssignment(stream, action, targetName, isBlocking, indent + "  ");
+			}
+		}
+
+		stream << indent << "end\n";
+	}
+}
+
+void FsmSystemVerilogExport::writeAssignment(QTextStream& stream, shared_ptr<ActionOnVariable> action, const QString& targetName, bool isBlocking, const QString& indent) const
+{
+	ActionOnVariableType_t type = action->getActionType();
+	if (type == ActionOnVariableType_t::none) return;
+
+
+	QString target = targetName + this->generateRangeText(action->getActionRangeL(), action->getActionRangeR());
+
+	stream << indent << target << ((isBlocking == true) ? " = " : " <= ");
+
+	switch(type)
+	{
+	case ActionOnVariableType_t::continuous:
+	case ActionOnVariableType_t::pulse:
+	case ActionOnVariableType_t::assign:
+	case ActionOnVariableType_t::set:
+	case ActionOnVariableType_t::reset:
+		stream << this->generateValueText(action->getActionValue());
+		break;
+	case ActionOnVariableType_t::increment:
+		stream << target << " + 1'b1";
+		break;
+	case ActionOnVariableType_t::decrement:
+		stream << target << " - 1'b1";
+		break;
+	case ActionOnVariableType_t::none:
+		// Handled above
+		break;
+	}
+
+	stream << ";\n";
+}
+
+QString FsmSystemVerilogExport::generateConditionText(shared_ptr<FsmTransition> transition) const
+{
+	auto condition = transition->getCondition();
+	if (condition == nullptr)
+	{
+		// Empty condition is considered always true
+		return "1'b1";
+	}
+	else
+	{
+		return this->generateEquationText(condition) + " == 1'b1";
+	}
+}
+
+QString FsmSystemVerilogExport::generateTypeText(uint size) const
+{
+	if (size > 1)
+	{
+		return "logic [" + QString::number(size - 1) + ":0]";
+	}
+	else
+	{
+		return "logic";
+	}
+}
+
+QString FsmSystemVerilogExport::generateValueText(const LogicValue& value) const
+{
+	return QString::number(value.getSize()) + "'b" + value.toString();
+}
+
+QString FsmSystemVerilogExport::generateRangeText(int rangeL, int rangeR) const
+{
+	if (rangeL < 0)
+	{
+		return QString();
+	}
+	else if (rangeR < 0)
+	{
+		return "[" + QString::number(rangeL) + "]";
+	}
+	else
+	{
+		return "[" + QString::number(rangeL) + ":" + QString::number(rangeR) + "]";
+	}
+}
+
+QString FsmSystemVerilogExport::generateEquationText(shared_ptr<Equation> equation) const
+{
+	if (equation == nullptr)  return "[" + tr("Error: empty equation") + "]";
+
+
+	QString text;
+
+	OperatorType_t function = equation->getOperatorType();
+	if (function == OperatorType_t::identity) // Equation is actually a single variable or constant
+	{
+		// This should only happen at condition root for a well-formed condition
+		auto operand = equation->getOperand(0);
+		text = this->generateOperandText(operand);
+	}
+	else if (function == OperatorType_t::extractOp)
+	{
+		auto operand = equation->getOperand(0);
+		text = this->generateOperandText(operand);
+
+		if ( (operand != nullptr) && (operand->getSource() == OperandSource_t::variable) )
+		{
+			text += this->generateRangeText(equation->getRangeL(), equation->getRangeR());
+		}
+		else if (equation->getRangeL() >= 0)
+		{
+			// Only variables can be sliced: shift expressions and constants then cast to range size
+			int rangeL = equation->getRangeL();
+			int rangeR = (equation->getRangeR() < 0) ? rangeL : equation->getRangeR();
+
+			text = QString::number(rangeL - rangeR + 1) + "'((" + text + ") >> " + QString::number(rangeR) + ")";
+		}
+	}
+	else if (function == OperatorType_t::notOp)
+	{
+		auto operand = equation->getOperand(0);
+		text = "~" + this->generateOperandText(operand);
+	}
+	else
+	{
+		QStringList operandsTexts;
+		for (uint i = 0 ; i < equation->getOperandCount() ; i++)
+		{
+			operandsTexts.append(this->generateOperandText(equation->getOperand(i)));
+		}
+
+		switch(function)
+		{
+		case OperatorType_t::andOp:
+			text = "(" + operandsTexts.join(" & ") + ")";
+			break;
+		case OperatorType_t::orOp:
+			text = "(" + operandsTexts.join(" | ") + ")";
+			break;
+		case OperatorType_t::xorOp:
+			text = "(" + operandsTexts.join(" ^ ") + ")";
+			break;
+		case OperatorType_t::nandOp:
+			text = "~(" + operandsTexts.join(" & ") + ")";
+			break;
+		case OperatorType_t::norOp:
+			text = "~(" + operandsTexts.join(" | ") + ")";
+			break;
+		case OperatorType_t::xnorOp:
+			text = "~(" + operandsTexts.join(" ^ ") + ")";
+			break;
+		case OperatorType_t::equalOp:
+			text = "(" + operandsTexts.join(" == ") + ")";
+			break;
+		case OperatorType_t::diffOp:
+			text = "(" + operandsTexts.join(" != ") + ")";
+			break;
+		case OperatorType_t::concatOp:
+			text = "{" + operandsTexts.join(", ") + "}";
+			break;
+		case OperatorType_t::extractOp:
+		case OperatorType_t::notOp:
+		case OperatorType_t::identity:
+			// Cases treated in another branch of the if
+			break;
+		}
+	}
+
+	return text;
+}
+
+QString FsmSystemVerilogExport::generateOperandText(shared_ptr<Operand> operand) const
+{
+	if (operand == nullptr) return "[" + tr("Error: empty operand") + "]";
+
+
+	switch (operand->getSource())
+	{
+	case OperandSource_t::equation:
+		return this->generateEquationText(operand->getEquation());
+		break;
+	case OperandSource_t::variable:
+	{
+		auto variableId = operand->getVariableId();
+		return this->model.getVariableDrivenName(variableId);
+		break;
+	}
+	case OperandSource_t::constant:
+	{
+		auto constantText = operand->getText();
+		return QString::number(constantText.size()) + "'b" + constantText;
+		break;
+	}
+	}
+
+	return QString();
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMSYSTEMVERILOGEXPORT_H
+#define FSMSYSTEMVERILOGEXPORT_H
+
+// Parent
+#include <QObject>
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QStringList>
+class QString;
+class QTextStream;
+
+// StateS classes
+#include "statestypes.h"
+#include "fsmhdlmodel.h"
+class LogicValue;
+class ActionOnVariable;
+class Equation;
+class Operand;
+class FsmTransition;
+
+
+/**
+ * @brief The FsmSystemVerilogExport class generates a SystemVerilog
+ * module of the current FSM from its FsmHdlModel analysis. It has the
+ * same ports and behavior as the entity generated by FsmVhdlExport.
+ *
+ * Combinatorial logic is described in always_comb blocks using blocking
+ * assignments, and registers in always_ff blocks using non-blocking
+ * assignments, each writtable variable in its own block.
+ */
+class FsmSystemVerilogExport : public QObject
+{
+	Q_OBJECT
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmSystemVerilogExport() = default;
+
+	/////
+	// Object functions
+public:
+	void setOptions(bool resetLogicPositive, bool prefixSignals, HdlStateEncoding_t stateEncoding, bool registerMealyOutputs);
+
+	bool writeToFile(const QString& path);
+
+private:
+	void buildModel();
+
+	void writeHeader(QTextStream& stream) const;
+	void writeModuleHeader(QTextStream& stream) const;
+	void writeModuleBody(QTextStream& stream) const;
+	void writeStateType(QTextStream& stream) const;
+	void writeDeclaration(QTextStream& stream, componentId_t variableId, const QString& name, bool isConstant, bool isRegister) const;
+	void writeNextStateComputation(QTextStream& stream) const;
+	void writeTemporaryVariable(QTextStream& stream, componentId_t variableId) const;
+	void writeMemorizedVariable(QTextStream& stream, componentId_t variableId) const;
+	void writePulseRegister(QTextStream& stream, componentId_t variableId) const;
+
+	void writeAlwaysFfHeader(QTextStream& stream) const;
+	void writeStateActions(QTextStream& stream, componentId_t stateId, componentId_t variableId, const QString& targetName, bool withMealyActions, bool isBlocking, const QString& indent) const;
+	void writeTransitionsActions(QTextStream& stream, componentId_t stateId, componentId_t variableId, const QString& targetName, bool isBlocking, const QString& indent) const;
+	void writeAssignment(QTextStream& stream, shared_ptr<ActionOnVariable> action, const QString& targetName, bool isBlocking, const QString& indent) const;
+
+	QString generateConditionText(shared_ptr<FsmTransition> transition) const;
+	QString generateTypeText(uint size) const;
+	QString generateValueText(const LogicValue& value) const;
+	QString generateRangeText(int rangeL, int rangeR) const;
+	QString generateEquationText(shared_ptr<Equation> equation) const;
+	QString generateOperandText(shared_ptr<Operand> operand) const;
+
+	/////
+	// Object variables
+private:
+	bool resetLogicPositive   = true;
+	bool prefixSignals        = false;
+	bool registerMealyOutputs = false;
+	HdlStateEncoding_t stateEncoding = HdlStateEncoding_t::symbolic;
+
+	FsmHdlModel model;
+
+};
+
+#endif // FSMSYSTEMVERILOGEXPORT_H
@@ -38,12 +38,15 @@
 #include "equation.h"
 #include "actiononvariable.h"
 #include "operand.h"
+#include "simulatedmachine.h"
 
 
-void FsmVhdlExport::setOptions(bool resetLogicPositive, bool prefixSignals)
+void FsmVhdlExport::setOptions(bool resetLogicPositive, bool prefixSignals, HdlStateEncoding_t stateEncoding, bool registerMealyOutputs)
 {
-	this->resetLogicPositive = resetLogicPositive;
-	this->prefixSignals = prefixSignals;
+	this->resetLogicPositive   = resetLogicPositive;
+	this->prefixSignals        = prefixSignals;
+	this->stateEncoding        = stateEncoding;
+	this->registerMealyOutputs = registerMealyOutputs;
 }
 
 bool FsmVhdlExport::writeToFile(const QString& path)
@@ -53,11 +56,15 @@ bool FsmVhdlExport::writeToFile(const QString& path)
 
 
 	QFile* file = new QFile(path);
-	file->open(QIODevice::WriteOnly);
+	if (file->open(QIODevice::WriteOnly) == false)
+	{
+		delete file;
+		return false;
+	}
 
 	QTextStream stream(file);
 
-	this->generateVhdlCharacteristics();
+	this->buildModel();
 
 	this->writeHeader(stream);
 	this->writeEntity(stream);
@@ -69,709 +76,933 @@ bool FsmVhdlExport::writeToFile(const QString& path)
 	return true;
 }
 
-shared_ptr<FsmVhdlExport::ExportCompatibility> FsmVhdlExport::checkCompatibility()
+/**
+ * @brief FsmVhdlExport::writeTestbenchToFile writes a testbench
+ * instantiating the entity generated by writeToFile with the same
+ * options, and replaying the trace on it.
+ * @return False if the trace is empty or if the simulator actions
+ * behavior does not match the generated VHDL.
+ */
+bool FsmVhdlExport::writeTestbenchToFile(const QString& path, const SimulationHistory::Trace_t& trace)
 {
 	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
-	if (fsm == nullptr) return nullptr;
-
-
-	shared_ptr<ExportCompatibility> compatibility(new ExportCompatibility());
-	WrittableVariableCharacteristics_t charac;
+	if (fsm == nullptr) return false;
 
-	for (auto& outputId : fsm->getOutputVariablesIds())
-	{
-		charac = this->determineWrittableVariableCharacteristics(outputId, false);
+	if (trace.stepsInputs.isEmpty() == true) return false;
 
-		if (charac.isMoore && charac.isMealy)
-		{
-			compatibility->bothMooreAndMealy.append(outputId);
-		}
+	if (this->matchesSimulationBehavior() == false) return false;
 
-		if (charac.isRangeAdressed)
-		{
-			compatibility->rangeAdressed.append(outputId);
-		}
 
-		if (charac.isMealy && charac.isKeepValue)
-		{
-			compatibility->mealyWithKeep.append(outputId);
-		}
-	}
-	for (auto& variableId : fsm->getInternalVariablesIds())
+	QFile* file = new QFile(path);
+	if (file->open(QIODevice::WriteOnly) == false)
 	{
-		charac = this->determineWrittableVariableCharacteristics(variableId, false);
+		delete file;
+		return false;
+	}
 
-		if (charac.isMoore && charac.isMealy)
-		{
-			compatibility->bothMooreAndMealy.append(variableId);
-		}
+	QTextStream stream(file);
 
-		if (charac.isRangeAdressed)
-		{
-			compatibility->rangeAdressed.append(variableId);
-		}
+	this->buildModel();
 
-		if (charac.isMealy && charac.isKeepValue)
-		{
-			compatibility->mealyWithKeep.append(variableId);
-		}
-	}
+	this->writeTestbenchHeader(stream, trace.stepsInputs.count());
+	this->writeTestbench(stream, trace);
 
-	return compatibility;
+	file->close();
+	delete file;
+
+	return true;
 }
 
-void FsmVhdlExport::generateVhdlCharacteristics()
+/**
+ * @brief FsmVhdlExport::matchesSimulationBehavior checks that the
+ * simulator actions behavior is the one described by the generated
+ * VHDL with the current options, i.e. that outputs obtained in the
+ * simulator are those the generated entity produces.
+ */
+bool FsmVhdlExport::matchesSimulationBehavior() const
 {
-	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
-	if (fsm == nullptr) return;
+	auto simulatedMachine = machineManager->getSimulatedMachine();
+	if (simulatedMachine == nullptr) return false;
 
 
-	// Machine
-	this->machineVhdlName = this->cleanNameForVhdl(fsm->getName());
+	if (simulatedMachine->getMemorizedStateActionBehavior()      != SimulationBehavior_t::after)       return false;
+	if (simulatedMachine->getContinuousStateActionBehavior()     != SimulationBehavior_t::immediately) return false;
+	if (simulatedMachine->getMemorizedTransitionActionBehavior() != SimulationBehavior_t::immediately) return false;
 
-	// States
-	for (auto& stateId : fsm->getAllStatesIds())
+	if (this->registerMealyOutputs == true)
 	{
-		auto state = fsm->getState(stateId);
+		return (simulatedMachine->getPulseTransitionActionBehavior() == SimulationBehavior_t::immediately);
+	}
+	else
+	{
+		return (simulatedMachine->getPulseTransitionActionBehavior() == SimulationBehavior_t::prepare);
+	}
+}
 
-		QString stateRadical = "S_";
+/**
+ * @brief FsmVhdlExport::buildModel analyzes the machine with
+ * the identifiers used by the generated architecture reserved.
+ */
+void FsmVhdlExport::buildModel()
+{
+	QSet<QString> reservedNames = {"clock", "reset", "state_type", "current_state", "next_state", "fsm_body", "compute_next_step", "update_state"};
 
-		stateRadical += cleanNameForVhdl(state->getName());
+	this->model.build(this->prefixSignals, this->stateEncoding, this->registerMealyOutputs, reservedNames);
+}
 
-		// Check for duplicates
-		int occurence = 2;
-		QString stateName = stateRadical;
-		auto statesNames = this->stateVhdlName.values();
-		while (statesNames.contains(stateName))
-		{
-			stateName = stateRadical + QString::number(occurence);
-			occurence++;
-		}
+void FsmVhdlExport::writeHeader(QTextStream& stream) const
+{
+	stream << "-- FSM generated with StateS v" << StateS::getVersion() << " on " << QDate::currentDate().toString() << " at " << QTime::currentTime().toString() << "\n";
+	stream << "-- https://github.com/ClementFoucher/StateS\n\n";
+
+	stream << "library IEEE;\n";
+	stream << "use IEEE.std_logic_1164.all;\n";
+	stream << "use IEEE.numeric_std.all;\n\n\n";
+}
+
+void FsmVhdlExport::writeEntity(QTextStream& stream) const
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return;
 
-		this->stateVhdlName[stateId] = stateName;
-	}
 
-	// Variables
-	QString signalName;
+	QStringList ports = {"clock : in std_logic", "reset : in std_logic"};
 
-	for (auto& inputId : fsm->getInputVariablesIds())
+	for (auto& inputId : machine->getInputVariablesIds())
 	{
-		auto input = fsm->getVariable(inputId);
+		auto input = machine->getVariable(inputId);
 		if (input == nullptr) continue;
 
 
-		signalName = this->generateVhdlSignalName("I_", input->getName());
-		this->variableVhdlName[inputId] = signalName;
+		ports.append(this->model.getVariableName(inputId) + " : in " + this->generateTypeText(input->getSize()));
 	}
-	for (auto& outputId : fsm->getOutputVariablesIds())
+
+	for (auto& outputId : machine->getOutputVariablesIds())
 	{
-		auto output = fsm->getVariable(outputId);
+		auto output = machine->getVariable(outputId);
 		if (output == nullptr) continue;
 
 
-		signalName = this->generateVhdlSignalName("O_", output->getName());
-		this->determineWrittableVariableCharacteristics(outputId, true);
-		this->variableVhdlName[outputId] = signalName;
+		ports.append(this->model.getVariableName(outputId) + " : out " + this->generateTypeText(output->getSize()));
 	}
-	for (auto& variableId : fsm->getInternalVariablesIds())
-	{
-		auto variable = fsm->getVariable(variableId);
-		if (variable == nullptr) continue;
 
+	stream << "entity " << this->model.getMachineName() << " is\n";
+	stream << "  port(" << ports.join(";\n       ") << ");\n";
+	stream << "end entity;\n\n\n";
+}
 
-		signalName = this->generateVhdlSignalName("SIG_", variable->getName());
-		this->determineWrittableVariableCharacteristics(variableId, true);
-		this->variableVhdlName[variableId] = signalName;
-	}
-	for (auto& constantId : fsm->getConstantsIds())
-	{
-		auto constant = fsm->getVariable(constantId);
-		if (constant == nullptr) continue;
+void FsmVhdlExport::writeArchitecture(QTextStream& stream) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
 
 
-		signalName = this->generateVhdlSignalName("CONST_", constant->getName());
-		this->variableVhdlName[constantId] = signalName;
-	}
-}
+	stream << "architecture FSM_body of " << this->model.getMachineName() << " is\n\n";
 
-FsmVhdlExport::WrittableVariableCharacteristics_t FsmVhdlExport::determineWrittableVariableCharacteristics(componentId_t variableId, bool storeResults)
-{
-	WrittableVariableCharacteristics_t characteristics;
+	this->writeStateType(stream);
 
-	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
-	if (fsm == nullptr) return characteristics;
+	stream << "  signal current_state : state_type;\n";
+	stream << "  signal next_state    : state_type;\n\n";
 
-	auto variable = fsm->getVariable(variableId);
-	if (variable == nullptr) return characteristics;
+	for (auto& localVarId : fsm->getInternalVariablesIds())
+	{
+		this->writeSignalDeclaration(stream, localVarId, this->model.getVariableName(localVarId), false);
+	}
 
+	for (auto& outputId : this->model.getBufferedOutputsIds())
+	{
+		this->writeSignalDeclaration(stream, outputId, this->model.getOutputInternalName(outputId), false);
+	}
 
-	if (variable->getMemorized() == true)
+	for (auto& variableId : this->model.getPulseRegisteredVariablesIds())
 	{
-		characteristics.isKeepValue = true;
+		this->writeSignalDeclaration(stream, variableId, this->model.getPulseRegisterName(variableId), false);
 	}
-	else // (variable->getMemorized() == false)
+
+	stream << "\n";
+
+	for (auto& constantId : fsm->getConstantsIds())
 	{
-		characteristics.isTempValue = true;
+		this->writeSignalDeclaration(stream, constantId, this->model.getVariableName(constantId), true);
 	}
 
-	bool doNotGenerate = !storeResults;
+	stream << "\nbegin\n\n";
+
+	// Next step computation : asynchronous process
+	this->writeProcessHeader(stream, "compute_next_step", QStringList("current_state") + this->getAsynchronousSensitivityList());
+
+	stream << "  begin\n";
+
+	// Machine stays in current state when no transition condition is true
+	stream << "    next_state <= current_state;\n";
+
+	stream << "    case current_state is\n";
 
 	for (auto& stateId : fsm->getAllStatesIds())
 	{
 		auto state = fsm->getState(stateId);
 
-		for (auto& action : state->getActions())
-		{
-			if (action->getVariableActedOnId() == variableId)
-			{
-				characteristics.isMoore = true;
+		stream << "    when ";
+		stream << this->model.getStateName(stateId);
+		stream << " =>\n";
 
-				if (action->getActionRangeL() != -1)
-				{
-					characteristics.isRangeAdressed = true;
-				}
-			}
-		}
-	}
+		auto transitionsIds = state->getOutgoingTransitionsIds();
+		for (auto& transitionId : transitionsIds)
+		{
+			stream << "      ";
 
-	for (auto& transitionId : fsm->getAllTransitionsIds())
-	{
-		auto transition = fsm->getTransition(transitionId);
+			if (transitionId != transitionsIds.first())
+				stream << "els";
 
-		for (auto& action : transition->getActions())
-		{
-			if (action->getVariableActedOnId() == variableId)
-			{
-				characteristics.isMealy = true;
+			stream << "if ";
 
-				if (action->getActionRangeL() != -1)
-				{
-					characteristics.isRangeAdressed = true;
-				}
-			}
-		}
-	}
+			auto transition = fsm->getTransition(transitionId);
 
-	if (characteristics.isMealy && characteristics.isMoore)
-	{
-		doNotGenerate = true;
-	}
-	else if (characteristics.isRangeAdressed)
-	{
-		doNotGenerate = true;
-	}
+			stream << this->generateConditionText(transition);
 
-	if (!doNotGenerate)
-	{
-		if (characteristics.isMoore)
-		{
-			this->mooreVariables.append(variableId);
-		}
-		else if (characteristics.isMealy)
-		{
-			this->mealyVariables.append(variableId);
+			stream << " then\n";
+			stream << "        next_state <= " << this->model.getStateName(transition->getTargetStateId()) << ";\n";
 		}
 
-		if (characteristics.isTempValue)
+		if (transitionsIds.isEmpty() == false)
 		{
-			this->tempValueVariables.append(variableId);
+			stream << "      end if;\n";
 		}
-		else if (characteristics.isKeepValue)
+		else
 		{
-			this->keepValueVariables.append(variableId);
+			stream << "      null;\n";
 		}
+	}
 
-//		if (variableIsRangeAdressed)
-//		{
-//			this->rangeAdressedVariables.append(variableId);
-//		}
+	if (this->model.isStateEncoded() == true)
+	{
+		// Encoded state vector has unused and meta values: recover to initial state
+		stream << "    when others =>\n";
+		stream << "      next_state <= " << this->model.getStateName(fsm->getInitialStateId()) << ";\n";
 	}
 
-	return characteristics;
-}
+	stream << "    end case;\n";
 
-QString FsmVhdlExport::generateVhdlSignalName(const QString& prefix, const QString& name) const
-{
-	QString signalRadical;
+	stream << "  end process;\n\n";
 
-	if (this->prefixSignals)
-	{
-		signalRadical += prefix;
-	}
+	// Current state update : synchronous process
+
+	stream << "  update_state : process(clock, reset)\n";
+	stream << "  begin\n";
+	this->writeResetCondition(stream);
+	stream << "      current_state <= " << this->model.getStateName(fsm->getInitialStateId()) << ";\n";
+	stream << "    elsif rising_edge(clock) then\n";
+	stream << "      current_state <= next_state;\n";
+	stream << "    end if;\n";
+	stream << "  end process;\n\n";
 
-	signalRadical += cleanNameForVhdl(name);
 
-	// Check for duplicates
-	int occurence = 2;
-	QString signalName = signalRadical;
-	auto vhdlNames = this->variableVhdlName.values();
-	while (vhdlNames.contains(signalName))
+	// Writtable variables computation: one process per variable
+
+	auto writtableVariablesIds = fsm->getWrittableVariablesIds();
+	for (auto& variableId : writtableVariablesIds)
 	{
-		signalName = signalRadical + QString::number(occurence);
-		occurence++;
-	}
+		auto variable = fsm->getVariable(variableId);
+		if (variable == nullptr) continue;
 
-	return signalName;
-}
 
-QString FsmVhdlExport::cleanNameForVhdl(const QString& name) const
-{
-	// TODO
-	QString newName = name;
+		if (variable->getMemorized() == true)
+		{
+			this->writeMemorizedVariable(stream, variableId);
+		}
+		else
+		{
+			if (this->model.isPulseRegistered(variableId) == true)
+			{
+				this->writePulseRegister(stream, variableId);
+			}
 
-	newName.replace(" ", "_");
-	newName.replace("#", "_");
+			this->writeTemporaryVariable(stream, variableId);
+		}
+	}
 
-	while (newName.contains("__"))
+	for (auto& outputId : this->model.getBufferedOutputsIds())
 	{
-		newName.replace("__", "_");
+		stream << "  " << this->model.getVariableName(outputId) << " <= " << this->model.getOutputInternalName(outputId) << ";\n";
 	}
 
-	return newName;
-}
-
-void FsmVhdlExport::writeHeader(QTextStream& stream) const
-{
-	stream << "-- FSM generated with StateS v" << StateS::getVersion() << " on " << QDate::currentDate().toString() << " at " << QTime::currentTime().toString() << "\n";
-	stream << "-- https://github.com/ClementFoucher/StateS\n\n";
-
-	stream << "library IEEE;\n";
-	stream << "use IEEE.std_logic_1164.all;\n\n\n";
+	// The end
+	stream << "\nend architecture;\n";
 }
 
-void FsmVhdlExport::writeEntity(QTextStream& stream) const
+void FsmVhdlExport::writeStateType(QTextStream& stream) const
 {
-	auto machine = machineManager->getMachine();
-	if (machine == nullptr) return;
-
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
 
-	stream << "entity " << this->machineVhdlName << " is\n";
 
-	stream << "  port(clock : in std_logic;\n       reset : in std_logic;\n       ";
+	auto statesIds = fsm->getAllStatesIds();
 
-	for (auto& inputId : machine->getInputVariablesIds())
+	if (this->model.isStateEncoded() == false)
 	{
-		auto input = machine->getVariable(inputId);
-		if (input == nullptr) continue;
-
-
-		stream << this->variableVhdlName[inputId] << " : in std_logic";
-
-		if (input->getSize() > 1)
+		// Symbolic encoding: let the synthesizer choose
+		QStringList statesNames;
+		for (auto& stateId : statesIds)
 		{
-			stream << "_vector(";
-
-			stream << QString::number(input->getSize() - 1) << " downto 0)";
+			statesNames.append(this->model.getStateName(stateId));
 		}
 
-		stream << ";\n       ";
+		stream << "  type state_type is (" << statesNames.join(", ") << ");\n\n";
 	}
-
-	auto outputIds = machine->getOutputVariablesIds();
-	for (auto& outputId : outputIds)
+	else
 	{
-		auto output = machine->getVariable(outputId);
-		if (output == nullptr) continue;
-
+		stream << "  subtype state_type is std_logic_vector(" << QString::number(this->model.getStateCodeSize() - 1) << " downto 0);\n\n";
 
-		stream << this->variableVhdlName[outputId] << " : out std_logic";
-
-		if (output->getSize() > 1)
+		for (auto& stateId : statesIds)
 		{
-			stream << "_vector(";
-
-			stream << QString::number(output->getSize() - 1) << " downto 0)";
+			stream << "  constant " << this->model.getStateName(stateId) << " : state_type := \"" << this->model.getStateCode(stateId) << "\";\n";
 		}
 
-		if (outputId == outputIds.last())
-		{
-			stream << ");\n";
-		}
-		else
-		{
-			stream << ";\n       ";
-		}
+		stream << "\n";
 	}
+}
 
+void FsmVhdlExport::writeSignalDeclaration(QTextStream& stream, componentId_t variableId, const QString& signalName, bool isConstant) const
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return;
 
-	stream << "end entity;\n\n\n";
+	auto variable = machine->getVariable(variableId);
+	if (variable == nullptr) return;
+
+
+	if (isConstant == true)
+	{
+		stream << "  constant ";
+	}
+	else
+	{
+		stream << "  signal ";
+	}
+
+	stream << signalName << " : " << this->generateTypeText(variable->getSize());
+	stream << " := " << this->generateValueText(variable->getInitialValue()) << ";\n";
 }
 
-void FsmVhdlExport::writeArchitecture(QTextStream& stream) const
+/**
+ * @brief FsmVhdlExport::writeTemporaryVariable writes the combinatorial
+ * process of a non-memorized variable: initial value (or registered
+ * pulse value), overridden by the continuous actions of the current
+ * state, then by the pulse actions of the transition to be crossed.
+ */
+void FsmVhdlExport::writeTemporaryVariable(QTextStream& stream, componentId_t variableId) const
 {
 	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
 	if (fsm == nullptr) return;
 
+	auto variable = fsm->getVariable(variableId);
+	if (variable == nullptr) return;
 
-	stream << "architecture FSM_body of " << this->machineVhdlName << " is\n\n";
 
-	stream << "  type state_type is (";
+	QString targetName = this->model.getVariableDrivenName(variableId);
+	auto mooreActuators = this->model.getMooreActuators(variableId);
+	auto mealyActuators = this->model.getMealyActuators(variableId);
 
-	for (const auto& stateName : this->stateVhdlName)
+	bool isPulseRegistered = this->model.isPulseRegistered(variableId);
+	if (isPulseRegistered == true)
 	{
-		stream << stateName;
+		mealyActuators.clear();
+	}
 
-		if (!(stateName == this->stateVhdlName.last()))
-			stream << ", ";
+	QStringList sensitivityList = {"current_state"};
+	if (isPulseRegistered == true)
+	{
+		sensitivityList.append(this->model.getPulseRegisterName(variableId));
+	}
+	else if (mealyActuators.isEmpty() == false)
+	{
+		sensitivityList += this->getAsynchronousSensitivityList();
 	}
 
-	stream << ");\n\n";
+	this->writeProcessHeader(stream, "compute_" + targetName, sensitivityList);
 
-	stream << "  signal current_state : state_type;\n";
-	stream << "  signal next_state    : state_type;\n\n";
+	stream << "  begin\n";
 
-	for (auto& localVarId : fsm->getInternalVariablesIds())
+	if (isPulseRegistered == true)
 	{
-		auto localVar = fsm->getVariable(localVarId);
-		if (localVar == nullptr) continue;
-
+		stream << "    " << targetName << " <= " << this->model.getPulseRegisterName(variableId) << ";\n";
+	}
+	else
+	{
+		stream << "    " << targetName << " <= " << this->generateValueText(variable->getInitialValue()) << ";\n";
+	}
 
-		stream << "  signal " + this->variableVhdlName[localVarId] << " : std_logic";
+	if ( (mooreActuators.isEmpty() == false) || (mealyActuators.isEmpty() == false) )
+	{
+		stream << "    case current_state is\n";
 
-		if (localVar->getSize() > 1)
+		for (auto& stateId : fsm->getAllStatesIds())
 		{
-			stream << "_vector(";
+			auto state = fsm->getState(stateId);
 
-			stream << QString::number(localVar->getSize() - 1) << " downto 0)";
+			bool hasMealyActions = false;
+			for (auto& transitionId : state->getOutgoingTransitionsIds())
+			{
+				if (mealyActuators.contains(transitionId) == true)
+				{
+					hasMealyActions = true;
+					break;
+				}
+			}
 
-			stream << " := \"" << localVar->getInitialValue().toString() << "\";\n";
-		}
-		else
-		{
-			stream << " := '" << localVar->getInitialValue().toString() << "';\n";
-		}
-	}
+			if ( (mooreActuators.contains(stateId) == false) && (hasMealyActions == false) ) continue;
 
-	stream << "\n";
 
-	for (auto& constantId : fsm->getConstantsIds())
-	{
-		auto constant = fsm->getVariable(constantId);
-		if (constant == nullptr) continue;
+			stream << "    when " << this->model.getStateName(stateId) << " =>\n";
+
+			for (auto& action : state->getActions())
+			{
+				if (action->getVariableActedOnId() == variableId)
+				{
+					this->writeSignalAffectationValue(stream, action, targetName, "      ");
+				}
+			}
 
+			if (hasMealyActions == true)
+			{
+				this->writeTransitionsActions(stream, stateId, variableId, targetName, "      ");
+			}
+		}
 
-		stream << "  constant " + this->variableVhdlName[constantId] << " : std_logic";
+		stream << "    when others =>\n";
+		stream << "      null;\n";
+		stream << "    end case;\n";
+	}
 
-		if (constant->getSize() > 1)
-		{
-			stream << "_vector(";
+	stream << "  end process;\n\n";
+}
 
-			stream << QString::number(constant->getSize() - 1) << " downto 0)";
+/**
+ * @brief FsmVhdlExport::writeMemorizedVariable writes the register of
+ * a memorized variable, updated on clock edge by the actions of the
+ * current state, then by the actions of the transition crossed.
+ */
+void FsmVhdlExport::writeMemorizedVariable(QTextStream& stream, componentId_t variableId) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
 
-			stream << " := \"" << constant->getInitialValue().toString() << "\";\n";
-		}
-		else
-		{
-			stream << " := '" << constant->getInitialValue().toString() << "';\n";
-		}
-	}
+	auto variable = fsm->getVariable(variableId);
+	if (variable == nullptr) return;
 
-	stream << "\nbegin\n\n";
 
-	// Next step computation : asynchronous process
-	stream << "  compute_next_step : process(current_state,\n";
+	QString targetName = this->model.getVariableDrivenName(variableId);
+	auto mooreActuators = this->model.getMooreActuators(variableId);
+	auto mealyActuators = this->model.getMealyActuators(variableId);
 
-	this->writeAsynchronousProcessSensitivityList(stream);
+	this->writeProcessHeader(stream, "update_" + targetName, {"clock", "reset"});
 
 	stream << "  begin\n";
+	this->writeResetCondition(stream);
+	stream << "      " << targetName << " <= " << this->generateValueText(variable->getInitialValue()) << ";\n";
+	stream << "    elsif rising_edge(clock) then\n";
 
-	stream << "    case current_state is\n";
-
-	for (auto& stateId : fsm->getAllStatesIds())
+	if ( (mooreActuators.isEmpty() == false) || (mealyActuators.isEmpty() == false) )
 	{
-		auto state = fsm->getState(stateId);
-
-		stream << "    when ";
-		stream << this->stateVhdlName[stateId];
-		stream << " =>\n";
+		stream << "      case current_state is\n";
 
-		auto transitionsIds = state->getOutgoingTransitionsIds();
-		for (auto& transitionId : transitionsIds)
+		for (auto& stateId : fsm->getAllStatesIds())
 		{
-			stream << "      ";
+			auto state = fsm->getState(stateId);
 
-			if (transitionId != transitionsIds.first())
-				stream << "els";
+			bool hasMealyActions = false;
+			for (auto& transitionId : state->getOutgoingTransitionsIds())
+			{
+				if (mealyActuators.contains(transitionId) == true)
+				{
+					hasMealyActions = true;
+					break;
+				}
+			}
 
-			stream << "if ";
+			if ( (mooreActuators.contains(stateId) == false) && (hasMealyActions == false) ) continue;
 
-			auto transition = fsm->getTransition(transitionId);
 
-			auto condition = transition->getCondition();
-			if (condition == nullptr)
+			stream << "      when " << this->model.getStateName(stateId) << " =>\n";
+
+			for (auto& action : state->getActions())
 			{
-				// Empty condition is considered always true
-				stream << "true";
+				if (action->getVariableActedOnId() == variableId)
+				{
+					this->writeSignalAffectationValue(stream, action, targetName, "        ");
+				}
 			}
-			else
+
+			if (hasMealyActions == true)
 			{
-				stream << generateEquationText(condition);
-				stream << " = '1'";
+				this->writeTransitionsActions(stream, stateId, variableId, targetName, "        ");
 			}
-
-			stream << " then\n";
-			stream << "        next_state <= " << this->stateVhdlName[transition->getTargetStateId()] << ";\n";
 		}
 
-		stream << "      end if;\n";
-
+		stream << "      when others =>\n";
+		stream << "        null;\n";
+		stream << "      end case;\n";
 	}
 
-	stream << "    end case;\n";
-
+	stream << "    end if;\n";
 	stream << "  end process;\n\n";
+}
 
-	// Current state update : synchronous process
+/**
+ * @brief FsmVhdlExport::writePulseRegister writes the register holding
+ * the pulse actions of the transition crossed during one clock cycle.
+ */
+void FsmVhdlExport::writePulseRegister(QTextStream& stream, componentId_t variableId) const
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+	auto variable = fsm->getVariable(variableId);
+	if (variable == nullptr) return;
+
+
+	QString targetName = this->model.getPulseRegisterName(variableId);
+	QString initialValue = this->generateValueText(variable->getInitialValue());
+	auto mealyActuators = this->model.getMealyActuators(variableId);
+
+	this->writeProcessHeader(stream, "update_" + targetName, {"clock", "reset"});
 
-	stream << "  update_state : process(clock, reset)\n";
 	stream << "  begin\n";
-	stream << "    if reset='" << (resetLogicPositive?"1":"0") << "' then\n";
-	stream << "      current_state <= " << this->stateVhdlName[fsm->getInitialStateId()] << ";\n";
+	this->writeResetCondition(stream);
+	stream << "      " << targetName << " <= " << initialValue << ";\n";
 	stream << "    elsif rising_edge(clock) then\n";
-	stream << "      current_state <= next_state;\n";
-	stream << "    end if;\n";
-	stream << "  end process;\n\n";
+	stream << "      " << targetName << " <= " << initialValue << ";\n";
+	stream << "      case current_state is\n";
+
+	for (auto& stateId : fsm->getAllStatesIds())
+	{
+		auto state = fsm->getState(stateId);
 
+		bool hasMealyActions = false;
+		for (auto& transitionId : state->getOutgoingTransitionsIds())
+		{
+			if (mealyActuators.contains(transitionId) == true)
+			{
+				hasMealyActions = true;
+				break;
+			}
+		}
 
-	// Output computation : asynchronous processes
+		if (hasMealyActions == false) continue;
 
-	if (!this->mooreVariables.isEmpty())
-	{
-		this->writeMooreOutputs(stream);
-	}
 
-	if (!this->mealyVariables.isEmpty())
-	{
-		this->writeMealyOutputs(stream);
+		stream << "      when " << this->model.getStateName(stateId) << " =>\n";
+		this->writeTransitionsActions(stream, stateId, variableId, targetName, "        ");
 	}
 
-	// The end
-	stream << "\nend architecture;\n";
+	stream << "      when others =>\n";
+	stream << "        null;\n";
+	stream << "      end case;\n";
+	stream << "    end if;\n";
+	stream << "  end process;\n\n";
+}
+
+void FsmVhdlExport::writeProcessHeader(QTextStream& stream, const QString& processName, const QStringList& sensitivityList) const
+{
+	QString header = "  " + processName + " : process(";
+	QString indent(header.size(), ' ');
+
+	stream << header << sensitivityList.join(",\n" + indent) << ")\n";
 }
 
-void FsmVhdlExport::writeMooreOutputs(QTextStream& stream) const
+void FsmVhdlExport::writeResetCondition(QTextStream& stream) const
+{
+	stream << "    if reset='" << (this->resetLogicPositive?"1":"0") << "' then\n";
+}
+
+/**
+ * @brief FsmVhdlExport::writeTransitionsActions writes the actions
+ * on a variable of the transitions leaving a state. Transitions are
+ * tested in the same priority order as in next state computation,
+ * thus preceding transitions not acting on the variable are kept.
+ */
+void FsmVhdlExport::writeTransitionsActions(QTextStream& stream, componentId_t stateId, componentId_t variableId, const QString& targetName, const QString& indent) const
 {
 	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
 	if (fsm == nullptr) return;
 
+	auto state = fsm->getState(stateId);
+	if (state == nullptr) return;
 
-	stream << "  compute_moore : process(current_state)\n";
-	stream << "  begin\n";
-
-	for (auto& variableId : this->mooreVariables)
-	{
-		if (this->tempValueVariables.contains(variableId))
-		{
-			auto variable = fsm->getVariable(variableId);
-			if (variable == nullptr) continue;
 
+	auto transitionsIds = state->getOutgoingTransitionsIds();
 
-			// Write default value for temp variables
-			stream << "    " << this->variableVhdlName[variableId] << " <= \"" << LogicValue::getValue0(variable->getSize()).toString() << "\";\n";
-		}
-	}
-	stream << "    -- Signals handled in this process but not listed above this line implicitly maintain their value.\n";
+	int lastActingTransition = this->model.getLastActingTransitionIndex(stateId, variableId);
+	if (lastActingTransition < 0) return;
 
-	stream << "    case current_state is\n";
 
-	for (auto& stateId : fsm->getAllStatesIds())
+	for (int i = 0 ; i <= lastActingTransition ; i++)
 	{
-		auto state = fsm->getState(stateId);
+		auto transition = fsm->getTransition(transitionsIds.at(i));
 
-		stream << "    when ";
-		stream << this->stateVhdlName[stateId];
-		stream << " =>\n";
+		stream << indent;
+
+		if (i != 0)
+			stream << "els";
+
+		stream << "if " << this->generateConditionText(transition) << " then\n";
 
 		int writtenActions = 0;
-		for (auto& action : state->getActions())
+		for (auto& action : transition->getActions())
 		{
-			if (this->mooreVariables.contains(action->getVariableActedOnId()))
+			if (action->getVariableActedOnId() == variableId)
 			{
 				writtenActions++;
 
-				this->writeSignalAffectationValue(stream, action);
+				this->writeSignalAffectationValue(stream, action, targetName, indent + "  ");
 			}
 		}
 
 		if (writtenActions == 0)
 		{
-			stream << "      null;\n";
+			stream << indent << "  null;\n";
 		}
 	}
 
-	stream << "    end case;\n";
+	stream << indent << "end if;\n";
+}
 
-	stream << "  end process;\n\n";
+void FsmVhdlExport::writeSignalAffectationValue(QTextStream& stream, shared_ptr<ActionOnVariable> action, const QString& targetName, const QString& indent) const
+{
+	ActionOnVariableType_t type = action->getActionType();
+	if (type == ActionOnVariableType_t::none) return;
+
+
+	QString target = targetName + this->generateRangeText(action->getActionRangeL(), action->getActionRangeR());
+
+	stream << indent << target << " <= ";
+
+	switch(type)
+	{
+	case ActionOnVariableType_t::continuous:
+	case ActionOnVariableType_t::pulse:
+	case ActionOnVariableType_t::assign:
+	case ActionOnVariableType_t::set:
+	case ActionOnVariableType_t::reset:
+		stream << this->generateValueText(action->getActionValue());
+		break;
+	case ActionOnVariableType_t::increment:
+		stream << "std_logic_vector(unsigned(" << target << ") + 1)";
+		break;
+	case ActionOnVariableType_t::decrement:
+		stream << "std_logic_vector(unsigned(" << target << ") - 1)";
+		break;
+	case ActionOnVariableType_t::none:
+		// Handled above
+		break;
+	}
+
+	stream << ";\n";
 }
 
-void FsmVhdlExport::writeMealyOutputs(QTextStream& stream) const
+void FsmVhdlExport::writeTestbenchHeader(QTextStream& stream, uint stepsCount) const
 {
-	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
-	if (fsm == nullptr) return;
+	stream << "-- Testbench generated with StateS v" << StateS::getVersion() << " on " << QDate::currentDate().toString() << " at " << QTime::currentTime().toString() << "\n";
+	stream << "-- https://github.com/ClementFoucher/StateS\n";
+	stream << "-- Replays a simulation run of " << stepsCount << " steps on entity " << this->model.getMachineName() << "\n\n";
+
+	stream << "library IEEE;\n";
+	stream << "use IEEE.std_logic_1164.all;\n\n\n";
+}
+
+/**
+ * @brief FsmVhdlExport::writeTestbench writes the testbench entity.
+ * Inputs and expected outputs of each step are concatenated in a
+ * constant array which is iterated on by the replay process:
+ * inputs are applied on the falling clock edge, and outputs are
+ * checked on the next falling edge, after the state was updated.
+ */
+void FsmVhdlExport::writeTestbench(QTextStream& stream, const SimulationHistory::Trace_t& trace) const
+{
+	QString resetActive   = (this->resetLogicPositive == true) ? "'1'" : "'0'";
+	QString resetInactive = (this->resetLogicPositive == true) ? "'0'" : "'1'";
+
+	uint inputsSize  = this->getTraceVectorSize(trace.inputsIds);
+	uint outputsSize = this->getTraceVectorSize(trace.outputsIds);
+
+	auto inputsSlices  = this->generateTraceSlices(trace.inputsIds,  "inputs");
+	auto outputsSlices = this->generateTraceSlices(trace.outputsIds, "outputs");
+
+	stream << "entity " << this->model.getMachineName() << "_tb is\n";
+	stream << "end entity;\n\n\n";
+
+	stream << "architecture replay of " << this->model.getMachineName() << "_tb is\n\n";
+
+	stream << "  constant CLOCK_PERIOD : time := 10 ns;\n\n";
+
+	stream << "  subtype inputs_t  is std_logic_vector(" << (int)inputsSize  - 1 << " downto 0);\n";
+	stream << "  subtype outputs_t is std_logic_vector(" << (int)outputsSize - 1 << " downto 0);\n\n";
+
+	stream << "  type step_t is record\n";
+	stream << "    inputs  : inputs_t;  -- Applied before clock edge\n";
+	stream << "    outputs : outputs_t; -- Expected after clock edge\n";
+	stream << "  end record;\n\n";
 
+	stream << "  type trace_t is array(natural range <>) of step_t;\n\n";
 
-	stream << "  -- Compute Mealy outputs\n";
+	stream << "  constant INITIAL_OUTPUTS : outputs_t := " << this->generateTraceVectorText(trace.outputsIds, trace.initialOutputs) << ";\n\n";
 
-	for (auto& variableId : this->mealyVariables)
+	stream << "  constant TRACE : trace_t := (\n";
+	for (int step = 0 ; step < trace.stepsInputs.count() ; step++)
 	{
-		if (this->tempValueVariables.contains(variableId))
+		stream << "    ";
+
+		// A single element aggregate must be named
+		if (trace.stepsInputs.count() == 1)
 		{
-			QList<shared_ptr<FsmTransition>> transitions;
+			stream << "0 => ";
+		}
 
-			for (auto& transitionId : fsm->getAllTransitionsIds())
-			{
-				auto transition = fsm->getTransition(transitionId);
+		stream << "(" << this->generateTraceVectorText(trace.inputsIds, trace.stepsInputs.at(step));
+		stream << ", " << this->generateTraceVectorText(trace.outputsIds, trace.stepsOutputs.at(step)) << ")";
 
-				for (auto& action : transition->getActions())
-				{
-					if (action->getVariableActedOnId() == variableId)
-					{
-						transitions.append(transition);
-						break;
-					}
-				}
-			}
+		if (step != trace.stepsInputs.count() - 1)
+		{
+			stream << ",";
+		}
 
-			if (transitions.isEmpty() == false)
-			{
-				auto variable = fsm->getVariable(variableId);
-				if (variable == nullptr) continue;
+		stream << "\n";
+	}
+	stream << "  );\n\n";
 
+	stream << "  signal clock   : std_logic := '0';\n";
+	stream << "  signal reset   : std_logic := " << resetActive << ";\n";
+	stream << "  signal inputs  : inputs_t  := (others => '0');\n";
+	stream << "  signal outputs : outputs_t;\n";
+	stream << "  signal done    : boolean   := false;\n\n";
 
-				stream << "  affect_" << this->variableVhdlName[variableId] << ":";
-				stream << this->variableVhdlName[variableId] << " <= ";
+	stream << "begin\n\n";
 
-				for (auto& transition : transitions)
-				{
-					for (auto& action : transition->getActions())
-					{
-						if (action->getVariableActedOnId() == variableId)
-						{
-							if (variable->getSize() > 1)
-							{
-								// Currently, the only case leading here is for ActionOnVariableType_t::pulse
-								stream << "\"" << action->getActionValue().toString() << "\"";
-							}
-							else
-							{
-								stream << "'1'";
-							}
-
-							stream << " when (current_state = " << this->stateVhdlName[transition->getSourceStateId()] << ")";
-							stream << " and " << this->generateEquationText(transition->getCondition());
-							stream << " else\n    ";
-						}
-					}
-				}
+	// Device under test
+	QStringList ports = {"clock => clock", "reset => reset"};
+	for (int i = 0 ; i < trace.inputsIds.count() ; i++)
+	{
+		ports.append(this->model.getVariableName(trace.inputsIds.at(i)) + " => " + inputsSlices.at(i));
+	}
+	for (int i = 0 ; i < trace.outputsIds.count() ; i++)
+	{
+		ports.append(this->model.getVariableName(trace.outputsIds.at(i)) + " => " + outputsSlices.at(i));
+	}
 
-				stream << LogicValue::getValue0(variable->getSize()).toString() << ";\n";
-			}
+	stream << "  dut : entity work." << this->model.getMachineName() << "\n";
+	stream << "    port map(" << ports.join(",\n             ") << ");\n\n";
+
+	stream << "  clock <= not clock after CLOCK_PERIOD / 2 when done = false else '0';\n\n";
+
+	// Replay process
+	stream << "  replay : process\n\n";
+
+	stream << "    procedure check_outputs(expected : in outputs_t; step : in natural) is\n";
+	stream << "    begin\n";
+	bool outputChecked = false;
+	for (int i = 0 ; i < trace.outputsIds.count() ; i++)
+	{
+		auto outputId = trace.outputsIds.at(i);
+		auto outputName = this->model.getVariableName(outputId);
+
+		if (this->model.isCombinationalMealyOutput(outputId) == true)
+		{
+			// Combinational Mealy outputs depend on inputs between clock edges:
+			// the value obtained in the simulator is not a per-cycle value.
+			stream << "      -- " << outputName << " has combinational Mealy actions: not checked\n";
+		}
+		else
+		{
+			QString expectedSlice = outputsSlices.at(i);
+			expectedSlice.replace(0, QString("outputs").length(), "expected");
+
+			stream << "      assert " << outputsSlices.at(i) << " = " << expectedSlice << "\n";
+			stream << "        report \"" << outputName << " mismatch after step \" & integer'image(step)\n";
+			stream << "        severity error;\n";
+
+			outputChecked = true;
 		}
 	}
+	if (outputChecked == false)
+	{
+		stream << "      null;\n";
+	}
+	stream << "    end procedure;\n\n";
+
+	stream << "  begin\n";
+	stream << "    wait until falling_edge(clock);\n";
+	stream << "    reset <= " << resetInactive << ";\n";
+	stream << "    wait for CLOCK_PERIOD / 4;\n";
+	stream << "    check_outputs(INITIAL_OUTPUTS, 0);\n\n";
+
+	stream << "    for step in TRACE'range loop\n";
+	stream << "      inputs <= TRACE(step).inputs;\n";
+	stream << "      wait until rising_edge(clock);\n";
+	stream << "      wait until falling_edge(clock);\n";
+	stream << "      check_outputs(TRACE(step).outputs, step + 1);\n";
+	stream << "    end loop;\n\n";
+
+	stream << "    report \"Replay of \" & integer'image(TRACE'length) & \" steps done\" severity note;\n";
+	stream << "    done <= true;\n";
+	stream << "    wait;\n";
+	stream << "  end process;\n\n";
+
+	stream << "end architecture;\n";
 }
 
-void FsmVhdlExport::writeAsynchronousProcessSensitivityList(QTextStream& stream) const
+/**
+ * @brief FsmVhdlExport::generateTraceSlices returns for each variable
+ * the slice of the vector concatenating all variables, first variable
+ * being on the most significant bits.
+ */
+QStringList FsmVhdlExport::generateTraceSlices(const QList<componentId_t>& variablesIds, const QString& vectorName) const
 {
 	auto machine = machineManager->getMachine();
-	if (machine == nullptr) return;
+	if (machine == nullptr) return QStringList();
 
 
-	auto inputIds    = machine->getInputVariablesIds();
-	auto localVarIds = machine->getInternalVariablesIds();
+	QStringList slices;
 
-	for (auto& inputId : inputIds)
+	int high = (int)this->getTraceVectorSize(variablesIds) - 1;
+	for (auto& variableId : variablesIds)
 	{
-		stream << "                              ";
+		auto variable = machine->getVariable(variableId);
+		if (variable == nullptr) continue;
 
-		stream << this->variableVhdlName[inputId];
 
-		if ( (inputId == inputIds.last()) && (localVarIds.count() == 0) )
+		int size = variable->getSize();
+		if (size == 1)
 		{
-			stream << ")\n";
+			slices.append(vectorName + "(" + QString::number(high) + ")");
 		}
 		else
 		{
-			stream << ",\n";
+			slices.append(vectorName + "(" + QString::number(high) + " downto " + QString::number(high - size + 1) + ")");
 		}
+
+		high -= size;
 	}
 
-	for (auto& localVarId : localVarIds)
+	return slices;
+}
+
+QString FsmVhdlExport::generateTraceVectorText(const QList<componentId_t>& variablesIds, const QList<quint64>& values) const
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return QString();
+
+
+	QString text = "\"";
+	for (int i = 0 ; i < variablesIds.count() ; i++)
 	{
-		stream << "                              ";
-		stream << this->variableVhdlName[localVarId];
+		auto variable = machine->getVariable(variablesIds.at(i));
+		if (variable == nullptr) continue;
 
-		if (localVarId == localVarIds.last())
-		{
-			stream << ")\n";
-		}
-		else
-		{
-			stream << ",\n";
-		}
+
+		text += FsmSimulationEngine::unpackValue(values.at(i), variable->getSize()).toString();
 	}
+	text += "\"";
+
+	return text;
 }
 
-void FsmVhdlExport::writeSignalAffectationValue(QTextStream& stream, shared_ptr<ActionOnVariable> action) const
+uint FsmVhdlExport::getTraceVectorSize(const QList<componentId_t>& variablesIds) const
 {
 	auto machine = machineManager->getMachine();
-	if (machine == nullptr) return;
+	if (machine == nullptr) return 0;
 
-	auto variableId = action->getVariableActedOnId();
 
-	auto variable = machine->getVariable(variableId);
-	if (variable == nullptr) return;
+	uint size = 0;
+	for (auto& variableId : variablesIds)
+	{
+		auto variable = machine->getVariable(variableId);
+		if (variable == nullptr) continue;
+
 
+		size += variable->getSize();
+	}
 
-	stream << "      ";
-	stream << this->variableVhdlName[variableId];
-	stream << " <= ";
+	return size;
+}
 
-	ActionOnVariableType_t type = action->getActionType();
+QStringList FsmVhdlExport::getAsynchronousSensitivityList() const
+{
+	QStringList sensitivityList;
 
-	if (variable->getSize() == 1)
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return sensitivityList;
+
+
+	for (auto& inputId : machine->getInputVariablesIds())
 	{
-		switch(type)
-		{
-		case ActionOnVariableType_t::continuous:
-		case ActionOnVariableType_t::pulse:
-		case ActionOnVariableType_t::set:
-			stream << "'1'";
-			break;
-		case ActionOnVariableType_t::reset:
-			stream << "'0'";
-			break;
-		case ActionOnVariableType_t::increment:
-		case ActionOnVariableType_t::decrement:
-		case ActionOnVariableType_t::assign:
-		case ActionOnVariableType_t::none:
-			// Impossible cases
-			break;
-		}
+		sensitivityList.append(this->model.getVariableName(inputId));
+	}
+
+	for (auto& localVarId : machine->getInternalVariablesIds())
+	{
+		sensitivityList.append(this->model.getVariableName(localVarId));
+	}
+
+	for (auto& outputId : this->model.getBufferedOutputsIds())
+	{
+		sensitivityList.append(this->model.getOutputInternalName(outputId));
+	}
+
+	return sensitivityList;
+}
+
+QString FsmVhdlExport::generateConditionText(shared_ptr<FsmTransition> transition) const
+{
+	auto condition = transition->getCondition();
+	if (condition == nullptr)
+	{
+		// Empty condition is considered always true
+		return "true";
 	}
 	else
 	{
-		switch(type)
-		{
-		case ActionOnVariableType_t::continuous:
-		case ActionOnVariableType_t::pulse:
-		case ActionOnVariableType_t::assign:
-		case ActionOnVariableType_t::set:
-		case ActionOnVariableType_t::reset:
-			stream << "\"" <<  action->getActionValue().toString() << "\"";
-			break;
-		case ActionOnVariableType_t::increment:
-			stream << "std_logic_vector(unsigned(" << this->variableVhdlName[variableId] << " + 1)";
-			break;
-		case ActionOnVariableType_t::decrement:
-			stream << "std_logic_vector(unsigned(" << this->variableVhdlName[variableId] << " - 1)";
-			break;
-		case ActionOnVariableType_t::none:
-			// Nothing
-			break;
-		}
+		return this->generateEquationText(condition) + " = '1'";
 	}
+}
 
-	stream << ";\n";
+QString FsmVhdlExport::generateTypeText(uint size) const
+{
+	if (size > 1)
+	{
+		return "std_logic_vector(" + QString::number(size - 1) + " downto 0)";
+	}
+	else
+	{
+		return "std_logic";
+	}
+}
+
+QString FsmVhdlExport::generateValueText(const LogicValue& value) const
+{
+	if (value.getSize() == 1)
+	{
+		return "'" + value.toString() + "'";
+	}
+	else
+	{
+		return "\"" + value.toString() + "\"";
+	}
+}
+
+QString FsmVhdlExport::generateRangeText(int rangeL, int rangeR) const
+{
+	if (rangeL < 0)
+	{
+		return QString();
+	}
+	else if (rangeR < 0)
+	{
+		return "(" + QString::number(rangeL) + ")";
+	}
+	else
+	{
+		return "(" + QString::number(rangeL) + " downto " + QString::number(rangeR) + ")";
+	}
 }
 
 QString FsmVhdlExport::generateEquationText(shared_ptr<Equation> equation) const
@@ -883,7 +1114,7 @@ QString FsmVhdlExport::generateOperandText(shared_ptr<Operand> operand) const
 	case OperandSource_t::variable:
 	{
 		auto variableId = operand->getVariableId();
-		return this->variableVhdlName[variableId];
+		return this->model.getVariableDrivenName(variableId);
 		break;
 	}
 	case OperandSource_t::constant:
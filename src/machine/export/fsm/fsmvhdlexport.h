@@ -30,57 +30,37 @@
 using namespace std;
 
 // Qt classes
-#include <QMap>
+#include <QStringList>
 class QString;
 class QTextStream;
 
 // StateS classes
 #include "statestypes.h"
+#include "simulationhistory.h"
+#include "fsmhdlmodel.h"
+class LogicValue;
 class ActionOnVariable;
 class Equation;
 class Operand;
+class FsmTransition;
 
 
+/**
+ * @brief The FsmVhdlExport class generates a VHDL description of the
+ * current FSM from its FsmHdlModel analysis, matching the simulator
+ * default actions behavior.
+ *
+ * Each writtable variable is generated in its own process, in which
+ * range-addressed actions are assignments to the bit or slice acted on.
+ *
+ * A testbench can also be generated from a simulation trace: it replays
+ * the inputs recorded cycle by cycle and asserts the outputs obtained in
+ * the simulator after each clock edge.
+ */
 class FsmVhdlExport : public QObject
 {
 	Q_OBJECT
 
-	/////
-	// Type declarations
-public:
-	class ExportCompatibility
-	{
-	public:
-		QList<componentId_t> bothMooreAndMealy;
-		QList<componentId_t> rangeAdressed;
-		QList<componentId_t> mealyWithKeep;
-
-		bool isCompatible()
-		{
-			if (bothMooreAndMealy.isEmpty()    &&
-			    rangeAdressed.isEmpty()        &&
-			    mealyWithKeep.isEmpty()
-			   )
-			{
-				return true;
-			}
-			else
-			{
-				return false;
-			}
-		}
-	};
-
-private:
-	struct WrittableVariableCharacteristics_t
-	{
-		bool isMoore         = false;
-		bool isMealy         = false;
-		bool isTempValue     = false;
-		bool isKeepValue     = false;
-		bool isRangeAdressed = false;
-	};
-
 	/////
 	// Constructors/destructors
 public:
@@ -89,59 +69,54 @@ public:
 	/////
 	// Object functions
 public:
-	void setOptions(bool resetLogicPositive, bool prefixSignals);
+	void setOptions(bool resetLogicPositive, bool prefixSignals, HdlStateEncoding_t stateEncoding, bool registerMealyOutputs);
 
 	bool writeToFile(const QString& path);
-	shared_ptr<ExportCompatibility> checkCompatibility();
+	bool writeTestbenchToFile(const QString& path, const SimulationHistory::Trace_t& trace);
+
+	bool matchesSimulationBehavior() const;
 
 private:
-	void generateVhdlCharacteristics();
-	WrittableVariableCharacteristics_t determineWrittableVariableCharacteristics(componentId_t variableId, bool storeResults);
-	QString generateVhdlSignalName(const QString& prefix, const QString& name) const;
-	QString cleanNameForVhdl(const QString& name) const;
+	void buildModel();
 
 	void writeHeader(QTextStream& stream) const;
 	void writeEntity(QTextStream& stream) const;
 	void writeArchitecture(QTextStream& stream) const;
-	void writeMooreOutputs(QTextStream& stream) const;
-	void writeMealyOutputs(QTextStream& stream) const;
-
-	void writeAsynchronousProcessSensitivityList(QTextStream& stream) const;
-	void writeSignalAffectationValue(QTextStream& stream, shared_ptr<ActionOnVariable> action) const;
-
+	void writeStateType(QTextStream& stream) const;
+	void writeSignalDeclaration(QTextStream& stream, componentId_t variableId, const QString& signalName, bool isConstant) const;
+	void writeTemporaryVariable(QTextStream& stream, componentId_t variableId) const;
+	void writeMemorizedVariable(QTextStream& stream, componentId_t variableId) const;
+	void writePulseRegister(QTextStream& stream, componentId_t variableId) const;
+
+	void writeProcessHeader(QTextStream& stream, const QString& processName, const QStringList& sensitivityList) const;
+	void writeResetCondition(QTextStream& stream) const;
+	void writeTransitionsActions(QTextStream& stream, componentId_t stateId, componentId_t variableId, const QString& targetName, const QString& indent) const;
+	void writeSignalAffectationValue(QTextStream& stream, shared_ptr<ActionOnVariable> action, const QString& targetName, const QString& indent) const;
+
+	void writeTestbenchHeader(QTextStream& stream, uint stepsCount) const;
+	void writeTestbench(QTextStream& stream, const SimulationHistory::Trace_t& trace) const;
+	QStringList generateTraceSlices(const QList<componentId_t>& variablesIds, const QString& vectorName) const;
+	QString generateTraceVectorText(const QList<componentId_t>& variablesIds, const QList<quint64>& values) const;
+	uint getTraceVectorSize(const QList<componentId_t>& variablesIds) const;
+
+	QStringList getAsynchronousSensitivityList() const;
+	QString generateConditionText(shared_ptr<FsmTransition> transition) const;
+	QString generateTypeText(uint size) const;
+	QString generateValueText(const LogicValue& value) const;
+	QString generateRangeText(int rangeL, int rangeR) const;
 	QString generateEquationText(shared_ptr<Equation> equation) const;
 	QString generateOperandText(shared_ptr<Operand> operand) const;
 
 	/////
 	// Object variables
 private:
-	bool resetLogicPositive;
-	bool prefixSignals;
-
-	QMap<componentId_t, QString> variableVhdlName;
-	QMap<componentId_t, QString> stateVhdlName;
-	QString machineVhdlName;
-
-	// The following is used to determine how a writtable variable should be affected value.
-
-	// For now, we only handle these cases:
-	// - A variable is either Mealy or Moore, not both.
-	// - A variable either keeps its value or has an active-on-state/pulse value, not both.
+	bool resetLogicPositive  = true;
+	bool prefixSignals       = false;
+	bool registerMealyOutputs = false;
+	HdlStateEncoding_t stateEncoding = HdlStateEncoding_t::symbolic;
 
-	QList<componentId_t> mooreVariables;
-	QList<componentId_t> mealyVariables; // TODO: Mealy variables are currently ignored.
-
-	QList<componentId_t> tempValueVariables;
-	QList<componentId_t> keepValueVariables;
-
-	// At first, the variables with range adressing should be treated
-	// as independant bits, each bit acting like a whole variable.
-	// Then maybe determine independant ranges, not alway go @ bit level.
-
-	// TODO: Range adresssed variables are currently ignored.
-	//QList<componentId_t> rangeAdressedVariables;
+	FsmHdlModel model;
 
 };
 
 #endif // FSMVHDLEXPORT_H
-
@@ -22,12 +22,21 @@
 // Current class header
 #include "machineimageexporter.h"
 
+// C++ classes
+#include <atomic>
+#include <vector>
+#include <cstring>
+
 // Qt classes
+#include <QThread>
+#include <QImage>
+#include <QPicture>
 #include <QPainter>
 #include <QPrinter>
 #include <QPageSize>
 #include <QSvgGenerator>
 #include <QGraphicsTextItem>
+#include <QGraphicsScene>
 
 // StateS classes
 #include "machinemanager.h"
@@ -36,6 +45,78 @@
 #include "variable.h"
 
 
+/**
+ * @brief MachineImageExporter::renderPreview renders a preview
+ * prepared by preparePreview(). As it only relies on recorded
+ * panels, this function can be called from any thread.
+ */
+QImage MachineImageExporter::renderPreview(const Preview_t& preview)
+{
+	QImage image(preview.size, QImage::Format_RGB32);
+	if (image.isNull() == true) return image;
+
+
+	if (preview.layers.isEmpty() == false)
+	{
+		// Use the recording resolution to avoid rescaling fonts
+		image.setDotsPerMeterX(qRound(preview.layers.first().picture.logicalDpiX() / 0.0254));
+		image.setDotsPerMeterY(qRound(preview.layers.first().picture.logicalDpiY() / 0.0254));
+	}
+	image.fill(Qt::white);
+
+	QPainter imagePainter(&image);
+	imagePainter.setRenderHint(QPainter::Antialiasing);
+
+	for (const auto& layer : preview.layers)
+	{
+		if (layer.sourceRect.isEmpty() == true) continue;
+
+
+		imagePainter.save();
+		imagePainter.translate(layer.targetRect.topLeft());
+		imagePainter.scale(layer.targetRect.width() / layer.sourceRect.width(), layer.targetRect.height() / layer.sourceRect.height());
+		imagePainter.drawPicture(0, 0, layer.picture);
+		imagePainter.restore();
+	}
+
+	imagePainter.setPen(QPen(Qt::black));
+	imagePainter.setBrush(Qt::NoBrush);
+	for (const auto& border : preview.borders)
+	{
+		imagePainter.drawRect(border);
+	}
+
+	imagePainter.end();
+
+	return image;
+}
+
+/**
+ * @brief MachineImageExporter::renderWithoutItemsCache renders a scene
+ * with items cache disabled: cached items would otherwise be drawn as
+ * bitmaps at the screen resolution instead of their actual content.
+ * Cache modes are restored once the scene is rendered.
+ */
+void MachineImageExporter::renderWithoutItemsCache(QGraphicsScene* scene, QPainter* painter, const QRectF& target, const QRectF& source)
+{
+	QList<QPair<QGraphicsItem*, QGraphicsItem::CacheMode>> cachedItems;
+	for (QGraphicsItem* item : scene->items())
+	{
+		if (item->cacheMode() != QGraphicsItem::NoCache)
+		{
+			cachedItems.append(QPair<QGraphicsItem*, QGraphicsItem::CacheMode>(item, item->cacheMode()));
+			item->setCacheMode(QGraphicsItem::NoCache);
+		}
+	}
+
+	scene->render(painter, target, source);
+
+	for (const auto& cachedItem : cachedItems)
+	{
+		cachedItem.first->setCacheMode(cachedItem.second);
+	}
+}
+
 MachineImageExporter::MachineImageExporter(GenericScene* scene, shared_ptr<QGraphicsScene> component)
 {
 	this->scene = scene;
@@ -78,9 +159,33 @@ void MachineImageExporter::setInfoPos(LeftRight_t pos)
 	this->infoPosition = pos;
 }
 
-shared_ptr<QPixmap> MachineImageExporter::renderPreview(QSizeF previewSize)
+/**
+ * @brief MachineImageExporter::setBitmapScale sets the
+ * ratio between Png/Jpeg exports size in pixels and
+ * the scene size. Vector formats are not affected.
+ */
+void MachineImageExporter::setBitmapScale(qreal scale)
 {
-	shared_ptr<QPixmap> generatedPixmap;
+	if (scale <= 0) return;
+
+
+	this->bitmapScale = scale;
+}
+
+/**
+ * @brief MachineImageExporter::preparePreview lays out the preview
+ * for the current options. Panels are recorded on first call only,
+ * later calls only compute their position: options changes do not
+ * require the scene to be painted again.
+ * The result is independent from the exporter and can be
+ * rendered using renderPreview() from a worker thread.
+ */
+MachineImageExporter::Preview_t MachineImageExporter::preparePreview(QSizeF previewSize)
+{
+	if (this->panelsRecorded == false)
+	{
+		this->recordPanels();
+	}
 
 	this->pageRect = QRectF(QPointF(0,0), previewSize);
 	this->renderAreaWithoutBordersRect = this->pageRect;
@@ -95,20 +200,59 @@ shared_ptr<QPixmap> MachineImageExporter::renderPreview(QSizeF previewSize)
 	this->constantsPrintingRect.translate(this->spacer, this->spacer);
 	this->variablesPrintingRect.translate(this->spacer, this->spacer);
 
-	this->renderBitmap();
+	this->strictBorders = false;
+
+	Preview_t preview;
+	preview.size = previewSize.toSize();
+
+	this->appendPreviewLayer(preview, this->sceneRecording, this->scenePrintingRect);
+
+	if (this->includeComponent == true)
+	{
+		this->appendPreviewLayer(preview, this->componentRecording, this->componentPrintingRect);
+	}
+
+	if (this->includeConstant == true)
+	{
+		this->appendPreviewLayer(preview, this->constantsRecording, this->constantsPrintingRect);
+	}
+
+	if (this->includeVariables == true)
+	{
+		this->appendPreviewLayer(preview, this->variablesRecording, this->variablesPrintingRect);
+	}
 
-	generatedPixmap = this->pixmap;
 	this->freeRenderingResources();
 
-	return generatedPixmap;
+	return preview;
 }
 
-void MachineImageExporter::doExport(const QString& path, ImageFormat_t format, const QString& creator)
+/**
+ * @brief MachineImageExporter::clearPreviewCache must be called
+ * if the machine changed since the preview was first prepared.
+ */
+void MachineImageExporter::clearPreviewCache()
+{
+	this->panelsRecorded = false;
+
+	this->sceneRecording     = PanelRecording_t();
+	this->componentRecording = PanelRecording_t();
+	this->constantsRecording = PanelRecording_t();
+	this->variablesRecording = PanelRecording_t();
+}
+
+/**
+ * @brief MachineImageExporter::doExport
+ * @return False if the output file could not be written.
+ */
+bool MachineImageExporter::doExport(const QString& path, ImageFormat_t format, const QString& creator)
 {
 	auto machine = machineManager->getMachine();
-	if (machine == nullptr) return;
+	if (machine == nullptr) return false;
 
 
+	this->scene->flushPendingGeometryRefreshes();
+
 	if (format == ImageFormat_t::pdf)
 	{
 		this->preparePdfPrinter(path, machine->getName(), creator);
@@ -127,9 +271,10 @@ void MachineImageExporter::doExport(const QString& path, ImageFormat_t format, c
 
 	this->generatePrintingRects();
 
+	bool exported;
 	if (format == ImageFormat_t::pdf)
 	{
-		this->renderPdf();
+		exported = this->renderPdf();
 	}
 	else
 	{
@@ -142,17 +287,18 @@ void MachineImageExporter::doExport(const QString& path, ImageFormat_t format, c
 
 		if (format == ImageFormat_t::svg)
 		{
-			this->renderSvg(path, machine->getName(), creator);
+			exported = this->renderSvg(path, machine->getName(), creator);
 		}
 		else
 		{
-			this->renderBitmap();
-			this->pixmap->save(path);
+			exported = this->renderTiledBitmap(path);
 		}
 	}
 
 	// Done, clear rendering ressources
 	this->freeRenderingResources();
+
+	return exported;
 }
 
 /**
@@ -251,16 +397,18 @@ void MachineImageExporter::preparePdfPrinter(const QString& path, const QString&
 	this->printer->setDocName(title);
 }
 
-void MachineImageExporter::renderPdf()
+bool MachineImageExporter::renderPdf()
 {
 	this->strictBorders = true;
 
-	this->painter->begin(this->printer.get());
+	if (this->painter->begin(this->printer.get()) == false) return false;
+
+
 	this->renderOnPainter();
-	this->painter->end();
+	return this->painter->end();
 }
 
-void MachineImageExporter::renderSvg(const QString& path, const QString& title, const QString& creator)
+bool MachineImageExporter::renderSvg(const QString& path, const QString& title, const QString& creator)
 {
 	this->generator = make_shared<QSvgGenerator>();
 
@@ -272,23 +420,108 @@ void MachineImageExporter::renderSvg(const QString& path, const QString& title,
 
 	this->strictBorders = false;
 
-	this->painter->begin(this->generator.get());
+	if (this->painter->begin(this->generator.get()) == false) return false;
+
+
 	this->renderOnPainter();
-	this->painter->end();
+	return this->painter->end();
 }
 
-void MachineImageExporter::renderBitmap()
+/**
+ * @brief MachineImageExporter::renderTiledBitmap renders Png
+ * and Jpeg exports. Scenes can only be painted from the GUI
+ * thread: the page is thus first recorded, then the recording is
+ * rasterized in parallel by worker threads, each one rendering
+ * tiles in its own small image. Tiles are copied to the final
+ * image as soon as they are done. The final image is allocated
+ * using 24 bits per pixel, as the image encoders require the
+ * full image to be available.
+ * @return False if the image could not be allocated or written.
+ */
+bool MachineImageExporter::renderTiledBitmap(const QString& path)
 {
-	this->pixmap = make_shared<QPixmap>(this->pageRect.size().toSize());
+	QSize imageSize = (this->pageRect.size() * this->bitmapScale).toSize();
+	QImage image(imageSize, QImage::Format_RGB888);
+	if (image.isNull() == true) return false;
 
-	this->pixmap->fill();
 
 	this->strictBorders = false;
 
-	this->painter->begin(this->pixmap.get());
+	// Record at final scale, so that level of detail and
+	// cached items are computed for the actual resolution
+	QPicture picture;
+	this->painter->begin(&picture);
 	this->painter->setRenderHint(QPainter::Antialiasing);
+	this->painter->scale(this->bitmapScale, this->bitmapScale);
 	this->renderOnPainter();
 	this->painter->end();
+
+	const int tilesPerRow    = (imageSize.width()  + MachineImageExporter::bitmapTileSize - 1) / MachineImageExporter::bitmapTileSize;
+	const int tilesPerColumn = (imageSize.height() + MachineImageExporter::bitmapTileSize - 1) / MachineImageExporter::bitmapTileSize;
+	const int tilesCount     = tilesPerRow * tilesPerColumn;
+
+	// Workers write to distinct areas of the image through its raw buffer
+	uchar* imageBits = image.bits();
+	const qsizetype bytesPerLine = image.bytesPerLine();
+
+	// Tiles use the recording resolution to avoid rescaling fonts
+	const int dotsPerMeterX = qRound(picture.logicalDpiX() / 0.0254);
+	const int dotsPerMeterY = qRound(picture.logicalDpiY() / 0.0254);
+
+	const QByteArray pictureData(picture.data(), picture.size());
+	atomic<int> nextTile = 0;
+
+	auto renderTiles = [&]()
+	{
+		// A picture can not be played by several threads at once: use a private copy
+		QPicture tilesPicture;
+		tilesPicture.setData(pictureData.constData(), pictureData.size());
+
+		for (int tileIndex = nextTile++ ; tileIndex < tilesCount ; tileIndex = nextTile++)
+		{
+			QRect tileRect((tileIndex % tilesPerRow) * MachineImageExporter::bitmapTileSize,
+			               (tileIndex / tilesPerRow) * MachineImageExporter::bitmapTileSize,
+			               MachineImageExporter::bitmapTileSize,
+			               MachineImageExporter::bitmapTileSize);
+			tileRect = tileRect.intersected(QRect(QPoint(0, 0), imageSize));
+
+			QImage tile(tileRect.size(), QImage::Format_RGB32);
+			tile.setDotsPerMeterX(dotsPerMeterX);
+			tile.setDotsPerMeterY(dotsPerMeterY);
+			tile.fill(Qt::white);
+
+			QPainter tilePainter(&tile);
+			tilePainter.translate(-tileRect.topLeft());
+			tilesPicture.play(&tilePainter);
+			tilePainter.end();
+
+			tile.convertTo(QImage::Format_RGB888);
+			for (int line = 0 ; line < tileRect.height() ; line++)
+			{
+				uchar* destination = imageBits + (tileRect.top() + line) * bytesPerLine + tileRect.left() * 3;
+				memcpy(destination, tile.constScanLine(line), tileRect.width() * 3);
+			}
+		}
+	};
+
+	int workersCount = qBound(1, QThread::idealThreadCount(), tilesCount);
+
+	vector<unique_ptr<QThread>> workers;
+	for (int i = 1 ; i < workersCount ; i++)
+	{
+		workers.emplace_back(QThread::create(renderTiles));
+		workers.back()->start();
+	}
+
+	// Current thread also renders tiles
+	renderTiles();
+
+	for (auto& worker : workers)
+	{
+		worker->wait();
+	}
+
+	return image.save(path);
 }
 
 void MachineImageExporter::renderOnPainter()
@@ -317,7 +550,7 @@ void MachineImageExporter::renderScene()
 	}
 
 	QRectF actualPrintingRect = this->getActualPrintedRect(this->scene->sceneRect(), this->scenePrintingRect);
-	this->scene->render(this->painter.get(), actualPrintingRect);
+	MachineImageExporter::renderWithoutItemsCache(this->scene, this->painter.get(), actualPrintingRect, this->scene->sceneRect());
 }
 
 void MachineImageExporter::renderComponent()
@@ -333,7 +566,7 @@ void MachineImageExporter::renderComponent()
 		if (l_component != nullptr)
 		{
 			QRectF actualPrintingRect = this->getActualPrintedRect(l_component->sceneRect(), this->componentPrintingRect);
-			l_component->render(this->painter.get(), actualPrintingRect);
+			MachineImageExporter::renderWithoutItemsCache(l_component.get(), this->painter.get(), actualPrintingRect, l_component->sceneRect());
 		}
 	}
 }
@@ -342,8 +575,8 @@ void MachineImageExporter::renderConstants()
 {
 	if (this->includeConstant == false) return;
 
-	auto machine = machineManager->getMachine();
-	if (machine == nullptr) return;
+	auto constantScene = this->buildConstantsScene();
+	if (constantScene == nullptr) return;
 
 
 	if (this->addBorder == true)
@@ -351,6 +584,33 @@ void MachineImageExporter::renderConstants()
 		this->prepareBorder(this->constantsPrintingRect);
 	}
 
+	QRectF actualPrintingRect = this->getActualPrintedRect(constantScene->sceneRect(), this->constantsPrintingRect);
+	constantScene->render(this->painter.get(), actualPrintingRect);
+}
+
+void MachineImageExporter::renderVariables()
+{
+	if (this->includeVariables == false) return;
+
+	auto variableScene = this->buildVariablesScene();
+	if (variableScene == nullptr) return;
+
+
+	if (this->addBorder == true)
+	{
+		this->prepareBorder(this->variablesPrintingRect);
+	}
+
+	QRectF actualPrintingRect = this->getActualPrintedRect(variableScene->sceneRect(), this->variablesPrintingRect);
+	variableScene->render(this->painter.get(), actualPrintingRect);
+}
+
+shared_ptr<QGraphicsScene> MachineImageExporter::buildConstantsScene()
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return nullptr;
+
+
 	shared_ptr<QGraphicsScene> constantScene(new QGraphicsScene());
 	QGraphicsTextItem* constantsTitle = new QGraphicsTextItem(tr("Constants:"));
 	constantScene->addItem(constantsTitle);
@@ -375,22 +635,14 @@ void MachineImageExporter::renderConstants()
 		pos++;
 	}
 
-	QRectF actualPrintingRect = this->getActualPrintedRect(constantScene->sceneRect(), this->constantsPrintingRect);
-	constantScene->render(this->painter.get(), actualPrintingRect);
+	return constantScene;
 }
 
-void MachineImageExporter::renderVariables()
+shared_ptr<QGraphicsScene> MachineImageExporter::buildVariablesScene()
 {
-	if (this->includeVariables == false) return;
-
 	auto machine = machineManager->getMachine();
-	if (machine == nullptr) return;
-
+	if (machine == nullptr) return nullptr;
 
-	if (this->addBorder == true)
-	{
-		this->prepareBorder(this->variablesPrintingRect);
-	}
 
 	shared_ptr<QGraphicsScene> variableScene(new QGraphicsScene());
 	QGraphicsTextItem* text = new QGraphicsTextItem(tr("Variables:"));
@@ -417,11 +669,15 @@ void MachineImageExporter::renderVariables()
 		pos++;
 	}
 
-	QRectF actualPrintingRect = this->getActualPrintedRect(variableScene->sceneRect(), this->variablesPrintingRect);
-	variableScene->render(this->painter.get(), actualPrintingRect);
+	return variableScene;
 }
 
 void MachineImageExporter::prepareBorder(const QRectF& availablePrintingRect)
+{
+	this->border->addRect(this->getBorderRect(availablePrintingRect));
+}
+
+QRectF MachineImageExporter::getBorderRect(const QRectF& availablePrintingRect)
 {
 	QRectF borderRect = availablePrintingRect;
 	borderRect.adjust(-this->spacer/2, -this->spacer/2, this->spacer/2, this->spacer/2);
@@ -440,7 +696,8 @@ void MachineImageExporter::prepareBorder(const QRectF& availablePrintingRect)
 		if (borderRect.bottom() < this->renderAreaWithoutBordersRect.bottom())
 			borderRect.setBottom(this->renderAreaWithoutBordersRect.bottom());
 	}
-	this->border->addRect(borderRect);
+
+	return borderRect;
 }
 
 void MachineImageExporter::renderBorder()
@@ -452,6 +709,67 @@ void MachineImageExporter::renderBorder()
 	this->border.reset();
 }
 
+/**
+ * @brief MachineImageExporter::recordPanels records all panels
+ * of the preview at their own size, whether they are included
+ * or not, so that options changes do not require a new recording.
+ */
+void MachineImageExporter::recordPanels()
+{
+	this->scene->flushPendingGeometryRefreshes();
+
+	this->recordPanel(this->sceneRecording, this->scene);
+
+	shared_ptr<QGraphicsScene> l_component = this->component.lock();
+	this->recordPanel(this->componentRecording, l_component.get());
+
+	auto constantScene = this->buildConstantsScene();
+	this->recordPanel(this->constantsRecording, constantScene.get());
+
+	auto variableScene = this->buildVariablesScene();
+	this->recordPanel(this->variablesRecording, variableScene.get());
+
+	this->panelsRecorded = true;
+}
+
+void MachineImageExporter::recordPanel(PanelRecording_t& recording, QGraphicsScene* panelScene)
+{
+	recording = PanelRecording_t();
+
+	if (panelScene == nullptr) return;
+
+
+	recording.rect = QRectF(QPointF(0, 0), panelScene->sceneRect().size());
+
+	QPainter recordingPainter(&recording.picture);
+	recordingPainter.setRenderHint(QPainter::Antialiasing);
+	MachineImageExporter::renderWithoutItemsCache(panelScene, &recordingPainter, recording.rect, panelScene->sceneRect());
+	recordingPainter.end();
+}
+
+/**
+ * @brief MachineImageExporter::appendPreviewLayer adds a panel
+ * to the preview. The recording is copied, as pictures can not
+ * be shared between threads.
+ */
+void MachineImageExporter::appendPreviewLayer(Preview_t& preview, const PanelRecording_t& recording, const QRectF& availablePrintingRect)
+{
+	if (recording.rect.isEmpty() == true) return;
+
+
+	PreviewLayer_t layer;
+	layer.picture.setData(recording.picture.data(), recording.picture.size());
+	layer.sourceRect = recording.rect;
+	layer.targetRect = this->getActualPrintedRect(recording.rect, availablePrintingRect);
+
+	preview.layers.append(layer);
+
+	if (this->addBorder == true)
+	{
+		preview.borders.append(this->getBorderRect(availablePrintingRect));
+	}
+}
+
 QRectF MachineImageExporter::getActualPrintedRect(const QRectF& elementPrintingRect, const QRectF& availablePrintingRect)
 {
 	QSizeF actualPrintingSize = elementPrintingRect.size();
@@ -31,6 +31,9 @@ using namespace std;
 
 // Qt classes
 #include <QRectF>
+#include <QList>
+#include <QPicture>
+#include <QImage>
 class QGraphicsScene;
 class QPainter;
 class QPrinter;
@@ -45,6 +48,40 @@ class MachineImageExporter : public QObject
 {
 	Q_OBJECT
 
+	/////
+	// Type declarations
+public:
+	// A panel recording, drawn from its source rect to a target rect
+	struct PreviewLayer_t
+	{
+		QPicture picture;
+		QRectF   sourceRect;
+		QRectF   targetRect;
+	};
+
+	// Self-contained description of a preview, which can be rendered from any thread
+	struct Preview_t
+	{
+		QSize size;
+		QList<PreviewLayer_t> layers;
+		QList<QRectF> borders;
+	};
+
+private:
+	struct PanelRecording_t
+	{
+		QPicture picture;
+		QRectF   rect;
+	};
+
+	/////
+	// Static functions
+public:
+	static QImage renderPreview(const Preview_t& preview);
+
+private:
+	static void renderWithoutItemsCache(QGraphicsScene* scene, QPainter* painter, const QRectF& target, const QRectF& source);
+
 	/////
 	// Constructors/destructors
 public:
@@ -59,16 +96,18 @@ public:
 	void setDisplayBorder(bool doDisplay);
 	void setMainSceneRatio(uint sceneRatio);
 	void setInfoPos(LeftRight_t pos);
+	void setBitmapScale(qreal scale);
 
-	shared_ptr<QPixmap> renderPreview(QSizeF previewSize);
-	void doExport(const QString& path, ImageFormat_t format, const QString& creator = QString()); // TODO: throw StatesException for file access
+	Preview_t preparePreview(QSizeF previewSize);
+	void clearPreviewCache();
+	bool doExport(const QString& path, ImageFormat_t format, const QString& creator = QString());
 
 private:
 	void generatePrintingRects();
 	void preparePdfPrinter(const QString& path, const QString& title, const QString& creator);
-	void renderPdf();
-	void renderSvg(const QString& path, const QString& title, const QString& creator);
-	void renderBitmap();
+	bool renderPdf();
+	bool renderSvg(const QString& path, const QString& title, const QString& creator);
+	bool renderTiledBitmap(const QString& path);
 
 	void renderOnPainter();
 
@@ -76,7 +115,13 @@ private:
 	void renderComponent();
 	void renderConstants();
 	void renderVariables();
+	shared_ptr<QGraphicsScene> buildConstantsScene();
+	shared_ptr<QGraphicsScene> buildVariablesScene();
 	void prepareBorder(const QRectF& availablePrintingRect);
+	QRectF getBorderRect(const QRectF& availablePrintingRect);
+	void recordPanels();
+	void recordPanel(PanelRecording_t& recording, QGraphicsScene* panelScene);
+	void appendPreviewLayer(Preview_t& preview, const PanelRecording_t& recording, const QRectF& availablePrintingRect);
 	void renderBorder();
 
 	QRectF getActualPrintedRect(const QRectF& elementPrintingRect, const QRectF& availablePrintingRect);
@@ -88,6 +133,9 @@ private:
 private:
 	const qreal spacer = 50;
 
+	// Size in pixels of tiles rendered in parallel for bitmap exports
+	static const int bitmapTileSize = 1024;
+
 	// Required elements
 	GenericScene* scene;
 	weak_ptr<QGraphicsScene> component;
@@ -100,12 +148,12 @@ private:
 	bool includeVariables;
 	bool addBorder;
 	LeftRight_t infoPosition = LeftRight_t::left;
+	qreal bitmapScale = 1;
 	bool strictBorders;
 
 	// There objects handle rendering on file. All must be persistent until export is over
 	shared_ptr<QPrinter>      printer;
 	shared_ptr<QSvgGenerator> generator;
-	shared_ptr<QPixmap>       pixmap;
 
 	// Object we paint on
 	shared_ptr<QPainter> painter;
@@ -118,6 +166,13 @@ private:
 	QRectF constantsPrintingRect;
 	QRectF variablesPrintingRect;
 
+	// Preview cache: panels are recorded once, then only laid out
+	bool panelsRecorded = false;
+	PanelRecording_t sceneRecording;
+	PanelRecording_t componentRecording;
+	PanelRecording_t constantsRecording;
+	PanelRecording_t variablesRecording;
+
 };
 
 #endif // MACHINEIMAGEEXPORTER_H
@@ -24,12 +24,18 @@
 
 // Qt classes
 #include <QPen>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
 
 
 //
 // Static members
 //
 
+// Public
+const qreal GraphicComponent::textLevelOfDetailThreshold    = 0.4;
+const qreal GraphicComponent::detailsLevelOfDetailThreshold = 0.2;
+
 // Protected
 const int GraphicComponent::defaultLineThickness = 3;
 
@@ -50,6 +56,21 @@ const QColor GraphicComponent::selectionShapeBorderColor = QColor(0, 0, 204, 200
 const QPen GraphicComponent::selectionShapePen = QPen(QBrush(GraphicComponent::selectionShapeBorderColor, Qt::SolidPattern), GraphicComponent::selectionLineThickness, Qt::DashLine);
 
 
+/**
+ * @brief GraphicComponent::getLevelOfDetail returns the
+ * level of detail (i.e. the scale factor between item
+ * and device coordinates) the painter is currently
+ * drawing at. This allows items to simplify their
+ * rendering when zoomed out.
+ */
+qreal GraphicComponent::getLevelOfDetail(const QPainter* painter)
+{
+	if (painter == nullptr) return 1;
+
+
+	return QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+}
+
 //
 // Class object definition
 //
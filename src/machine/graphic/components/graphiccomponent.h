@@ -27,6 +27,7 @@
 
 // Qt classes
 class QAbstractGraphicsShapeItem;
+class QPainter;
 
 // StateS classes
 #include "statestypes.h"
@@ -36,8 +37,19 @@ class GraphicComponent : public QGraphicsObject
 {
 	Q_OBJECT
 
+	/////
+	// Static functions
+public:
+	static qreal getLevelOfDetail(const QPainter* painter);
+
 	/////
 	// Static variables
+public:
+	// Below this level of detail, texts are replaced by a simplified glyph
+	static const qreal textLevelOfDetailThreshold;
+	// Below this level of detail, secondary items (arrow ends, action boxes, etc.) are not drawn at all
+	static const qreal detailsLevelOfDetailThreshold;
+
 protected:
 	static const int    defaultLineThickness;
 
@@ -30,6 +30,9 @@
 // Static members
 //
 
-const QColor GraphicSimulatedComponent::simuActiveFillingColor  = Qt::green;
-const QColor GraphicSimulatedComponent::simuInactiveBorderColor = Qt::red;
-const QColor GraphicSimulatedComponent::simuActiveBorderColor   = QColor(0, 0xB0, 0);
+const QColor GraphicSimulatedComponent::simuActiveFillingColor    = Qt::green;
+const QColor GraphicSimulatedComponent::simuInactiveBorderColor   = Qt::red;
+const QColor GraphicSimulatedComponent::simuActiveBorderColor     = QColor(0, 0xB0, 0);
+const QColor GraphicSimulatedComponent::simuBreakpointBorderColor = QColor(0xC0, 0, 0xC0);
+const QColor GraphicSimulatedComponent::simuUncoveredFillingColor = QColor(0xFF, 0xC8, 0x80);
+const QColor GraphicSimulatedComponent::simuUncoveredBorderColor  = QColor(0xFF, 0x80, 0);
@@ -34,6 +34,9 @@ protected:
 	static const QColor simuActiveFillingColor;
 	static const QColor simuInactiveBorderColor;
 	static const QColor simuActiveBorderColor;
+	static const QColor simuBreakpointBorderColor;
+	static const QColor simuUncoveredFillingColor;
+	static const QColor simuUncoveredBorderColor;
 
 	/////
 	// Constructors/destructors
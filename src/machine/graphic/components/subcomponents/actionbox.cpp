@@ -33,6 +33,8 @@
 #include "machineactuatorcomponent.h"
 #include "variable.h"
 #include "actiononvariable.h"
+#include "levelofdetailtextitem.h"
+#include "levelofdetailpathitem.h"
 
 
 //
@@ -99,7 +101,8 @@ void ActionBox::buildActionBox()
 
 		if (currentVariable->getMemorized() == true)
 		{
-			auto memorizedText = new QGraphicsTextItem(this);
+			auto memorizedText = new LevelOfDetailTextItem(this);
+			memorizedText->setDisplayGlyph(false);
 			memorizedText->setHtml("<span style=\"color:black;\">M</span>");
 			currentTextWidth += memorizedText->boundingRect().width();
 
@@ -114,7 +117,7 @@ void ActionBox::buildActionBox()
 			memorizedBorderPath.lineTo(currentTextWidth, 0);
 			memorizedBorderPath.lineTo(0,                0);
 
-			auto memorizedOutline = new QGraphicsPathItem(memorizedBorderPath, this);
+			auto memorizedOutline = new LevelOfDetailPathItem(memorizedBorderPath, this);
 			memorizedOutline->setPen(defaultPen);
 			memorizedOutline->setZValue(1);
 			memorizedOutline->setPos(xPos, i*this->textHeight);
@@ -174,7 +177,7 @@ void ActionBox::buildActionBox()
 
 		currentActionText += "</span>";
 
-		QGraphicsTextItem* actionText = new QGraphicsTextItem(this);
+		auto actionText = new LevelOfDetailTextItem(this);
 		actionText->setHtml(currentActionText);
 		currentTextWidth += actionText->boundingRect().width();
 
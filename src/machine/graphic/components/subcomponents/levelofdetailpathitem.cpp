@@ -0,0 +1,41 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "levelofdetailpathitem.h"
+
+// StateS classes
+#include "graphiccomponent.h"
+
+
+LevelOfDetailPathItem::LevelOfDetailPathItem(const QPainterPath& path, QGraphicsItem* parent) :
+	QGraphicsPathItem(path, parent)
+{
+
+}
+
+void LevelOfDetailPathItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+	if (GraphicComponent::getLevelOfDetail(painter) >= GraphicComponent::detailsLevelOfDetailThreshold)
+	{
+		QGraphicsPathItem::paint(painter, option, widget);
+	}
+}
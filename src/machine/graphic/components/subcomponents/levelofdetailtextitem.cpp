@@ -0,0 +1,75 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "levelofdetailtextitem.h"
+
+// Qt classes
+#include <QPainter>
+#include <QTextDocument>
+
+// StateS classes
+#include "graphiccomponent.h"
+
+
+//
+// Static members
+//
+
+const QBrush LevelOfDetailTextItem::glyphBrush = QBrush(QColor(160, 160, 160), Qt::SolidPattern);
+
+
+//
+// Class object definition
+//
+
+LevelOfDetailTextItem::LevelOfDetailTextItem(QGraphicsItem* parent) :
+	QGraphicsTextItem(parent)
+{
+	this->setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+}
+
+/**
+ * @brief LevelOfDetailTextItem::setDisplayGlyph sets whether
+ * a glyph is drawn in place of the text when zoomed out.
+ * If not, the text simply disappears.
+ */
+void LevelOfDetailTextItem::setDisplayGlyph(bool displayGlyph)
+{
+	this->displayGlyph = displayGlyph;
+	this->update();
+}
+
+void LevelOfDetailTextItem::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+	qreal levelOfDetail = GraphicComponent::getLevelOfDetail(painter);
+
+	if (levelOfDetail >= GraphicComponent::textLevelOfDetailThreshold)
+	{
+		QGraphicsTextItem::paint(painter, option, widget);
+	}
+	else if ( (this->displayGlyph == true) && (levelOfDetail >= GraphicComponent::detailsLevelOfDetailThreshold) )
+	{
+		// Only keep a block the size of the text, without the document margins
+		qreal margin = this->document()->documentMargin();
+		painter->fillRect(this->boundingRect().adjusted(margin, margin, -margin, -margin), LevelOfDetailTextItem::glyphBrush);
+	}
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LEVELOFDETAILTEXTITEM_H
+#define LEVELOFDETAILTEXTITEM_H
+
+// Parent
+#include <QGraphicsTextItem>
+
+
+/**
+ * @brief The LevelOfDetailTextItem class is a text item
+ * that adapts its rendering to the zoom level: when text
+ * would be unreadable, it is replaced by a simplified glyph,
+ * then dropped altogether when zoomed out further.
+ * As text rendering is costly, the item is cached in device
+ * coordinates. Image exports disable the cache while rendering
+ * so that vector formats keep actual text rather than bitmaps.
+ */
+class LevelOfDetailTextItem : public QGraphicsTextItem
+{
+	Q_OBJECT
+
+	/////
+	// Static variables
+private:
+	static const QBrush glyphBrush;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit LevelOfDetailTextItem(QGraphicsItem* parent = nullptr);
+
+	/////
+	// Object functions
+public:
+	void setDisplayGlyph(bool displayGlyph);
+
+protected:
+	virtual void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget) override;
+
+	/////
+	// Object variables
+private:
+	bool displayGlyph = true;
+
+};
+
+#endif // LEVELOFDETAILTEXTITEM_H
@@ -34,6 +34,7 @@
 #include "fsmstate.h"
 #include "contextmenu.h"
 #include "actionbox.h"
+#include "levelofdetailtextitem.h"
 
 
 //
@@ -305,7 +306,7 @@ void GraphicFsmState::refreshChildrenItems()
 	// State name
 	if (this->stateName == nullptr)
 	{
-		this->stateName = new QGraphicsTextItem(this);
+		this->stateName = new LevelOfDetailTextItem(this);
 	}
 
 	this->stateName->setHtml("<span style=\"color:black;\">" + logicState->getName() + "</span>");
@@ -27,6 +27,7 @@
 #include <QKeyEvent>
 #include <QPainter>
 #include <QGraphicsView>
+#include <QTimer>
 
 // States classes
 #include "machinemanager.h"
@@ -39,6 +40,8 @@
 #include "operand.h"
 #include "actionbox.h"
 #include "contextmenu.h"
+#include "levelofdetailtextitem.h"
+#include "levelofdetailpathitem.h"
 
 
 //
@@ -47,6 +50,8 @@
 
 const qreal GraphicFsmTransition::arrowEndSize = 10;
 const qreal GraphicFsmTransition::conditionLineLength = 20;
+const int   GraphicFsmTransition::geometryRefreshDelay = 16;
+const int   GraphicFsmTransition::boundingSegmentsCount = 16;
 
 
 QPixmap GraphicFsmTransition::getPixmap(uint size)
@@ -103,7 +108,7 @@ GraphicFsmTransition::GraphicFsmTransition(componentId_t logicComponentId) :
 	this->refreshChildrenItems();
 
 	// Build external items
-	this->conditionText = new QGraphicsTextItem();
+	this->conditionText = new LevelOfDetailTextItem();
 	this->actionBox = new ActionBox(logicComponentId);
 
 	this->refreshExternalItems();
@@ -151,18 +156,25 @@ GraphicFsmTransition::~GraphicFsmTransition()
 
 void GraphicFsmTransition::refreshDisplay()
 {
-	// Rebuild body
-	this->clearArrowBody();
-	this->buildArrowBody();
-
-	// Reposition other items
-	this->refreshChildrenItems();
+	// Rebuild external items content
 	this->refreshExternalItems();
 
-	// As we deleted and rebuilt the whole shape,
-	// we have to check if the item is selected
-	// and rebuild the selection shape if so.
-	this->refreshSelectionShapeVisibility();
+	// Then geometry
+	this->refreshGeometry();
+}
+
+/**
+ * @brief GraphicFsmTransition::flushPendingGeometryRefresh applies
+ * a geometry refresh delayed by connected states moves. It must be
+ * called before relying on the transition geometry, e.g. before
+ * computing the scene extent or rendering the scene for export.
+ */
+void GraphicFsmTransition::flushPendingGeometryRefresh()
+{
+	if (this->geometryRefreshPending == false) return;
+
+
+	this->refreshGeometry();
 }
 
 componentId_t GraphicFsmTransition::getSourceStateId() const
@@ -201,7 +213,72 @@ QPainterPath GraphicFsmTransition::shape() const
 
 QRectF GraphicFsmTransition::boundingRect() const
 {
-	return this->boundingShape.boundingRect();
+	return this->boundingShapeRect;
+}
+
+/**
+ * @brief GraphicFsmTransition::contains is used for hover and
+ * click detection. As a transition's bounding rect can be much
+ * larger than its actual shape, the point is first checked
+ * against the segments bounding rects so that the full shape
+ * is only tested when the point is close to the transition.
+ */
+bool GraphicFsmTransition::contains(const QPointF& point) const
+{
+	if (this->boundingShapeRect.contains(point) == false) return false;
+
+
+	for (const QRectF& segmentRect : this->boundingSegmentsRects)
+	{
+		if (segmentRect.contains(point) == true)
+		{
+			return this->boundingShape.contains(point);
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief GraphicFsmTransition::collidesWithPath is used for
+ * rubber-band selection. The default implementation uses the
+ * clip path, which is costly to compute as the item clips to
+ * its shape: as the clip path is the bounding shape itself,
+ * directly use the latter, after a first check on segments.
+ */
+bool GraphicFsmTransition::collidesWithPath(const QPainterPath& path, Qt::ItemSelectionMode mode) const
+{
+	if ( (mode != Qt::IntersectsItemShape) && (mode != Qt::ContainsItemShape) )
+	{
+		return GraphicComponent::collidesWithPath(path, mode);
+	}
+
+	if (this->boundingShape.isEmpty() == true) return false;
+
+
+	QRectF pathRect = path.controlPointRect();
+
+	bool isNearPath = false;
+	for (const QRectF& segmentRect : this->boundingSegmentsRects)
+	{
+		if (segmentRect.intersects(pathRect) == true)
+		{
+			isNearPath = true;
+			break;
+		}
+	}
+
+	if (isNearPath == false) return false;
+
+
+	if (mode == Qt::IntersectsItemShape)
+	{
+		return path.intersects(this->boundingShape);
+	}
+	else // (mode == Qt::ContainsItemShape)
+	{
+		return path.contains(this->boundingShape);
+	}
 }
 
 ActionBox* GraphicFsmTransition::getActionBox() const
@@ -346,9 +423,19 @@ void GraphicFsmTransition::setConditionColor(QColor color)
 	this->repaint();
 }
 
+/**
+ * @brief GraphicFsmTransition::connectedStateMovedEventHandler
+ * is called each time a connected state moves. As this can happen
+ * many times per frame when dragging a state, the geometry refresh
+ * is delayed so that successive moves are handled at once.
+ */
 void GraphicFsmTransition::connectedStateMovedEventHandler()
 {
-	this->refreshDisplay();
+	if (this->geometryRefreshPending == true) return;
+
+
+	this->geometryRefreshPending = true;
+	QTimer::singleShot(GraphicFsmTransition::geometryRefreshDelay, this, &GraphicFsmTransition::flushPendingGeometryRefresh);
 }
 
 void GraphicFsmTransition::updateConditionText()
@@ -412,12 +499,26 @@ QAbstractGraphicsShapeItem* GraphicFsmTransition::buildSelectionShape()
 	return new QGraphicsPathItem(this->boundingShape, this);
 }
 
-void GraphicFsmTransition::clearArrowBody()
+/**
+ * @brief GraphicFsmTransition::refreshGeometry recomputes
+ * the transition shape and the position of all its items.
+ * Items content is left untouched.
+ */
+void GraphicFsmTransition::refreshGeometry()
 {
-	delete this->arrowBody;
-	this->arrowBody = nullptr;
+	this->geometryRefreshPending = false;
+
+	// Rebuild body
+	this->buildArrowBody();
+
+	// Reposition other items
+	this->refreshChildrenItems();
+	this->repositionExternalItems();
 
+	// As shape changed, selection shape is obsolete:
+	// rebuild it if the item is selected.
 	this->clearSelectionShape();
+	this->refreshSelectionShapeVisibility();
 }
 
 void GraphicFsmTransition::buildArrowBody()
@@ -525,7 +626,52 @@ void GraphicFsmTransition::buildArrowEnd()
 	arrowPath.moveTo(0, 0);
 	arrowPath.lineTo(0, GraphicFsmTransition::arrowEndSize);
 
-	this->arrowEnd = new QGraphicsPathItem(arrowPath, this);
+	this->arrowEnd = new LevelOfDetailPathItem(arrowPath, this);
+}
+
+/**
+ * @brief GraphicFsmTransition::useStraightArrowBody selects
+ * the straight line as arrow body. Body items are kept between
+ * refreshes and only their geometry is updated.
+ */
+QGraphicsLineItem* GraphicFsmTransition::useStraightArrowBody()
+{
+	if (this->straightBody == nullptr)
+	{
+		this->straightBody = new QGraphicsLineItem(this);
+	}
+
+	if (this->curvedBody != nullptr)
+	{
+		this->curvedBody->setVisible(false);
+	}
+
+	this->straightBody->setVisible(true);
+	this->arrowBody = this->straightBody;
+
+	return this->straightBody;
+}
+
+/**
+ * @brief GraphicFsmTransition::useCurvedArrowBody selects
+ * the curved path as arrow body. See useStraightArrowBody.
+ */
+QGraphicsPathItem* GraphicFsmTransition::useCurvedArrowBody()
+{
+	if (this->curvedBody == nullptr)
+	{
+		this->curvedBody = new QGraphicsPathItem(this);
+	}
+
+	if (this->straightBody != nullptr)
+	{
+		this->straightBody->setVisible(false);
+	}
+
+	this->curvedBody->setVisible(true);
+	this->arrowBody = this->curvedBody;
+
+	return this->curvedBody;
 }
 
 void GraphicFsmTransition::refreshChildrenItems()
@@ -545,13 +691,23 @@ void GraphicFsmTransition::refreshExternalItems()
 	if (this->conditionText != nullptr)
 	{
 		this->updateConditionText();
-		this->conditionText->setPos(mapToScene(this->conditionLinePos) + QPointF(0, 5));
 	}
 
 	if (this->actionBox != nullptr)
 	{
 		this->actionBox->refreshDisplay();
-		if (this->conditionText != nullptr)
+	}
+
+	this->repositionExternalItems();
+}
+
+void GraphicFsmTransition::repositionExternalItems()
+{
+	if (this->conditionText != nullptr)
+	{
+		this->conditionText->setPos(mapToScene(this->conditionLinePos) + QPointF(0, 5));
+
+		if (this->actionBox != nullptr)
 		{
 			this->actionBox->setPos(mapToScene(this->conditionLinePos + this->conditionText->boundingRect().bottomLeft() + QPointF(0, 5)));
 		}
@@ -615,6 +771,13 @@ void GraphicFsmTransition::rebuildBoundingShape()
 		path.angleAtPercent(arrowBodyStraightLine->rotation());
 
 		t.rotate(-straightLine.angle());
+
+		QPainterPath outterLine(boundRect.topLeft());
+		outterLine.lineTo(boundRect.topRight());
+		QPainterPath innerLine(boundRect.bottomLeft());
+		innerLine.lineTo(boundRect.bottomRight());
+
+		this->rebuildBoundingSegments(outterLine, innerLine, t);
 	}
 	else if (this->sourceStateId == this->targetStateId)
 	{
@@ -635,6 +798,8 @@ void GraphicFsmTransition::rebuildBoundingShape()
 		outterPath.translate(0, GraphicFsmTransition::conditionLineLength/2);
 		innerPath.translate(0, -GraphicFsmTransition::conditionLineLength/2);
 
+		this->rebuildBoundingSegments(outterPath, innerPath, t);
+
 		innerPath = innerPath.toReversed();
 
 		path.moveTo(outterPath.pointAtPercent(0));
@@ -673,6 +838,9 @@ void GraphicFsmTransition::rebuildBoundingShape()
 			innerPath.translate((arrowPath.boundingRect().width()-innerPath.boundingRect().width())/2, GraphicFsmTransition::conditionLineLength/2);
 		}
 
+		t.rotate(-this->sceneAngle);
+		this->rebuildBoundingSegments(outterPath, innerPath, t);
+
 		innerPath = innerPath.toReversed();
 
 		path.moveTo(outterPath.pointAtPercent(0));
@@ -681,11 +849,41 @@ void GraphicFsmTransition::rebuildBoundingShape()
 		path.connectPath(innerPath);
 
 		path.closeSubpath();
-
-		t.rotate(-this->sceneAngle);
 	}
 
 	this->boundingShape = t.map(path);
+	this->boundingShapeRect = this->boundingShape.boundingRect();
+}
+
+/**
+ * @brief GraphicFsmTransition::rebuildBoundingSegments splits the
+ * bounding shape, delimited by its outter and inner borders, in
+ * sections and stores the bounding rect of each. For long or curved
+ * transitions, the union of these rects is much tighter than
+ * the transition's bounding rect.
+ */
+void GraphicFsmTransition::rebuildBoundingSegments(const QPainterPath& outterPath, const QPainterPath& innerPath, const QTransform& transform)
+{
+	this->boundingSegmentsRects.clear();
+
+	// Sections are built using points on the borders, which may not exactly
+	// match the curve in between: add a margin to make sure the rects cover it
+	qreal margin = GraphicFsmTransition::conditionLineLength/4;
+
+	QPointF previousOutterPoint = transform.map(outterPath.pointAtPercent(0));
+	QPointF previousInnerPoint  = transform.map(innerPath.pointAtPercent(0));
+	for (int i = 1 ; i <= GraphicFsmTransition::boundingSegmentsCount ; i++)
+	{
+		qreal percent = ((qreal)i)/GraphicFsmTransition::boundingSegmentsCount;
+		QPointF outterPoint = transform.map(outterPath.pointAtPercent(percent));
+		QPointF innerPoint  = transform.map(innerPath.pointAtPercent(percent));
+
+		QPolygonF section({previousOutterPoint, outterPoint, innerPoint, previousInnerPoint});
+		this->boundingSegmentsRects.append(section.boundingRect().adjusted(-margin, -margin, margin, margin));
+
+		previousOutterPoint = outterPoint;
+		previousInnerPoint  = innerPoint;
+	}
 }
 
 void GraphicFsmTransition::drawStraightTransition(QPointF currentSourcePoint, QPointF currentTargetPoint)
@@ -707,10 +905,9 @@ void GraphicFsmTransition::drawStraightTransition(QPointF currentSourcePoint, QP
 		straightLine.setLength(straightLine.length() - 2*GraphicFsmState::getRadius());
 	}
 
-	// Create line graphic representation
-	QGraphicsLineItem* line = new QGraphicsLineItem(this);
+	// Update line graphic representation
+	QGraphicsLineItem* line = this->useStraightArrowBody();
 	line->setLine(straightLine);
-	this->arrowBody = line;
 
 	// If source is a state, line should be translated to begin on state border
 	if ( !((this->currentMode == Mode_t::dynamicSourceMode) && (this->dynamicStateId == nullId)) )
@@ -801,8 +998,9 @@ void GraphicFsmTransition::drawAutoTransition(QPointF currentSourcePoint)
 
 	arc.lineTo(stateCenterToArcEndVector.p2());
 
-	QGraphicsPathItem* arcItem = new QGraphicsPathItem(arc, this);
-	this->arrowBody = arcItem;
+	QGraphicsPathItem* arcItem = this->useCurvedArrowBody();
+	arcItem->setPath(arc);
+	arcItem->setTransform(QTransform());
 
 	//
 	// Compute condition line position (only in standard mode, not displayed in other modes)
@@ -892,7 +1090,8 @@ void GraphicFsmTransition::drawCurvedTransition(QPointF currentSourcePoint, QPoi
 	QPainterPath path;
 	path.quadTo(deltaSystemCPoint, deltaSystemXVector.p2());
 
-	QGraphicsPathItem* curve = new QGraphicsPathItem(path, this);
+	QGraphicsPathItem* curve = this->useCurvedArrowBody();
+	curve->setPath(path);
 
 	// Drawing in a horizontal coordinates, then rotate.
 	// This is probably too much, but it was easier to reprensent in my mind ;)
@@ -912,8 +1111,6 @@ void GraphicFsmTransition::drawCurvedTransition(QPointF currentSourcePoint, QPoi
 	// Compute scene angle
 	this->sceneAngle = QLineF(QPointF(0,0), curveTarget).angle();
 
-	this->arrowBody = curve;
-
 	//
 	// Compute condition line position (only in standard mode, not displayed in other modes)
 
@@ -52,6 +52,10 @@ public:
 private:
 	static const qreal arrowEndSize;
 	static const qreal conditionLineLength;
+	// Delay (in ms) used to coalesce geometry refreshes when connected states are moving
+	static const int   geometryRefreshDelay;
+	// Number of segments the bounding shape is split into for hit-testing
+	static const int   boundingSegmentsCount;
 
 	/////
 	// Constructors/destructors
@@ -69,6 +73,7 @@ public:
 	// Object functions
 public:
 	virtual void refreshDisplay() override;
+	void flushPendingGeometryRefresh();
 
 	componentId_t getSourceStateId() const;
 	componentId_t getTargetStateId() const;
@@ -80,6 +85,8 @@ public:
 
 	virtual QPainterPath shape() const override;
 	virtual QRectF boundingRect() const override;
+	virtual bool contains(const QPointF& point) const override;
+	virtual bool collidesWithPath(const QPainterPath& path, Qt::ItemSelectionMode mode = Qt::IntersectsItemShape) const override;
 
 	ActionBox* getActionBox() const;
 
@@ -106,17 +113,21 @@ private slots:
 private:
 	virtual QAbstractGraphicsShapeItem* buildSelectionShape() override;
 
-	void clearArrowBody();
+	void refreshGeometry();
 
 	void buildArrowBody();
 	void buildArrowEnd();
+	QGraphicsLineItem* useStraightArrowBody();
+	QGraphicsPathItem* useCurvedArrowBody();
 
 	void refreshChildrenItems();
 	void refreshExternalItems();
+	void repositionExternalItems();
 
 	void initializeDefaults();
 	void repaint();
 	void rebuildBoundingShape();
+	void rebuildBoundingSegments(const QPainterPath& outterPath, const QPainterPath& innerPath, const QTransform& transform);
 
 	void drawStraightTransition(QPointF currentSourcePoint, QPointF currentTargetPoint);
 	void drawAutoTransition(QPointF currentSourcePoint);
@@ -149,7 +160,9 @@ private:
 	bool isUnderEdit = false;
 
 	// Children items
-	QGraphicsItem*     arrowBody     = nullptr;
+	QGraphicsItem*     arrowBody     = nullptr; // Points to the body currently in use among the two below
+	QGraphicsLineItem* straightBody  = nullptr;
+	QGraphicsPathItem* curvedBody    = nullptr;
 	QGraphicsPathItem* arrowEnd      = nullptr;
 	QGraphicsLineItem* conditionLine = nullptr;
 
@@ -167,6 +180,13 @@ private:
 
 	// Retain bounding shape for selection
 	QPainterPath boundingShape;
+	QRectF       boundingShapeRect;
+	// Bounding rects of successive sections of the bounding shape, used
+	// to discard hit-tests before testing against the whole shape
+	QList<QRectF> boundingSegmentsRects;
+
+	// Set when a geometry refresh has been requested but not yet processed
+	bool geometryRefreshPending = false;
 
 	// Position of the condition line in %
 	qreal conditionLineSliderPos = 0.5;
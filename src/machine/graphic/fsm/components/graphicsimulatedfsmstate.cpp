@@ -29,6 +29,8 @@
 
 // StateS classes
 #include "machinemanager.h"
+#include "machinesimulator.h"
+#include "simulationbreakpoints.h"
 #include "graphicfsm.h"
 #include "simulatedfsm.h"
 #include "simulatedfsmstate.h"
@@ -65,15 +67,41 @@ void GraphicSimulatedFsmState::refreshSimulatedDisplay()
 	if (simulatedState == nullptr) return;
 
 
+	auto machineSimulator = machineManager->getMachineSimulator();
+
+	QColor fillingColor;
 	if (simulatedState->getIsActive() == true)
 	{
-		this->setFillingColor(GraphicSimulatedComponent::simuActiveFillingColor);
+		fillingColor = GraphicSimulatedComponent::simuActiveFillingColor;
+	}
+	else if ( (machineSimulator != nullptr) && (machineSimulator->getCoverageOverlayEnabled() == true) && (machineSimulator->getCoverage().getStateVisits(this->getLogicComponentId()) == 0) )
+	{
+		fillingColor = GraphicSimulatedComponent::simuUncoveredFillingColor;
+	}
+	else
+	{
+		fillingColor = GraphicComponent::defaultFillingColor;
+	}
+
+	QColor borderColor;
+	if ( (machineSimulator != nullptr) && (machineSimulator->getBreakpoints()->hasStateBreakpoint(this->getLogicComponentId()) == true) )
+	{
+		borderColor = GraphicSimulatedComponent::simuBreakpointBorderColor;
 	}
 	else
 	{
-		this->setFillingColor(GraphicComponent::defaultFillingColor);
+		borderColor = GraphicComponent::defaultBorderColor;
 	}
 
+	if ( (fillingColor == this->displayedFillingColor) && (borderColor == this->displayedBorderColor) ) return;
+
+
+	this->displayedFillingColor = fillingColor;
+	this->displayedBorderColor  = borderColor;
+
+	this->setFillingColor(fillingColor);
+	this->setBorderColor(borderColor);
+
 	emit this->componentRefreshedEvent();
 }
 
@@ -117,11 +145,24 @@ void GraphicSimulatedFsmState::contextMenuEvent(QGraphicsSceneContextMenuEvent*
 		menu->addAction(tr("Set active"));
 	}
 
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator != nullptr)
+	{
+		if (machineSimulator->getBreakpoints()->hasStateBreakpoint(this->getLogicComponentId()) == false)
+		{
+			menu->addAction(tr("Break when entered"));
+		}
+		else
+		{
+			menu->addAction(tr("Remove breakpoint"));
+		}
+	}
+
 	if (menu->actions().count() > 1) // > 1 because title is always here
 	{
 		menu->popup(event->screenPos());
 
-		connect(menu, &QMenu::triggered, this, &GraphicSimulatedFsmState::menuSetActiveTriggeredEventHandler);
+		connect(menu, &QMenu::triggered, this, &GraphicSimulatedFsmState::menuTriggeredEventHandler);
 	}
 	else
 	{
@@ -129,14 +170,23 @@ void GraphicSimulatedFsmState::contextMenuEvent(QGraphicsSceneContextMenuEvent*
 	}
 }
 
-void GraphicSimulatedFsmState::menuSetActiveTriggeredEventHandler(QAction* action)
+void GraphicSimulatedFsmState::menuTriggeredEventHandler(QAction* action)
 {
 	if (action->text() == tr("Set active"))
 	{
-		auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(machineManager->getSimulatedMachine());
-		if (simulatedFsm == nullptr) return;
+		auto machineSimulator = machineManager->getMachineSimulator();
+		if (machineSimulator == nullptr) return;
+
+
+		machineSimulator->forceStateActivation(this->getLogicComponentId());
+	}
+	else if ( (action->text() == tr("Break when entered")) || (action->text() == tr("Remove breakpoint")) )
+	{
+		auto machineSimulator = machineManager->getMachineSimulator();
+		if (machineSimulator == nullptr) return;
 
 
-		simulatedFsm->forceStateActivation(this->getLogicComponentId());
+		machineSimulator->getBreakpoints()->setStateBreakpoint(this->getLogicComponentId(), action->text() == tr("Break when entered"));
+		this->refreshSimulatedDisplay();
 	}
 }
@@ -26,6 +26,9 @@
 #include "graphicfsmstate.h"
 #include "graphicsimulatedcomponent.h"
 
+// Qt classes
+#include <QColor>
+
 // StateS classes
 #include "statestypes.h"
 
@@ -49,13 +52,20 @@ protected:
 	virtual void contextMenuEvent(QGraphicsSceneContextMenuEvent* event) override;
 
 private slots:
-	void menuSetActiveTriggeredEventHandler(QAction* action);
+	void menuTriggeredEventHandler(QAction* action);
 
 	/////
 	// Signals
 signals:
 	void componentRefreshedEvent();
 
+	/////
+	// Object variables
+private:
+	// Colors currently displayed, to only repaint on change
+	QColor displayedFillingColor;
+	QColor displayedBorderColor;
+
 };
 
 #endif // GRAPHICSIMULATEDFSMSTATE_H
@@ -22,8 +22,14 @@
 // Current class header
 #include "graphicsimulatedfsmtransition.h"
 
+// Qt classes
+#include <QGraphicsSceneContextMenuEvent>
+
 // States classes
 #include "machinemanager.h"
+#include "machinesimulator.h"
+#include "simulationbreakpoints.h"
+#include "contextmenu.h"
 #include "graphicfsm.h"
 #include "simulatedfsm.h"
 #include "simulatedfsmtransition.h"
@@ -95,16 +101,96 @@ void GraphicSimulatedFsmTransition::refreshSimulatedDisplay()
 		newColor = GraphicSimulatedComponent::simuActiveBorderColor;
 	}
 
-	// Set arrow pen
+	// Coverage overlay only applies when transition is not highlighted
+	bool displayUncrossed = false;
+	bool displayUncovered = false;
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if ( (machineSimulator != nullptr) && (machineSimulator->getCoverageOverlayEnabled() == true) && (simulatedSourceState->getIsActive() == false) )
+	{
+		const auto& coverage = machineSimulator->getCoverage();
+		displayUncrossed = (coverage.getTransitionCrossings(this->getLogicComponentId()) == 0);
+		displayUncovered = (coverage.isConditionCovered(this->getLogicComponentId()) == false);
+	}
+
+	// Arrow pen
+	QColor arrowColor;
 	if (simulatedSourceState->getIsActive() == true)
 	{
-		this->setArrowColor(newColor);
+		arrowColor = newColor;
+	}
+	else if (displayUncrossed == true)
+	{
+		arrowColor = GraphicSimulatedComponent::simuUncoveredBorderColor;
 	}
 	else
 	{
-		this->setArrowColor(GraphicComponent::defaultBorderColor);
+		arrowColor = GraphicComponent::defaultBorderColor;
 	}
 
-	// Set condition line pen
-	this->setConditionColor(newColor);
+	// Condition line pen
+	QColor conditionColor;
+	if (displayUncovered == true)
+	{
+		conditionColor = GraphicSimulatedComponent::simuUncoveredBorderColor;
+	}
+	else
+	{
+		conditionColor = newColor;
+	}
+
+	if (arrowColor != this->displayedArrowColor)
+	{
+		this->displayedArrowColor = arrowColor;
+		this->setArrowColor(arrowColor);
+	}
+
+	if (conditionColor != this->displayedConditionColor)
+	{
+		this->displayedConditionColor = conditionColor;
+		this->setConditionColor(conditionColor);
+	}
+}
+
+void GraphicSimulatedFsmTransition::contextMenuEvent(QGraphicsSceneContextMenuEvent* event)
+{
+	if (this->contains(event->pos()) == false)
+	{
+		event->ignore();
+		return;
+	}
+
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	ContextMenu* menu = new ContextMenu();
+	menu->addTitle(tr("Transition"));
+
+	if (machineSimulator->getBreakpoints()->hasTransitionBreakpoint(this->getLogicComponentId()) == false)
+	{
+		menu->addAction(tr("Break when crossed"));
+	}
+	else
+	{
+		menu->addAction(tr("Remove breakpoint"));
+	}
+	menu->popup(event->screenPos());
+
+	connect(menu, &QMenu::triggered, this, &GraphicSimulatedFsmTransition::menuTriggeredEventHandler);
+}
+
+void GraphicSimulatedFsmTransition::menuTriggeredEventHandler(QAction* action)
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	if (action->text() == tr("Break when crossed"))
+	{
+		machineSimulator->getBreakpoints()->setTransitionBreakpoint(this->getLogicComponentId(), true);
+	}
+	else if (action->text() == tr("Remove breakpoint"))
+	{
+		machineSimulator->getBreakpoints()->setTransitionBreakpoint(this->getLogicComponentId(), false);
+	}
 }
@@ -26,6 +26,9 @@
 #include "graphicfsmtransition.h"
 #include "graphicsimulatedcomponent.h"
 
+// Qt classes
+#include <QColor>
+
 // StateS classes
 #include "statestypes.h"
 
@@ -44,6 +47,19 @@ public:
 public:
 	virtual void refreshSimulatedDisplay() override;
 
+protected:
+	virtual void contextMenuEvent(QGraphicsSceneContextMenuEvent* event) override;
+
+private slots:
+	void menuTriggeredEventHandler(QAction* action);
+
+	/////
+	// Object variables
+private:
+	// Colors currently displayed, to only repaint on change
+	QColor displayedArrowColor;
+	QColor displayedConditionColor;
+
 };
 
 #endif // GRAPHICSIMULATEDFSMTRANSITION_H
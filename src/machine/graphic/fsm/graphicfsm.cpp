@@ -58,21 +58,30 @@ void GraphicFsm::buildSimulation()
 	{
 		auto simulatedState = new GraphicSimulatedFsmState(stateId);
 		this->addSimulatedComponent(simulatedState);
+		this->simulatedStatesMap[stateId] = simulatedState;
 	}
 
 	for (const auto& transitionId : fsm->getAllTransitionsIds())
 	{
 		auto simulatedTransition = new GraphicSimulatedFsmTransition(transitionId);
 		this->addSimulatedComponent(simulatedTransition);
+		this->simulatedTransitionsMap[transitionId] = simulatedTransition;
 	}
 }
 
+void GraphicFsm::clearSimulation()
+{
+	this->simulatedStatesMap.clear();
+	this->simulatedTransitionsMap.clear();
+
+	GraphicMachine::clearSimulation();
+}
+
 shared_ptr<GraphicAttributes> GraphicFsm::getGraphicAttributes() const
 {
 	auto machineConfiguration = make_shared<GraphicAttributes>();
 
-	auto states = this->getStates();
-	for (auto state : states)
+	for (auto state : this->statesMap)
 	{
 		auto id = state->getLogicComponentId();
 		auto scenePos = state->scenePos();
@@ -80,8 +89,7 @@ shared_ptr<GraphicAttributes> GraphicFsm::getGraphicAttributes() const
 		machineConfiguration->addAttribute(id, "Y", QString::number(scenePos.y()));
 	}
 
-	auto transitions = this->getTransitions();
-	for (auto transition : transitions)
+	for (auto transition : this->transitionsMap)
 	{
 		auto id = transition->getLogicComponentId();
 		auto sliderPos = (int)(transition->getConditionLineSliderPosition()*100);
@@ -101,11 +109,14 @@ GenericScene* GraphicFsm::getGraphicScene() const
 
 void GraphicFsm::removeGraphicComponent(componentId_t id)
 {
-	auto transition = this->getTransition(id);
-
-	if (transition != nullptr)
+	if (this->transitionsMap.contains(id))
 	{
 		this->removeTransitionFromNeighborhood(id);
+		this->transitionsMap.remove(id);
+	}
+	else
+	{
+		this->statesMap.remove(id);
 	}
 
 	GraphicMachine::removeGraphicComponent(id);
@@ -113,20 +124,20 @@ void GraphicFsm::removeGraphicComponent(componentId_t id)
 
 /**
  * @brief GraphicFsm::forceRefreshSimulatedDisplay is
- * needed for (re)initializing transitions colors.
+ * needed for (re)initializing transitions colors, and
+ * when a display setting (e.g. coverage overlay) changes.
+ * All components are checked, but only those whose
+ * appearance changed are repainted.
  */
 void GraphicFsm::forceRefreshSimulatedDisplay()
 {
-	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
-	if (fsm == nullptr) return;
-
-
-	for (auto transitionId : fsm->getAllTransitionsIds())
+	for (auto simulatedState : this->simulatedStatesMap)
 	{
-		auto simulatedTransition = this->getSimulatedTransition(transitionId);
-		if (simulatedTransition == nullptr) continue;
-
+		simulatedState->refreshSimulatedDisplay();
+	}
 
+	for (auto simulatedTransition : this->simulatedTransitionsMap)
+	{
 		simulatedTransition->refreshSimulatedDisplay();
 	}
 }
@@ -137,6 +148,7 @@ GraphicFsmState* GraphicFsm::addState(componentId_t logicStateId, QPointF positi
 	graphicState->setPos(position);
 
 	this->addComponent(graphicState);
+	this->statesMap[logicStateId] = graphicState;
 
 	return graphicState;
 }
@@ -147,59 +159,50 @@ GraphicFsmTransition* GraphicFsm::addTransition(componentId_t logicTransitionId,
 	graphicTransition->setConditionLineSliderPosition(sliderPos);
 
 	this->addComponent(graphicTransition);
+	this->transitionsMap[logicTransitionId] = graphicTransition;
 	this->addTransitionToNeighborhood(graphicTransition->getLogicComponentId());
 
 	return graphicTransition;
 }
 
-const QList<GraphicFsmState*> GraphicFsm::getStates() const
+const QMap<componentId_t, GraphicFsmState*>& GraphicFsm::getStates() const
 {
-	QList<GraphicFsmState*> statesList;
-
-	for (GraphicComponent* graphicComponent : this->getGraphicComponents())
-	{
-		GraphicFsmState* s = dynamic_cast<GraphicFsmState*>(graphicComponent);
-		if (s != nullptr) statesList.append(s);
-	}
-
-	return statesList;
+	return this->statesMap;
 }
 
-const QList<GraphicFsmTransition*> GraphicFsm::getTransitions() const
+const QMap<componentId_t, GraphicFsmTransition*>& GraphicFsm::getTransitions() const
 {
-	QList<GraphicFsmTransition*> transitionsList;
+	return this->transitionsMap;
+}
 
-	for (GraphicComponent* graphicComponent : this->getGraphicComponents())
-	{
-		GraphicFsmTransition* t = dynamic_cast<GraphicFsmTransition*>(graphicComponent);
-		if (t != nullptr) transitionsList.append(t);
-	}
+const QMap<componentId_t, GraphicSimulatedFsmState*>& GraphicFsm::getSimulatedStates() const
+{
+	return this->simulatedStatesMap;
+}
 
-	return transitionsList;
+const QMap<componentId_t, GraphicSimulatedFsmTransition*>& GraphicFsm::getSimulatedTransitions() const
+{
+	return this->simulatedTransitionsMap;
 }
 
 GraphicFsmState* GraphicFsm::getState(componentId_t id) const
 {
-	auto state = this->getGraphicComponent(id);
-	return dynamic_cast<GraphicFsmState*>(state);
+	return this->statesMap.value(id, nullptr);
 }
 
 GraphicFsmTransition* GraphicFsm::getTransition(componentId_t id) const
 {
-	auto transition = this->getGraphicComponent(id);
-	return dynamic_cast<GraphicFsmTransition*>(transition);
+	return this->transitionsMap.value(id, nullptr);
 }
 
 GraphicSimulatedFsmState* GraphicFsm::getSimulatedState(componentId_t id) const
 {
-	auto state = this->getSimulatedGraphicComponent(id);
-	return dynamic_cast<GraphicSimulatedFsmState*>(state);
+	return this->simulatedStatesMap.value(id, nullptr);
 }
 
 GraphicSimulatedFsmTransition* GraphicFsm::getSimulatedTransition(componentId_t id) const
 {
-	auto transition = this->getSimulatedGraphicComponent(id);
-	return dynamic_cast<GraphicSimulatedFsmTransition*>(transition);
+	return this->simulatedTransitionsMap.value(id, nullptr);
 }
 
 int GraphicFsm::getTransitionRank(componentId_t transitionId) const
@@ -27,6 +27,7 @@
 
 // Qt classes
 #include "QHash"
+#include "QMap"
 
 // StateS classes
 #include "statestypes.h"
@@ -53,6 +54,7 @@ public:
 public:
 	virtual void build(shared_ptr<GraphicAttributes> graphicAttributes) override;
 	virtual void buildSimulation() override;
+	virtual void clearSimulation() override;
 
 	virtual shared_ptr<GraphicAttributes> getGraphicAttributes() const override;
 	virtual GenericScene* getGraphicScene() const override;
@@ -63,8 +65,11 @@ public:
 	GraphicFsmState*      addState     (componentId_t logicStateId,      QPointF position);
 	GraphicFsmTransition* addTransition(componentId_t logicTransitionId, qreal sliderPos);
 
-	const QList<GraphicFsmState*>      getStates()      const;
-	const QList<GraphicFsmTransition*> getTransitions() const;
+	const QMap<componentId_t, GraphicFsmState*>&      getStates()      const;
+	const QMap<componentId_t, GraphicFsmTransition*>& getTransitions() const;
+
+	const QMap<componentId_t, GraphicSimulatedFsmState*>&      getSimulatedStates()      const;
+	const QMap<componentId_t, GraphicSimulatedFsmTransition*>& getSimulatedTransitions() const;
 
 	GraphicFsmState*      getState(componentId_t id)      const;
 	GraphicFsmTransition* getTransition(componentId_t id) const;
@@ -86,6 +91,13 @@ private:
 	/////
 	// Object variables
 private:
+	// Typed views of the components maps held by
+	// the parent class, to avoid casts on lookup.
+	QMap<componentId_t, GraphicFsmState*>               statesMap;
+	QMap<componentId_t, GraphicFsmTransition*>          transitionsMap;
+	QMap<componentId_t, GraphicSimulatedFsmState*>      simulatedStatesMap;
+	QMap<componentId_t, GraphicSimulatedFsmTransition*> simulatedTransitionsMap;
+
 	// Neighborhoods are stored for each pair of FsmState
 	// First key is the lowest state ID, second key the other state ID.
 	QHash<componentId_t, QHash<componentId_t, shared_ptr<GraphicFsmTransitionNeighborhood>>> neighborhoods;
@@ -59,7 +59,7 @@ public:
 	// creation requires access to the graphic machine itself.
 	virtual void build(shared_ptr<GraphicAttributes> graphicAttributes) = 0;
 	virtual void buildSimulation() = 0;
-	void clearSimulation();
+	virtual void clearSimulation();
 
 	// To produce a graphic scene depending on the specialized type of machine.
 	virtual GenericScene* getGraphicScene() const = 0;
@@ -0,0 +1,263 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmminimizer.h"
+
+// Qt classes
+#include <QHash>
+#include <QSet>
+#include <QStringList>
+
+// StateS classes
+#include "fsm.h"
+#include "fsmstate.h"
+#include "fsmtransition.h"
+#include "equation.h"
+#include "operand.h"
+#include "actiononvariable.h"
+
+
+FsmMinimizer::FsmMinimizer(shared_ptr<Fsm> fsm)
+{
+	this->fsm = fsm;
+}
+
+void FsmMinimizer::computeEquivalentStates()
+{
+	this->equivalentStates.clear();
+
+	if (this->fsm == nullptr) return;
+
+
+	auto statesIds = this->fsm->getAllStatesIds();
+
+	// Initial partition on the behavior of each state alone
+	QMap<componentId_t, QString> signatures;
+	for (const auto& stateId : statesIds)
+	{
+		signatures[stateId] = this->getStateSignature(this->fsm->getState(stateId));
+	}
+
+	uint blocksCount;
+	auto blocks = this->buildBlocks(signatures, blocksCount);
+
+	// Refine partition until stable: states of a block must
+	// reach the same blocks through their outgoing transitions
+	while (true)
+	{
+		for (const auto& stateId : statesIds)
+		{
+			QStringList signature = {QString::number(blocks.value(stateId))};
+			for (const auto& transitionId : this->fsm->getState(stateId)->getOutgoingTransitionsIds())
+			{
+				auto transition = this->fsm->getTransition(transitionId);
+				signature.append(QString::number(blocks.value(transition->getTargetStateId())));
+			}
+
+			signatures[stateId] = signature.join(",");
+		}
+
+		uint refinedBlocksCount;
+		auto refinedBlocks = this->buildBlocks(signatures, refinedBlocksCount);
+
+		if (refinedBlocksCount == blocksCount) break;
+
+
+		blocks      = refinedBlocks;
+		blocksCount = refinedBlocksCount;
+	}
+
+	// Group states, keeping the states order of the machine
+	QList<QList<componentId_t>> groups(blocksCount);
+	for (const auto& stateId : statesIds)
+	{
+		groups[blocks.value(stateId)].append(stateId);
+	}
+
+	for (auto& group : groups)
+	{
+		if (group.count() < 2) continue;
+
+
+		// Keep initial state if it belongs to the group
+		if (group.contains(this->fsm->getInitialStateId()) == true)
+		{
+			group.move(group.indexOf(this->fsm->getInitialStateId()), 0);
+		}
+
+		this->equivalentStates.append(group);
+	}
+}
+
+const QList<QList<componentId_t>>& FsmMinimizer::getEquivalentStates() const
+{
+	return this->equivalentStates;
+}
+
+/**
+ * @brief FsmMinimizer::mergeEquivalentStates replaces each group
+ * of equivalent states by its first state: transitions coming from
+ * kept states are redirected to it, and other states are removed
+ * along with their transitions. Graphic machine is not updated.
+ */
+void FsmMinimizer::mergeEquivalentStates()
+{
+	if (this->fsm == nullptr) return;
+
+
+	QSet<componentId_t> removedStates;
+	for (const auto& group : this->equivalentStates)
+	{
+		for (int i = 1 ; i < group.count() ; i++)
+		{
+			removedStates.insert(group.at(i));
+		}
+	}
+
+	for (const auto& group : this->equivalentStates)
+	{
+		componentId_t keptStateId = group.first();
+
+		for (int i = 1 ; i < group.count() ; i++)
+		{
+			auto state = this->fsm->getState(group.at(i));
+			if (state == nullptr) continue;
+
+
+			for (const auto& transitionId : state->getIncomingTransitionsIds())
+			{
+				auto transition = this->fsm->getTransition(transitionId);
+				if (transition == nullptr) continue;
+
+				// Will be removed with its source state
+				if (removedStates.contains(transition->getSourceStateId()) == true) continue;
+
+
+				this->fsm->redirectTransition(transitionId, transition->getSourceStateId(), keptStateId);
+			}
+		}
+	}
+
+	for (const auto& stateId : removedStates)
+	{
+		this->fsm->removeState(stateId);
+	}
+
+	this->equivalentStates.clear();
+}
+
+QMap<componentId_t, uint> FsmMinimizer::buildBlocks(const QMap<componentId_t, QString>& signatures, uint& blocksCount) const
+{
+	QMap<componentId_t, uint> blocks;
+	QHash<QString, uint> blocksIndexes;
+
+	for (auto it = signatures.constBegin() ; it != signatures.constEnd() ; it++)
+	{
+		if (blocksIndexes.contains(it.value()) == false)
+		{
+			blocksIndexes[it.value()] = blocksIndexes.count();
+		}
+
+		blocks[it.key()] = blocksIndexes.value(it.value());
+	}
+
+	blocksCount = blocksIndexes.count();
+	return blocks;
+}
+
+/**
+ * @brief FsmMinimizer::getStateSignature describes the behavior
+ * of a state, regardless of the states reached by its transitions.
+ */
+QString FsmMinimizer::getStateSignature(shared_ptr<FsmState> state) const
+{
+	if (state == nullptr) return QString();
+
+
+	QString signature = this->getActionsSignature(state->getActions());
+
+	for (const auto& transitionId : state->getOutgoingTransitionsIds())
+	{
+		auto transition = this->fsm->getTransition(transitionId);
+		if (transition == nullptr) continue;
+
+
+		signature += "|" + this->getEquationSignature(transition->getCondition()) + ">" + this->getActionsSignature(transition->getActions());
+	}
+
+	return signature;
+}
+
+QString FsmMinimizer::getActionsSignature(const QList<shared_ptr<ActionOnVariable>>& actions) const
+{
+	QStringList signatures;
+
+	for (const auto& action : actions)
+	{
+		if (action == nullptr) continue;
+
+
+		signatures.append(QString::number(action->getVariableActedOnId()) + ":" +
+		                  QString::number((int)action->getActionType()) + ":" +
+		                  action->getActionValue().toString() + ":" +
+		                  QString::number(action->getActionRangeL()) + ":" +
+		                  QString::number(action->getActionRangeR()));
+	}
+
+	return "[" + signatures.join(";") + "]";
+}
+
+QString FsmMinimizer::getEquationSignature(shared_ptr<Equation> equation) const
+{
+	// Empty condition is always true
+	if (equation == nullptr) return "1";
+
+
+	QStringList operandsSignatures;
+	for (uint i = 0 ; i < equation->getOperandCount() ; i++)
+	{
+		operandsSignatures.append(this->getOperandSignature(equation->getOperand(i)));
+	}
+
+	return QString::number((int)equation->getOperatorType()) + "[" + QString::number(equation->getRangeL()) + ":" + QString::number(equation->getRangeR()) + "](" + operandsSignatures.join(",") + ")";
+}
+
+QString FsmMinimizer::getOperandSignature(shared_ptr<Operand> operand) const
+{
+	if (operand == nullptr) return "-";
+
+
+	switch (operand->getSource())
+	{
+	case OperandSource_t::variable:
+		return "v" + QString::number(operand->getVariableId());
+		break;
+	case OperandSource_t::equation:
+		return this->getEquationSignature(operand->getEquation());
+		break;
+	case OperandSource_t::constant:
+		return "c" + operand->getConstant().toString();
+		break;
+	}
+
+	return "-";
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMMINIMIZER_H
+#define FSMMINIMIZER_H
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QList>
+#include <QMap>
+class QString;
+
+// StateS classes
+#include "statestypes.h"
+class Fsm;
+class FsmState;
+class Equation;
+class Operand;
+class ActionOnVariable;
+
+
+/**
+ * @brief The FsmMinimizer class finds the states of a FSM
+ * that behave identically and can be merged.
+ *
+ * States are first partitioned by their actions and by the
+ * conditions and actions of their outgoing transitions, in
+ * priority order. The partition is then refined until the
+ * transitions of all states of a block lead to the same blocks.
+ *
+ * Conditions are compared on their structure, not on their
+ * truth table: this never merges states that behave differently,
+ * but states using differently written equivalent conditions
+ * are kept apart.
+ */
+class FsmMinimizer
+{
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmMinimizer(shared_ptr<Fsm> fsm);
+
+	/////
+	// Object functions
+public:
+	void computeEquivalentStates();
+	const QList<QList<componentId_t>>& getEquivalentStates() const;
+
+	void mergeEquivalentStates();
+
+private:
+	QMap<componentId_t, uint> buildBlocks(const QMap<componentId_t, QString>& signatures, uint& blocksCount) const;
+
+	QString getStateSignature   (shared_ptr<FsmState> state) const;
+	QString getActionsSignature (const QList<shared_ptr<ActionOnVariable>>& actions) const;
+	QString getEquationSignature(shared_ptr<Equation> equation) const;
+	QString getOperandSignature (shared_ptr<Operand> operand) const;
+
+	/////
+	// Object variables
+private:
+	shared_ptr<Fsm> fsm;
+
+	// Groups of equivalent states, the state kept when merging first
+	QList<QList<componentId_t>> equivalentStates;
+
+};
+
+#endif // FSMMINIMIZER_H
@@ -29,7 +29,6 @@
 #include "fsmtransition.h"
 #include "truthtable.h"
 #include "equation.h"
-#include "fsmvhdlexport.h"
 #include "variable.h"
 
 
@@ -38,7 +37,7 @@ FsmVerifier::~FsmVerifier()
 	this->clearProofs();
 }
 
-const QList<shared_ptr<FsmVerifier::Issue> >& FsmVerifier::verifyFsm(bool checkVhdl)
+const QList<shared_ptr<FsmVerifier::Issue> >& FsmVerifier::verifyFsm()
 {
 	this->clearProofs();
 
@@ -166,62 +165,6 @@ const QList<shared_ptr<FsmVerifier::Issue> >& FsmVerifier::verifyFsm(bool checkV
 				}
 			}
 		}
-
-		// Check VHDL export support
-		if (checkVhdl)
-		{
-			unique_ptr<FsmVhdlExport> vhdlExporter(new FsmVhdlExport());
-
-			shared_ptr<FsmVhdlExport::ExportCompatibility> compat = vhdlExporter->checkCompatibility();
-			vhdlExporter.reset();
-
-			if (!compat->isCompatible())
-			{
-				for (auto& variableId : compat->bothMooreAndMealy)
-				{
-					auto variable = fsm->getVariable(variableId);
-					if (variable == nullptr) continue;
-
-
-					shared_ptr<Issue> issue(new Issue());
-					issue->text = tr("Variable") + " " + variable->getName() + " "
-					        + tr("has both Moore and Mealy behaviors.") + " "
-					        + tr("StateS VHDL exporter is currently unable to handle these variables.") + " "
-					        + tr("This variable will be ignored on VHDL export.");
-					issue->type = VerifierSeverityLevel_t::tool;
-					this->issues.append(issue);
-				}
-				for (auto& variableId : compat->rangeAdressed)
-				{
-					auto variable = fsm->getVariable(variableId);
-					if (variable == nullptr) continue;
-
-
-					shared_ptr<Issue> issue(new Issue());
-					issue->text = tr("Variable") + " " + variable->getName() + " "
-					        + tr("has range-adressed output generation.") + " "
-					        + tr("StateS VHDL exporter is currently unable to handle these variables.") + " "
-					        + tr("This variable will be ignored on VHDL export.");
-					issue->type = VerifierSeverityLevel_t::tool;
-					this->issues.append(issue);
-				}
-				for (auto& variableId : compat->mealyWithKeep)
-				{
-					auto variable = fsm->getVariable(variableId);
-					if (variable == nullptr) continue;
-
-
-					shared_ptr<Issue> issue(new Issue());
-					issue->text = tr("Variable") + " " + variable->getName() + " "
-					        + tr("has Mealy outputs affectation (remembered value).") + " "
-					        + tr("StateS VHDL exporter is currently unable to handle these variables.") + " "
-					        + tr("This variable will be ignored on VHDL export.");
-					issue->type = VerifierSeverityLevel_t::tool;
-					this->issues.append(issue);
-				}
-			}
-		}
-
 	}
 
 	return this->issues;
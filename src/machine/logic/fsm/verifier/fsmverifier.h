@@ -67,7 +67,7 @@ public:
 	// Object functions
 public:
 	const QList<shared_ptr<Issue>>& getIssues();
-	const QList<shared_ptr<Issue>>& verifyFsm(bool checkVhdl);
+	const QList<shared_ptr<Issue>>& verifyFsm();
 
 private:
 	void clearProofs();
@@ -27,6 +27,7 @@
 #include "machinemanager.h"
 #include "machine.h"
 #include "variable.h"
+#include "simulatedmachine.h"
 
 
 SimulatedVariable::SimulatedVariable(componentId_t componentId) :
@@ -50,21 +51,39 @@ void SimulatedVariable::setCurrentValue(const LogicValue &value)
 	this->setCurrentValueSubRange(value, -1, -1);
 }
 
+/**
+ * @brief SimulatedVariable::setCurrentValueSubRange changes the
+ * variable value. Equations using this variable are not updated
+ * immediately: the change is propagated by the simulated machine,
+ * once the current simulation phase is done.
+ */
 void SimulatedVariable::setCurrentValueSubRange(const LogicValue& value, int rangeL, int rangeR)
 {
+	LogicValue previousValue = this->currentValue;
+
 	bool setOk = this->currentValue.setSubrange(value, rangeL, rangeR);
+	if (setOk == false) return;
+
+	if (this->currentValue == previousValue) return;
 
-	if (setOk == true)
+
+	this->valueChangePending = true;
+
+	auto simulatedMachine = machineManager->getSimulatedMachine();
+	if (simulatedMachine != nullptr)
 	{
-		emit this->variableCurrentValueChangedEvent();
+		simulatedMachine->requestValuesPropagation();
+	}
+	else
+	{
+		this->valueChangePending = false;
+		this->notifyValueChange();
 	}
 }
 
 void SimulatedVariable::reinitialize()
 {
-	this->currentValue = this->initialValue;
-
-	emit this->variableCurrentValueChangedEvent();
+	this->setCurrentValueSubRange(this->initialValue, -1, -1);
 }
 
 QString SimulatedVariable::getName() const
@@ -91,3 +110,23 @@ bool SimulatedVariable::getMemorized() const
 {
 	return this->memorized;
 }
+
+bool SimulatedVariable::hasPendingValueChange() const
+{
+	return this->valueChangePending;
+}
+
+void SimulatedVariable::clearPendingValueChange()
+{
+	this->valueChangePending = false;
+}
+
+/**
+ * @brief SimulatedVariable::notifyValueChange is called by
+ * the simulated machine once the value change has been
+ * propagated, to inform UI components.
+ */
+void SimulatedVariable::notifyValueChange()
+{
+	emit this->variableCurrentValueChangedEvent();
+}
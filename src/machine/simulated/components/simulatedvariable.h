@@ -58,6 +58,13 @@ public:
 	LogicValue getCurrentValue() const;
 	bool       getMemorized()    const;
 
+	///
+	// Values propagation
+
+	bool hasPendingValueChange() const;
+	void clearPendingValueChange();
+	void notifyValueChange();
+
 	/////
 	// Signals
 signals:
@@ -71,6 +78,9 @@ protected:
 	LogicValue currentValue;
 	bool       memorized;
 
+	// Value changed since last propagation
+	bool valueChangePending = false;
+
 };
 
 #endif // SIMULATEDVARIABLE_H
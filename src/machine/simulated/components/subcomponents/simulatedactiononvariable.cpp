@@ -36,30 +36,33 @@ SimulatedActionOnVariable::SimulatedActionOnVariable(shared_ptr<const ActionOnVa
 	this->actionValue = sourceAction->getActionValue();
 	this->rangeL      = sourceAction->getActionRangeL();
 	this->rangeR      = sourceAction->getActionRangeR();
-}
 
-void SimulatedActionOnVariable::doAction()
-{
+	// Actions are built with the simulated machine, after its variables
 	auto simulatedMachine = machineManager->getSimulatedMachine();
 	if (simulatedMachine == nullptr) return;
 
-	auto simulatedVariable = simulatedMachine->getSimulatedVariable(this->variableId);
-	if (simulatedVariable == nullptr) return;
 
+	this->variableIndex = simulatedMachine->getSimulatedVariableIndex(this->variableId);
+	if (this->variableIndex < 0) return;
 
-	simulatedVariable->setCurrentValueSubRange(this->getActionValue(), this->rangeL, this->rangeR);
+
+	this->variable = simulatedMachine->getSimulatedVariableByIndex(this->variableIndex);
 }
 
-bool SimulatedActionOnVariable::isActionMemorized() const
+void SimulatedActionOnVariable::doAction()
 {
-	auto simulatedMachine = machineManager->getSimulatedMachine();
-	if (simulatedMachine == nullptr) return false;
+	if (this->variable == nullptr) return;
 
-	auto simulatedVariable = simulatedMachine->getSimulatedVariable(this->variableId);
-	if (simulatedVariable == nullptr) return false;
 
+	this->variable->setCurrentValueSubRange(this->getActionValue(), this->rangeL, this->rangeR);
+}
 
-	return simulatedVariable->getMemorized();
+bool SimulatedActionOnVariable::isActionMemorized() const
+{
+	if (this->variable == nullptr) return false;
+
+
+	return this->variable->getMemorized();
 }
 
 componentId_t SimulatedActionOnVariable::getVariableId() const
@@ -67,6 +70,16 @@ componentId_t SimulatedActionOnVariable::getVariableId() const
 	return this->variableId;
 }
 
+/**
+ * @brief SimulatedActionOnVariable::getVariableIndex
+ * @return The dense index of the variable acted on in
+ * the simulated machine, or -1 if it does not exist.
+ */
+int SimulatedActionOnVariable::getVariableIndex() const
+{
+	return this->variableIndex;
+}
+
 LogicValue SimulatedActionOnVariable::getActionValue() const
 {
 	switch (this->actionType)
@@ -81,14 +94,10 @@ LogicValue SimulatedActionOnVariable::getActionValue() const
 	case ActionOnVariableType_t::increment:
 	case ActionOnVariableType_t::decrement:
 	{
-		auto simulatedMachine = machineManager->getSimulatedMachine();
-		if (simulatedMachine == nullptr) return LogicValue::getNullValue();
-
-		auto simulatedVariable = simulatedMachine->getSimulatedVariable(this->variableId);
-		if (simulatedVariable == nullptr) return LogicValue::getNullValue();
+		if (this->variable == nullptr) return LogicValue::getNullValue();
 
 
-		auto publicActionValue = simulatedVariable->getCurrentValue();
+		auto publicActionValue = this->variable->getCurrentValue();
 		if (this->actionType == ActionOnVariableType_t::increment)
 		{
 			publicActionValue.increment();
@@ -33,6 +33,7 @@ using namespace std;
 #include "statestypes.h"
 #include "logicvalue.h"
 class ActionOnVariable;
+class SimulatedVariable;
 
 
 class SimulatedActionOnVariable : public QObject
@@ -52,6 +53,7 @@ public:
 	bool isActionMemorized() const;
 
 	componentId_t getVariableId() const;
+	int getVariableIndex() const;
 
 private:
 	LogicValue getActionValue() const;
@@ -61,6 +63,10 @@ private:
 private:
 	componentId_t variableId = nullId;
 
+	// Variable acted on is resolved once at construction
+	shared_ptr<SimulatedVariable> variable;
+	int variableIndex = -1;
+
 	ActionOnVariableType_t actionType;
 	LogicValue actionValue;
 	int rangeL = -1;
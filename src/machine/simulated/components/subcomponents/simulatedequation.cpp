@@ -51,12 +51,6 @@ SimulatedEquation::SimulatedEquation(shared_ptr<const Equation> sourceEquation)
 
 
 		auto simulatedOperand = make_shared<SimulatedOperand>(sourceEquation->getOperand(i));
-
-		if (this->isValid == true)
-		{
-			connect(simulatedOperand.get(), &SimulatedOperand::operandCurrentValueChangedEvent, this, &SimulatedEquation::computeCurrentValue);
-		}
-
 		this->operands.append(simulatedOperand);
 	}
 
@@ -85,7 +79,44 @@ bool SimulatedEquation::isTrue() const
 	return false;
 }
 
-void SimulatedEquation::computeCurrentValue()
+/**
+ * @brief SimulatedEquation::updateCurrentValue recomputes
+ * the equation value if any of its operands changed since
+ * last propagation. Operands equations are updated first,
+ * thus each equation of the tree is computed at most once.
+ * @return True if value changed.
+ */
+bool SimulatedEquation::updateCurrentValue()
+{
+	if (this->isValid == false) return false;
+
+
+	bool operandsChanged = false;
+	for (auto& operand : this->operands)
+	{
+		// Update all operands, do not stop at first changed one
+		if (operand->updateCurrentValue() == true)
+		{
+			operandsChanged = true;
+		}
+	}
+
+	if (operandsChanged == false) return false;
+
+
+	return this->computeCurrentValue();
+}
+
+void SimulatedEquation::notifyValueChange()
+{
+	emit this->equationCurrentValueChangedEvent();
+}
+
+/**
+ * @brief SimulatedEquation::computeCurrentValue
+ * @return True if value changed.
+ */
+bool SimulatedEquation::computeCurrentValue()
 {
 	LogicValue previousValue = this->currentValue;
 
@@ -223,7 +254,11 @@ void SimulatedEquation::computeCurrentValue()
 
 	if (previousValue != this->currentValue)
 	{
-		emit this->equationCurrentValueChangedEvent();
+		return true;
+	}
+	else
+	{
+		return false;
 	}
 }
 
@@ -48,6 +48,10 @@ class SimulatedOperand;
  *
  * An equation with any of its operands undefined always returns
  * an undefined value.
+ *
+ * Equations are not updated each time a variable changes: the
+ * simulated machine calls updateCurrentValue() on root equations
+ * once per simulation phase, which updates operands first.
  */
 class SimulatedEquation : public QObject
 {
@@ -67,10 +71,11 @@ public:
 	// An equation whose result size is > 1 will never be true
 	bool isTrue() const;
 
-private slots:
-	void computeCurrentValue();
+	bool updateCurrentValue();
+	void notifyValueChange();
 
 private:
+	bool computeCurrentValue();
 	bool isInverted() const;
 
 	shared_ptr<SimulatedOperand> getOperand(uint i) const;
@@ -46,17 +46,13 @@ SimulatedOperand::SimulatedOperand(shared_ptr<const Operand> sourceOperand)
 		auto simulatedMachine = machineManager->getSimulatedMachine();
 		if (simulatedMachine == nullptr) return;
 
-		auto simulatedVariable = simulatedMachine->getSimulatedVariable(this->variableId);
-		if (simulatedVariable == nullptr) return;
 
-
-		connect(simulatedVariable.get(), &SimulatedVariable::variableCurrentValueChangedEvent, this, &SimulatedOperand::operandCurrentValueChangedEvent);
+		// Resolve variable once: simulated operands do not outlive the simulated machine
+		this->variable = simulatedMachine->getSimulatedVariable(this->variableId);
 		break;
 	}
 	case OperandSource_t::equation:
 		this->equation = make_shared<SimulatedEquation>(sourceOperand->getEquation());
-
-		connect(equation.get(), &SimulatedEquation::equationCurrentValueChangedEvent, this, &SimulatedOperand::operandCurrentValueChangedEvent);
 		break;
 	case OperandSource_t::constant:
 		this->constant = sourceOperand->getConstant();
@@ -69,17 +65,11 @@ LogicValue SimulatedOperand::getCurrentValue() const
 	switch (this->source)
 	{
 	case OperandSource_t::variable:
-	{
-		auto simulatedMachine = machineManager->getSimulatedMachine();
-		if (simulatedMachine == nullptr) return LogicValue::getNullValue();
-
-		auto simulatedVariable = simulatedMachine->getSimulatedVariable(this->variableId);
-		if (simulatedVariable == nullptr) return LogicValue::getNullValue();
+		if (this->variable == nullptr) return LogicValue::getNullValue();
 
 
-		return simulatedVariable->getCurrentValue();
+		return this->variable->getCurrentValue();
 		break;
-	}
 	case OperandSource_t::equation:
 		if (this->equation == nullptr) return LogicValue::getNullValue();
 
@@ -91,3 +81,31 @@ LogicValue SimulatedOperand::getCurrentValue() const
 		break;
 	}
 }
+
+/**
+ * @brief SimulatedOperand::updateCurrentValue updates the
+ * operand equation, if any, after variables changed.
+ * @return True if the operand value may have changed since
+ * last propagation.
+ */
+bool SimulatedOperand::updateCurrentValue()
+{
+	switch (this->source)
+	{
+	case OperandSource_t::variable:
+		if (this->variable == nullptr) return false;
+
+
+		return this->variable->hasPendingValueChange();
+		break;
+	case OperandSource_t::equation:
+		if (this->equation == nullptr) return false;
+
+
+		return this->equation->updateCurrentValue();
+		break;
+	case OperandSource_t::constant:
+		return false;
+		break;
+	}
+}
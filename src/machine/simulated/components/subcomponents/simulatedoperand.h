@@ -34,6 +34,7 @@ using namespace std;
 #include "logicvalue.h"
 class Operand;
 class SimulatedEquation;
+class SimulatedVariable;
 
 
 class SimulatedOperand : public QObject
@@ -49,11 +50,7 @@ public:
 	// Object functions
 public:
 	LogicValue getCurrentValue() const;
-
-	/////
-	// Signals
-signals:
-	void operandCurrentValueChangedEvent();
+	bool updateCurrentValue();
 
 	/////
 	// Object variables
@@ -61,6 +58,7 @@ private:
 	OperandSource_t source;
 
 	componentId_t                 variableId = nullId;
+	shared_ptr<SimulatedVariable> variable;
 	shared_ptr<SimulatedEquation> equation;
 	LogicValue                    constant   = LogicValue();
 
@@ -0,0 +1,357 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmcoverage.h"
+
+// Qt classes
+#include <QFile>
+#include <QTextStream>
+
+// StateS classes
+#include "fsmsimulationengine.h"
+#include "fsm.h"
+#include "fsmstate.h"
+#include "fsmtransition.h"
+#include "equation.h"
+#include "operand.h"
+
+
+FsmCoverage::FsmCoverage(const FsmSimulationEngine& engine)
+{
+	uint statesCount      = engine.getStatesCount();
+	uint transitionsCount = engine.getTransitionsCount();
+
+	for (uint i = 0 ; i < statesCount ; i++)
+	{
+		this->statesIds.append(engine.getStateId(i));
+		this->statesIndexes[engine.getStateId(i)] = i;
+		this->statesOutgoingTransitions.append(engine.getStateOutgoingTransitions(i));
+	}
+
+	uint termsCount = 0;
+	for (uint i = 0 ; i < transitionsCount ; i++)
+	{
+		this->transitionsIds.append(engine.getTransitionId(i));
+		this->transitionsIndexes[engine.getTransitionId(i)] = i;
+		this->termsOffsets.append(termsCount);
+
+		uint conditionTermsCount = engine.getConditionTermsCount(i);
+		if (conditionTermsCount > FsmCoverage::maxTermsPerCondition)
+		{
+			conditionTermsCount = FsmCoverage::maxTermsPerCondition;
+		}
+		termsCount += conditionTermsCount;
+	}
+	this->termsOffsets.append(termsCount);
+
+	this->statesVisits        .resize(statesCount, 0);
+	this->transitionsCrossings.resize(transitionsCount, 0);
+	this->termsTrue           .resize(termsCount, 0);
+	this->termsFalse          .resize(termsCount, 0);
+}
+
+void FsmCoverage::clear()
+{
+	this->statesVisits        .fill(0);
+	this->transitionsCrossings.fill(0);
+	this->termsTrue           .fill(0);
+	this->termsFalse          .fill(0);
+}
+
+/**
+ * @brief FsmCoverage::merge adds the counters of another
+ * coverage to this one. An empty coverage adopts the
+ * other one's layout.
+ * @return False if coverages were not built for the same machine.
+ */
+bool FsmCoverage::merge(const FsmCoverage& other)
+{
+	if (other.isEmpty() == true) return true;
+
+
+	if (this->isEmpty() == true)
+	{
+		*this = other;
+		return true;
+	}
+
+	if ( (this->statesIds != other.statesIds) || (this->transitionsIds != other.transitionsIds) || (this->termsOffsets != other.termsOffsets) ) return false;
+
+
+	for (int i = 0 ; i < this->statesVisits.count() ; i++)
+	{
+		this->statesVisits[i] += other.statesVisits.at(i);
+	}
+
+	for (int i = 0 ; i < this->transitionsCrossings.count() ; i++)
+	{
+		this->transitionsCrossings[i] += other.transitionsCrossings.at(i);
+	}
+
+	for (int i = 0 ; i < this->termsTrue.count() ; i++)
+	{
+		this->termsTrue[i]  += other.termsTrue.at(i);
+		this->termsFalse[i] += other.termsFalse.at(i);
+	}
+
+	return true;
+}
+
+bool FsmCoverage::isEmpty() const
+{
+	return this->termsOffsets.isEmpty();
+}
+
+/**
+ * @brief FsmCoverage::recordConditions records the values
+ * of the terms of the conditions leaving the active state.
+ * Must be called before doing a step, once the inputs have
+ * their value for this step.
+ */
+void FsmCoverage::recordConditions(const FsmSimulationEngine& engine)
+{
+	int activeState = engine.getActiveState();
+	if ( (activeState < 0) || (activeState >= this->statesOutgoingTransitions.count()) ) return;
+
+
+	for (auto transition : this->statesOutgoingTransitions.at(activeState))
+	{
+		uint firstTerm  = this->termsOffsets.at(transition);
+		uint termsCount = this->termsOffsets.at(transition + 1) - firstTerm;
+		if (termsCount == 0) continue;
+
+
+		quint64 termsValues = engine.evaluateConditionTerms(transition);
+		for (uint i = 0 ; i < termsCount ; i++)
+		{
+			if ( (termsValues & ((quint64)1 << i)) != 0 )
+			{
+				this->termsTrue[firstTerm + i]++;
+			}
+			else
+			{
+				this->termsFalse[firstTerm + i]++;
+			}
+		}
+	}
+}
+
+/**
+ * @brief FsmCoverage::recordStep records the transition
+ * crossed by the last step, if any, and the state active
+ * after it. Also call it after a reset to count the
+ * initial state.
+ */
+void FsmCoverage::recordStep(const FsmSimulationEngine& engine)
+{
+	this->recordTransitionCrossing(engine.getLastCrossedTransition());
+	this->recordStateVisit(engine.getActiveState());
+}
+
+void FsmCoverage::recordStateVisit(int state)
+{
+	if ( (state < 0) || (state >= this->statesVisits.count()) ) return;
+
+
+	this->statesVisits[state]++;
+}
+
+void FsmCoverage::recordTransitionCrossing(int transition)
+{
+	if ( (transition < 0) || (transition >= this->transitionsCrossings.count()) ) return;
+
+
+	this->transitionsCrossings[transition]++;
+}
+
+uint FsmCoverage::getStatesCount() const
+{
+	return this->statesVisits.count();
+}
+
+uint FsmCoverage::getTransitionsCount() const
+{
+	return this->transitionsCrossings.count();
+}
+
+uint FsmCoverage::getTermsCount() const
+{
+	return this->termsTrue.count();
+}
+
+uint FsmCoverage::getCoveredStatesCount() const
+{
+	uint covered = 0;
+	for (auto visits : this->statesVisits)
+	{
+		if (visits != 0)
+		{
+			covered++;
+		}
+	}
+
+	return covered;
+}
+
+uint FsmCoverage::getCoveredTransitionsCount() const
+{
+	uint covered = 0;
+	for (auto crossings : this->transitionsCrossings)
+	{
+		if (crossings != 0)
+		{
+			covered++;
+		}
+	}
+
+	return covered;
+}
+
+/**
+ * @brief FsmCoverage::getCoveredTermsCount counts the
+ * terms that have been evaluated both to true and false.
+ */
+uint FsmCoverage::getCoveredTermsCount() const
+{
+	uint covered = 0;
+	for (int i = 0 ; i < this->termsTrue.count() ; i++)
+	{
+		if ( (this->termsTrue.at(i) != 0) && (this->termsFalse.at(i) != 0) )
+		{
+			covered++;
+		}
+	}
+
+	return covered;
+}
+
+quint64 FsmCoverage::getStateVisits(componentId_t stateId) const
+{
+	auto it = this->statesIndexes.constFind(stateId);
+	if (it == this->statesIndexes.constEnd()) return 0;
+
+
+	return this->statesVisits.at(it.value());
+}
+
+quint64 FsmCoverage::getTransitionCrossings(componentId_t transitionId) const
+{
+	auto it = this->transitionsIndexes.constFind(transitionId);
+	if (it == this->transitionsIndexes.constEnd()) return 0;
+
+
+	return this->transitionsCrossings.at(it.value());
+}
+
+/**
+ * @brief FsmCoverage::isConditionCovered indicates if all
+ * the terms of a transition condition have been evaluated
+ * both to true and false. Conditions without terms are
+ * always covered.
+ */
+bool FsmCoverage::isConditionCovered(componentId_t transitionId) const
+{
+	auto it = this->transitionsIndexes.constFind(transitionId);
+	if (it == this->transitionsIndexes.constEnd()) return true;
+
+
+	uint transition = it.value();
+	for (uint i = this->termsOffsets.at(transition) ; i < this->termsOffsets.at(transition + 1) ; i++)
+	{
+		if ( (this->termsTrue.at(i) == 0) || (this->termsFalse.at(i) == 0) )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief FsmCoverage::exportToCsv writes all counters to a
+ * CSV file, one line per state, transition and condition term.
+ * The machine is used to obtain components names.
+ */
+bool FsmCoverage::exportToCsv(const QString& filePath, shared_ptr<const Fsm> fsm) const
+{
+	if (fsm == nullptr) return false;
+
+
+	QFile file(filePath);
+	if (file.open(QIODevice::WriteOnly | QIODevice::Text) == false) return false;
+
+
+	// Quotes a CSV field, doubling quotes it may contain
+	auto toCsvField = [](const QString& text)
+	{
+		QString field = text;
+		field.replace("\"", "\"\"");
+		return "\"" + field + "\"";
+	};
+
+	QTextStream stream(&file);
+	stream << "Type,Component,Term,Count,True count,False count" << Qt::endl;
+
+	for (int i = 0 ; i < this->statesIds.count() ; i++)
+	{
+		auto state = fsm->getState(this->statesIds.at(i));
+		if (state == nullptr) continue;
+
+
+		stream << "state," << toCsvField(state->getName()) << ",," << this->statesVisits.at(i) << ",," << Qt::endl;
+	}
+
+	for (int i = 0 ; i < this->transitionsIds.count() ; i++)
+	{
+		auto transition = fsm->getTransition(this->transitionsIds.at(i));
+		if (transition == nullptr) continue;
+
+		auto sourceState = fsm->getState(transition->getSourceStateId());
+		auto targetState = fsm->getState(transition->getTargetStateId());
+		if ( (sourceState == nullptr) || (targetState == nullptr) ) continue;
+
+
+		QString transitionName = sourceState->getName() + " -> " + targetState->getName();
+		stream << "transition," << toCsvField(transitionName) << ",," << this->transitionsCrossings.at(i) << ",," << Qt::endl;
+
+		auto condition = transition->getCondition();
+		if (condition == nullptr) continue;
+
+
+		// Terms are the non-null operands of the condition, in order
+		uint term = this->termsOffsets.at(i);
+		for (uint j = 0 ; (j < condition->getOperandCount()) && (term < this->termsOffsets.at(i + 1)) ; j++)
+		{
+			auto operand = condition->getOperand(j);
+			if (operand == nullptr) continue;
+
+
+			stream << "term," << toCsvField(transitionName) << "," << toCsvField(operand->getText()) << ",,"
+			       << this->termsTrue.at(term) << "," << this->termsFalse.at(term) << Qt::endl;
+			term++;
+		}
+	}
+
+	file.close();
+
+	return true;
+}
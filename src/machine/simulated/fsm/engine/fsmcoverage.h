@@ -0,0 +1,115 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMCOVERAGE_H
+#define FSMCOVERAGE_H
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QList>
+#include <QMap>
+
+// StateS classes
+#include "statestypes.h"
+class Fsm;
+class FsmSimulationEngine;
+
+
+/**
+ * @brief The FsmCoverage class counts states visits,
+ * transitions crossings and transitions conditions terms
+ * values during simulation.
+ *
+ * Counters are stored in flat arrays indexed by the engine
+ * dense indexes, so that recording a step does not allocate.
+ * Terms of all transitions are stored contiguously, termsOffsets
+ * giving the first term of each transition.
+ *
+ * Coverages built from engines of the same machine can be
+ * merged, e.g. to accumulate results from multiple runs.
+ */
+class FsmCoverage
+{
+
+	/////
+	// Static variables
+public:
+	// Only the first terms of each condition are tracked
+	static const uint maxTermsPerCondition = 64;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmCoverage() = default;
+	explicit FsmCoverage(const FsmSimulationEngine& engine);
+
+	/////
+	// Object functions
+public:
+	void clear();
+	bool merge(const FsmCoverage& other);
+	bool isEmpty() const;
+
+	// Recording
+	void recordConditions(const FsmSimulationEngine& engine);
+	void recordStep(const FsmSimulationEngine& engine);
+	void recordStateVisit(int state);
+	void recordTransitionCrossing(int transition);
+
+	// Results
+	uint getStatesCount()      const;
+	uint getTransitionsCount() const;
+	uint getTermsCount()       const;
+
+	uint getCoveredStatesCount()      const;
+	uint getCoveredTransitionsCount() const;
+	uint getCoveredTermsCount()       const;
+
+	quint64 getStateVisits       (componentId_t stateId)      const;
+	quint64 getTransitionCrossings(componentId_t transitionId) const;
+	bool    isConditionCovered   (componentId_t transitionId) const;
+
+	bool exportToCsv(const QString& filePath, shared_ptr<const Fsm> fsm) const;
+
+	/////
+	// Object variables
+private:
+	// Dense index to component ID
+	QList<componentId_t> statesIds;
+	QList<componentId_t> transitionsIds;
+	QMap<componentId_t, uint> statesIndexes;
+	QMap<componentId_t, uint> transitionsIndexes;
+	// Outgoing transitions of each state, used to record conditions
+	QList<QList<uint>> statesOutgoingTransitions;
+	// Terms of transition i are [termsOffsets[i]..termsOffsets[i+1][
+	QList<uint> termsOffsets;
+
+	QList<quint64> statesVisits;
+	QList<quint64> transitionsCrossings;
+	QList<quint64> termsTrue;
+	QList<quint64> termsFalse;
+
+};
+
+#endif // FSMCOVERAGE_H
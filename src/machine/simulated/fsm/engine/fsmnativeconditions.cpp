@@ -0,0 +1,156 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmnativeconditions.h"
+
+// Qt classes
+#include <QObject>
+#include <QFile>
+#include <QFileInfo>
+#include <QLibrary>
+#include <QProcess>
+#include <QProcessEnvironment>
+
+
+FsmNativeConditions::FsmNativeConditions(const QString& source)
+{
+	if (this->directory.isValid() == false)
+	{
+		this->errorText = QObject::tr("Unable to create a temporary directory.");
+		return;
+	}
+
+
+#if defined(Q_OS_WIN)
+	QString libraryPath = this->directory.filePath("conditions.dll");
+#elif defined(Q_OS_MACOS)
+	QString libraryPath = this->directory.filePath("conditions.dylib");
+#else
+	QString libraryPath = this->directory.filePath("conditions.so");
+#endif
+
+	if (this->compile(source, libraryPath) == false) return;
+
+
+	this->library = make_unique<QLibrary>(libraryPath);
+	if (this->library->load() == false)
+	{
+		this->errorText = this->library->errorString();
+		return;
+	}
+
+	this->function = (FindCandidates_t)this->library->resolve("states_find_candidates");
+	if (this->function == nullptr)
+	{
+		this->errorText = this->library->errorString();
+		this->library->unload();
+	}
+}
+
+FsmNativeConditions::~FsmNativeConditions()
+{
+	if (this->function != nullptr)
+	{
+		this->library->unload();
+	}
+}
+
+bool FsmNativeConditions::isLoaded() const
+{
+	return (this->function != nullptr);
+}
+
+QString FsmNativeConditions::getErrorText() const
+{
+	return this->errorText;
+}
+
+bool FsmNativeConditions::compile(const QString& source, const QString& libraryPath)
+{
+	QString sourcePath = this->directory.filePath("conditions.cpp");
+
+	QFile sourceFile(sourcePath);
+	if (sourceFile.open(QIODevice::WriteOnly) == false)
+	{
+		this->errorText = QObject::tr("Unable to write file") + " " + sourcePath;
+		return false;
+	}
+
+	sourceFile.write(source.toUtf8());
+	sourceFile.close();
+
+	QString compiler = QProcessEnvironment::systemEnvironment().value("CXX", "c++");
+
+	// CXX can hold a command line, e.g. "ccache g++" or "clang++ -stdlib=libc++"
+	QStringList arguments = QProcess::splitCommand(compiler);
+	if (arguments.isEmpty() == true)
+	{
+		this->errorText = QObject::tr("No compiler given by the CXX environment variable.");
+		return false;
+	}
+
+	QString program = arguments.takeFirst();
+
+	// MSVC and clang-cl use their own command line syntax, other compilers are expected to accept GCC options
+	QString compilerName = QFileInfo(program).completeBaseName().toLower();
+	bool msvcSyntax = ( (compilerName == "cl") || (compilerName == "clang-cl") );
+	if (msvcSyntax == true)
+	{
+		arguments.append({"/nologo", "/O2", "/LD", sourcePath, "/Fe" + libraryPath});
+	}
+	else
+	{
+		arguments.append({"-O2", "-shared", "-fPIC", "-o", libraryPath, sourcePath});
+	}
+
+	QProcess process;
+	process.setProcessChannelMode(QProcess::MergedChannels);
+	// Keep intermediate files (e.g. MSVC objects) in the temporary directory
+	process.setWorkingDirectory(this->directory.path());
+	process.start(program, arguments);
+
+	if (process.waitForStarted() == false)
+	{
+		this->errorText = QObject::tr("Unable to run compiler") + " " + compiler;
+		return false;
+	}
+
+	if (process.waitForFinished(FsmNativeConditions::compilationTimeout) == false)
+	{
+		process.kill();
+		this->errorText = QObject::tr("Compilation timed out.");
+		return false;
+	}
+
+	if ( (process.exitStatus() != QProcess::NormalExit) || (process.exitCode() != 0) )
+	{
+		this->errorText = QObject::tr("Compilation failed:") + " " + QString::fromLocal8Bit(process.readAll());
+		if (msvcSyntax == false)
+		{
+			this->errorText += "\n" + QObject::tr("Compiler") + " " + program + " " + QObject::tr("must either accept GCC-style options (-O2 -shared -fPIC) or be MSVC (cl).");
+		}
+		return false;
+	}
+
+
+	return true;
+}
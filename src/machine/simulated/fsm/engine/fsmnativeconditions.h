@@ -0,0 +1,96 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMNATIVECONDITIONS_H
+#define FSMNATIVECONDITIONS_H
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QString>
+#include <QTemporaryDir>
+class QLibrary;
+
+
+/**
+ * @brief The FsmNativeConditions class compiles C++ source
+ * generated by a simulation engine to a shared library using
+ * the system compiler, and loads it.
+ *
+ * The source must define an extern "C" function named
+ * states_find_candidates, following FindCandidates_t: given the
+ * active state index and the packed variables values, it writes
+ * the indexes of the transitions which condition is true in
+ * candidates and returns their count.
+ *
+ * The compiler is the one given by the CXX environment
+ * variable, or c++ by default. Loaded code has no state:
+ * a single instance can be used from any number of threads.
+ */
+class FsmNativeConditions
+{
+
+	/////
+	// Type declarations
+public:
+	typedef unsigned int (*FindCandidates_t)(unsigned int state, const unsigned long long* values, unsigned int* candidates);
+
+	/////
+	// Static variables
+private:
+	// Maximum compilation time (ms)
+	static const int compilationTimeout = 60000;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmNativeConditions(const QString& source);
+	~FsmNativeConditions();
+
+	/////
+	// Object functions
+public:
+	bool isLoaded() const;
+	QString getErrorText() const;
+
+	inline uint findCandidates(uint state, const quint64* values, uint* candidates) const
+	{
+		return this->function(state, values, candidates);
+	}
+
+private:
+	bool compile(const QString& source, const QString& libraryPath);
+
+	/////
+	// Object variables
+private:
+	// Library is unloaded before its directory is removed
+	QTemporaryDir directory;
+	unique_ptr<QLibrary> library;
+
+	FindCandidates_t function = nullptr;
+	QString errorText;
+
+};
+
+#endif // FSMNATIVECONDITIONS_H
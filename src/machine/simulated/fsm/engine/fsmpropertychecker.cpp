@@ -0,0 +1,311 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmpropertychecker.h"
+
+// Qt classes
+#include <QBitArray>
+
+// StateS classes
+#include "fsmstatespaceexplorer.h"
+#include "fsmsimulationengine.h"
+#include "equation.h"
+#include "operand.h"
+
+
+FsmPropertyChecker::FsmPropertyChecker(shared_ptr<const FsmStateSpaceExplorer> explorer)
+{
+	this->explorer = explorer;
+}
+
+/**
+ * @brief FsmPropertyChecker::checkInvariant checks that
+ * condition is true in all reachable configurations, for
+ * any value of the inputs.
+ */
+FsmPropertyChecker::Result_t FsmPropertyChecker::checkInvariant(shared_ptr<const Equation> condition) const
+{
+	Result_t result;
+
+	if (this->isExplorationUsable() == false) return result;
+
+	if (condition == nullptr)
+	{
+		result.status = PropertyCheckStatus_t::unsupportedProperty;
+		return result;
+	}
+
+
+	auto engine = this->explorer->getEngine();
+	engine.reset();
+
+	int program = engine.compileEquation(condition);
+	if (engine.isSupported() == false)
+	{
+		result.status = PropertyCheckStatus_t::unsupportedProperty;
+		return result;
+	}
+
+
+	// Configurations are ordered by distance from initial
+	// configuration: first violation found is the closest.
+	quint64 combinationsCount = this->explorer->getInputsCombinationsCount();
+	for (uint configuration = 0 ; configuration < this->explorer->getConfigurationsCount() ; configuration++)
+	{
+		this->explorer->loadConfiguration(configuration, engine);
+
+		for (quint64 inputsCombination = 0 ; inputsCombination < combinationsCount ; inputsCombination++)
+		{
+			this->explorer->applyInputsCombination(inputsCombination, engine);
+
+			if (engine.isTrue(program) == false)
+			{
+				result.status = PropertyCheckStatus_t::violated;
+				this->buildCounterexample(configuration, result);
+				result.finalInputsValues = this->explorer->getInputsValues(inputsCombination);
+				return result;
+			}
+		}
+	}
+
+	result.status = this->getHoldingStatus();
+	return result;
+}
+
+/**
+ * @brief FsmPropertyChecker::checkBoundedResponse checks that
+ * whenever premise is true, response is true in the same step
+ * or in one of the maxSteps following steps, whatever the inputs.
+ * Equations must not refer to inputs.
+ */
+FsmPropertyChecker::Result_t FsmPropertyChecker::checkBoundedResponse(shared_ptr<const Equation> premise, shared_ptr<const Equation> response, uint maxSteps) const
+{
+	Result_t result;
+
+	if (this->isExplorationUsable() == false) return result;
+
+	if ( (premise == nullptr) || (response == nullptr) || (maxSteps > FsmPropertyChecker::maxResponseSteps) )
+	{
+		result.status = PropertyCheckStatus_t::unsupportedProperty;
+		return result;
+	}
+
+	if ( (this->referencesInputs(premise) == true) || (this->referencesInputs(response) == true) )
+	{
+		result.status = PropertyCheckStatus_t::unsupportedProperty;
+		return result;
+	}
+
+
+	auto engine = this->explorer->getEngine();
+	engine.reset();
+
+	int premiseProgram  = engine.compileEquation(premise);
+	int responseProgram = engine.compileEquation(response);
+	if (engine.isSupported() == false)
+	{
+		result.status = PropertyCheckStatus_t::unsupportedProperty;
+		return result;
+	}
+
+
+	uint configurationsCount = this->explorer->getConfigurationsCount();
+
+	QBitArray premiseTrue(configurationsCount);
+	QBitArray responseTrue(configurationsCount);
+	for (uint configuration = 0 ; configuration < configurationsCount ; configuration++)
+	{
+		this->explorer->loadConfiguration(configuration, engine);
+
+		premiseTrue.setBit (configuration, engine.isTrue(premiseProgram));
+		responseTrue.setBit(configuration, engine.isTrue(responseProgram));
+	}
+
+	// avoidingLength[c] is the number of configurations, capped to maxSteps+1,
+	// of the longest path starting from c without response being true:
+	// a path of n steps avoiding response exists from c if it is greater than n.
+	// Configurations avoiding response for n steps are computed from the ones
+	// avoiding it for n-1 steps, so only the previous set is kept.
+	QList<uint> avoidingLength(configurationsCount, 0);
+	QBitArray previous = ~responseTrue;
+	for (uint configuration = 0 ; configuration < configurationsCount ; configuration++)
+	{
+		if (previous.testBit(configuration) == true)
+		{
+			avoidingLength[configuration] = 1;
+		}
+	}
+
+	for (uint n = 1 ; n <= maxSteps ; n++)
+	{
+		QBitArray current(configurationsCount);
+		for (uint configuration = 0 ; configuration < configurationsCount ; configuration++)
+		{
+			// Sets are nested: only configurations of the previous set can be in the current one
+			if (previous.testBit(configuration) == false) continue;
+
+
+			for (const auto& edge : this->explorer->getSuccessors(configuration))
+			{
+				if (previous.testBit(edge.target) == true)
+				{
+					current.setBit(configuration);
+					avoidingLength[configuration] = n + 1;
+					break;
+				}
+			}
+		}
+
+		// Fixed point reached: remaining configurations can avoid response forever
+		if (current == previous)
+		{
+			for (uint configuration = 0 ; configuration < configurationsCount ; configuration++)
+			{
+				if (current.testBit(configuration) == true)
+				{
+					avoidingLength[configuration] = maxSteps + 1;
+				}
+			}
+			break;
+		}
+
+		previous = current;
+	}
+
+	for (uint configuration = 0 ; configuration < configurationsCount ; configuration++)
+	{
+		if ( (premiseTrue.testBit(configuration) == false) || (avoidingLength.at(configuration) <= maxSteps) ) continue;
+
+
+		result.status = PropertyCheckStatus_t::violated;
+		this->buildCounterexample(configuration, result);
+
+		// Follow a path avoiding response
+		uint currentConfiguration = configuration;
+		for (int n = maxSteps - 1 ; n >= 0 ; n--)
+		{
+			for (const auto& edge : this->explorer->getSuccessors(currentConfiguration))
+			{
+				if (avoidingLength.at(edge.target) > (uint)n)
+				{
+					result.counterexample.append(this->buildTraceStep(edge.inputsCombination, edge.forcedTransition));
+					currentConfiguration = edge.target;
+					break;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	result.status = this->getHoldingStatus();
+	return result;
+}
+
+const QList<componentId_t>& FsmPropertyChecker::getInputsIds() const
+{
+	return this->explorer->getInputsIds();
+}
+
+bool FsmPropertyChecker::isExplorationUsable() const
+{
+	if (this->explorer == nullptr) return false;
+
+
+	auto status = this->explorer->getReport().status;
+	if ( (status == ExplorationStatus_t::complete) || (status == ExplorationStatus_t::configurationsLimitReached) )
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+PropertyCheckStatus_t FsmPropertyChecker::getHoldingStatus() const
+{
+	if (this->explorer->getReport().status == ExplorationStatus_t::complete)
+	{
+		return PropertyCheckStatus_t::holds;
+	}
+	else
+	{
+		return PropertyCheckStatus_t::holdsOnExploredPart;
+	}
+}
+
+bool FsmPropertyChecker::referencesInputs(shared_ptr<const Equation> equation) const
+{
+	for (uint i = 0 ; i < equation->getOperandCount() ; i++)
+	{
+		auto operand = equation->getOperand(i);
+		if (operand == nullptr) continue;
+
+
+		switch (operand->getSource())
+		{
+		case OperandSource_t::variable:
+			if (this->explorer->getInputsIds().contains(operand->getVariableId()) == true)
+			{
+				return true;
+			}
+			break;
+		case OperandSource_t::equation:
+			if ( (operand->getEquation() != nullptr) && (this->referencesInputs(operand->getEquation()) == true) )
+			{
+				return true;
+			}
+			break;
+		case OperandSource_t::constant:
+			break;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief FsmPropertyChecker::buildCounterexample sets the
+ * counterexample to the shortest path to a configuration.
+ */
+void FsmPropertyChecker::buildCounterexample(uint configuration, Result_t& result) const
+{
+	result.counterexample.clear();
+	for (const auto& edge : this->explorer->getPathTo(configuration))
+	{
+		result.counterexample.append(this->buildTraceStep(edge.inputsCombination, edge.forcedTransition));
+	}
+}
+
+FsmPropertyChecker::TraceStep_t FsmPropertyChecker::buildTraceStep(quint64 inputsCombination, int forcedTransition) const
+{
+	TraceStep_t step;
+	step.inputsValues = this->explorer->getInputsValues(inputsCombination);
+
+	if (forcedTransition >= 0)
+	{
+		step.forcedTransitionId = this->explorer->getEngine().getTransitionId(forcedTransition);
+	}
+
+	return step;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMPROPERTYCHECKER_H
+#define FSMPROPERTYCHECKER_H
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QList>
+
+// StateS classes
+#include "statestypes.h"
+#include "logicvalue.h"
+class Equation;
+class FsmStateSpaceExplorer;
+
+
+/**
+ * @brief The FsmPropertyChecker class checks properties
+ * on the reachable configurations graph computed by a
+ * FsmStateSpaceExplorer.
+ *
+ * Two kinds of properties are supported:
+ * - Invariants (always P), P being checked for any value
+ * of the inputs,
+ * - Bounded responses (P implies eventually Q within k steps),
+ * P and Q only referring to outputs and internal variables.
+ *
+ * When a property is violated, a counterexample is provided
+ * as a list of steps to replay from simulation reset. As the
+ * exploration is breadth-first, this is a shortest one.
+ */
+class FsmPropertyChecker
+{
+
+	/////
+	// Type declarations
+public:
+	struct TraceStep_t
+	{
+		QList<LogicValue> inputsValues;                // In the order of getInputsIds()
+		componentId_t     forcedTransitionId = nullId; // Transition to cross if multiple are crossable
+	};
+
+	struct Result_t
+	{
+		PropertyCheckStatus_t status = PropertyCheckStatus_t::explorationFailed;
+		QList<TraceStep_t> counterexample;
+		// Inputs values to set after last step to observe the violation, empty if not relevant
+		QList<LogicValue> finalInputsValues;
+	};
+
+	/////
+	// Static variables
+public:
+	static const uint maxResponseSteps = 1024;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmPropertyChecker(shared_ptr<const FsmStateSpaceExplorer> explorer);
+
+	/////
+	// Object functions
+public:
+	Result_t checkInvariant(shared_ptr<const Equation> condition) const;
+	Result_t checkBoundedResponse(shared_ptr<const Equation> premise, shared_ptr<const Equation> response, uint maxSteps) const;
+
+	const QList<componentId_t>& getInputsIds() const;
+
+private:
+	bool isExplorationUsable() const;
+	PropertyCheckStatus_t getHoldingStatus() const;
+	bool referencesInputs(shared_ptr<const Equation> equation) const;
+	void buildCounterexample(uint configuration, Result_t& result) const;
+	TraceStep_t buildTraceStep(quint64 inputsCombination, int forcedTransition) const;
+
+	/////
+	// Object variables
+private:
+	shared_ptr<const FsmStateSpaceExplorer> explorer;
+
+};
+
+#endif // FSMPROPERTYCHECKER_H
@@ -0,0 +1,1465 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmsimulationengine.h"
+
+// Qt classes
+#include <QStringList>
+
+// StateS classes
+#include "fsm.h"
+#include "fsmstate.h"
+#include "fsmtransition.h"
+#include "variable.h"
+#include "equation.h"
+#include "operand.h"
+#include "actiononvariable.h"
+#include "simulatedfsm.h"
+#include "simulatedvariable.h"
+#include "fsmnativeconditions.h"
+
+
+//
+// Static functions
+//
+
+quint64 FsmSimulationEngine::packValue(const LogicValue& value)
+{
+	quint64 bits = 0;
+
+	uint size = qMin(value.getSize(), (uint)64);
+	for (uint i = 0 ; i < size ; i++)
+	{
+		if (value[i] == true)
+		{
+			bits |= ((quint64)1 << i);
+		}
+	}
+
+	return bits;
+}
+
+LogicValue FsmSimulationEngine::unpackValue(quint64 bits, uint size)
+{
+	LogicValue value(size);
+
+	for (uint i = 0 ; (i < size) && (i < 64) ; i++)
+	{
+		value[i] = (((bits >> i) & 1) == 1);
+	}
+
+	return value;
+}
+
+quint64 FsmSimulationEngine::getMask(uint size)
+{
+	if (size >= 64)
+	{
+		return ~(quint64)0;
+	}
+	else
+	{
+		return ((quint64)1 << size) - 1;
+	}
+}
+
+//
+// Class object definition
+//
+
+/**
+ * @brief FsmSimulationEngine::FsmSimulationEngine builds
+ * the engine from the logic FSM. Actions behaviors are
+ * obtained from the simulated FSM if provided.
+ * The engine is not initialized after construction:
+ * either call reset() or loadFromSimulatedFsm().
+ */
+FsmSimulationEngine::FsmSimulationEngine(shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm)
+{
+	if (fsm == nullptr) return;
+
+
+	this->supported = true;
+
+	if (simulatedFsm != nullptr)
+	{
+		this->memorizedStateActionBehavior      = simulatedFsm->getMemorizedStateActionBehavior();
+		this->continuousStateActionBehavior     = simulatedFsm->getContinuousStateActionBehavior();
+		this->memorizedTransitionActionBehavior = simulatedFsm->getMemorizedTransitionActionBehavior();
+		this->pulseTransitionActionBehavior     = simulatedFsm->getPulseTransitionActionBehavior();
+	}
+
+	// Variables
+	for (const auto& variableId : fsm->getAllVariablesIds())
+	{
+		auto variable = fsm->getVariable(variableId);
+		if (variable == nullptr) continue;
+
+
+		if (variable->getSize() > 64)
+		{
+			this->supported = false;
+		}
+
+		Variable_t packedVariable;
+		packedVariable.id           = variableId;
+		packedVariable.size         = variable->getSize();
+		packedVariable.initialValue = FsmSimulationEngine::packValue(variable->getInitialValue());
+		packedVariable.memorized    = variable->getMemorized();
+
+		this->variablesIndexes[variableId] = this->variables.count();
+		this->variables.append(packedVariable);
+	}
+
+	// States (first pass to obtain indexes)
+	for (const auto& stateId : fsm->getAllStatesIds())
+	{
+		State_t packedState;
+		packedState.id = stateId;
+
+		this->statesIndexes[stateId] = this->states.count();
+		this->states.append(packedState);
+	}
+
+	// Transitions
+	for (const auto& transitionId : fsm->getAllTransitionsIds())
+	{
+		auto transition = fsm->getTransition(transitionId);
+		if (transition == nullptr) continue;
+
+		if (this->statesIndexes.contains(transition->getSourceStateId()) == false) continue;
+
+		if (this->statesIndexes.contains(transition->getTargetStateId()) == false) continue;
+
+
+		Transition_t packedTransition;
+		packedTransition.id        = transitionId;
+		packedTransition.source    = this->statesIndexes.value(transition->getSourceStateId());
+		packedTransition.target    = this->statesIndexes.value(transition->getTargetStateId());
+		packedTransition.condition = this->compileEquation(transition->getCondition());
+
+		for (const auto& action : transition->getActions())
+		{
+			if (action == nullptr) continue;
+
+			if (this->variablesIndexes.contains(action->getVariableActedOnId()) == false) continue;
+
+
+			packedTransition.actions.append(this->compileAction(action));
+		}
+
+		this->transitionsIndexes[transitionId] = this->transitions.count();
+		this->transitions.append(packedTransition);
+	}
+
+	// States (second pass to link actions and transitions)
+	for (auto& packedState : this->states)
+	{
+		auto state = fsm->getState(packedState.id);
+		if (state == nullptr) continue;
+
+
+		for (const auto& action : state->getActions())
+		{
+			if (action == nullptr) continue;
+
+			if (this->variablesIndexes.contains(action->getVariableActedOnId()) == false) continue;
+
+
+			packedState.actions.append(this->compileAction(action));
+		}
+
+		// Keep the order of the interactive simulator
+		for (const auto& transitionId : state->getOutgoingTransitionsIds())
+		{
+			if (this->transitionsIndexes.contains(transitionId) == false) continue;
+
+
+			packedState.outgoingTransitions.append(this->transitionsIndexes.value(transitionId));
+		}
+
+		for (auto transition : packedState.outgoingTransitions)
+		{
+			int condition = this->transitions.at(transition).condition;
+			if (condition < 0) continue;
+
+
+			const auto& program = this->programs.at(condition);
+			for (uint i = program.firstNode ; i <= program.lastNode ; i++)
+			{
+				const auto& node = this->nodes.at(i);
+				for (uint j = node.firstOperand ; j < node.firstOperand + node.operandCount ; j++)
+				{
+					const auto& operand = this->operands.at(j);
+					if (operand.source != OperandSource_t::variable) continue;
+
+					if (packedState.conditionsVariables.contains(operand.index) == true) continue;
+
+
+					packedState.conditionsVariables.append(operand.index);
+				}
+			}
+		}
+
+		this->candidatesBuffer.resize(qMax(this->candidatesBuffer.count(), packedState.outgoingTransitions.count()));
+	}
+
+	this->initialState = this->getStateIndex(fsm->getInitialStateId());
+
+	for (const auto& variable : this->variables)
+	{
+		this->snapshot.variablesValues.append(variable.initialValue);
+	}
+}
+
+/**
+ * @brief FsmSimulationEngine::isSupported indicates if the
+ * machine can be handled by the engine. The engine is limited
+ * to 64-bit values, including intermediate equations results.
+ */
+bool FsmSimulationEngine::isSupported() const
+{
+	return this->supported;
+}
+
+/**
+ * @brief FsmSimulationEngine::compileEquation compiles an
+ * equation to a program that can later be evaluated using
+ * evaluate() or isTrue(). Equations referring to variables
+ * of the machine can be compiled after construction, e.g. to
+ * evaluate user-defined conditions while simulating.
+ * Compilation must be done before copying the engine to
+ * worker threads.
+ * @return Program index, or -1 if equation is null.
+ */
+int FsmSimulationEngine::compileEquation(shared_ptr<const Equation> equation)
+{
+	if (equation == nullptr) return -1;
+
+
+	Program_t program;
+	program.firstNode = this->nodes.count();
+	program.lastNode  = this->compileNode(equation);
+
+	this->nodesValues.resize(this->nodes.count());
+
+	this->programs.append(program);
+	return this->programs.count() - 1;
+}
+
+FsmSimulationEngine::Value_t FsmSimulationEngine::evaluate(int program) const
+{
+	if ( (program < 0) || (program >= this->programs.count()) ) return Value_t();
+
+
+	const auto& compiledProgram = this->programs.at(program);
+	auto values = this->nodesValues.data();
+	auto nodesData = this->nodes.constData();
+
+	for (uint i = compiledProgram.firstNode ; i <= compiledProgram.lastNode ; i++)
+	{
+		values[i] = this->computeNode(nodesData[i], values);
+	}
+
+	return values[compiledProgram.lastNode];
+}
+
+// True concept here only apply to one bit results
+bool FsmSimulationEngine::isTrue(int program) const
+{
+	auto value = this->evaluate(program);
+
+	if ( (value.size == 1) && (value.bits == 1) )
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+/**
+ * @brief FsmSimulationEngine::compileNativeConditions compiles
+ * all transitions conditions to a shared library and uses it
+ * for subsequent steps of this engine and of its copies.
+ * Must be called before copying the engine to worker threads.
+ * @return False if the compilation failed or the engine is
+ * not supported, in which case conditions keep on being interpreted.
+ */
+bool FsmSimulationEngine::compileNativeConditions(QString& errorText)
+{
+	if (this->supported == false) return false;
+
+
+	auto nativeConditions = make_shared<FsmNativeConditions>(this->generateNativeConditionsSource());
+	if (nativeConditions->isLoaded() == false)
+	{
+		errorText = nativeConditions->getErrorText();
+		return false;
+	}
+
+
+	this->nativeConditions = nativeConditions;
+
+	return true;
+}
+
+bool FsmSimulationEngine::hasNativeConditions() const
+{
+	return (this->nativeConditions != nullptr);
+}
+
+/**
+ * @brief FsmSimulationEngine::reset restores variables
+ * initial values and activates the initial state.
+ */
+void FsmSimulationEngine::reset()
+{
+	for (uint i = 0 ; i < (uint)this->variables.count() ; i++)
+	{
+		this->reinitializeVariable(i);
+	}
+
+	this->snapshot.activeState           = -1;
+	this->snapshot.transitionToBeCrossed = -1;
+	this->lastCrossedTransition          = -1;
+	this->snapshot.variablesToResetBeforeNextStep.clear();
+	this->snapshot.variablesToResetAfterNextStep.clear();
+
+	this->forceStateActivation(this->initialState);
+}
+
+/**
+ * @brief FsmSimulationEngine::doStep does a full simulation step.
+ * When multiple transitions are crossable, the step is not done
+ * and the engine state is left unchanged: the caller can then use
+ * getCandidateTransitions() and doStepThroughTransition() to select
+ * which one to follow.
+ */
+FsmSimulationEngine::StepResult_t FsmSimulationEngine::doStep()
+{
+	if (this->snapshot.activeState < 0) return StepResult_t::noActiveState;
+
+
+	uint candidatesCount = this->findCandidateTransitions();
+	if (candidatesCount > 1) return StepResult_t::transitionConflict;
+
+
+	if (candidatesCount == 1)
+	{
+		this->snapshot.transitionToBeCrossed = this->candidatesBuffer.at(0);
+	}
+
+	this->finishStep();
+
+	return StepResult_t::stepped;
+}
+
+/**
+ * @brief FsmSimulationEngine::doStepThroughTransition does
+ * a simulation step crossing the given transition, whatever
+ * its condition. Use -1 to stay in current state.
+ */
+void FsmSimulationEngine::doStepThroughTransition(int transition)
+{
+	if (this->snapshot.activeState < 0) return;
+
+
+	if ( (transition >= 0) && (transition < this->transitions.count()) )
+	{
+		this->snapshot.transitionToBeCrossed = transition;
+	}
+
+	this->finishStep();
+}
+
+QList<uint> FsmSimulationEngine::getCandidateTransitions() const
+{
+	uint candidatesCount = this->findCandidateTransitions();
+
+	return this->candidatesBuffer.first(candidatesCount);
+}
+
+/**
+ * @brief FsmSimulationEngine::getConditionTermsCount returns
+ * the number of terms of a transition condition, terms being
+ * the operands of the condition top-level operator. Always
+ * true conditions and invalid conditions have no term.
+ */
+uint FsmSimulationEngine::getConditionTermsCount(uint transition) const
+{
+	if (transition >= (uint)this->transitions.count()) return 0;
+
+	int condition = this->transitions.at(transition).condition;
+	if (condition < 0) return 0;
+
+
+	return this->nodes.at(this->programs.at(condition).lastNode).operandCount;
+}
+
+/**
+ * @brief FsmSimulationEngine::evaluateConditionTerms evaluates
+ * a transition condition using current variables values.
+ * @return A mask with bit i set if term i is non-zero. Only the
+ * first 64 terms are evaluated.
+ */
+quint64 FsmSimulationEngine::evaluateConditionTerms(uint transition) const
+{
+	uint termsCount = this->getConditionTermsCount(transition);
+	if (termsCount == 0) return 0;
+
+
+	int condition = this->transitions.at(transition).condition;
+	this->evaluate(condition);
+
+	const auto& rootNode = this->nodes.at(this->programs.at(condition).lastNode);
+	auto operandsData = this->operands.constData();
+	auto values = this->nodesValues.constData();
+
+	quint64 termsValues = 0;
+	for (uint i = 0 ; (i < termsCount) && (i < 64) ; i++)
+	{
+		auto value = this->getOperandValue(operandsData[rootNode.firstOperand + i], values);
+		if (value.bits != 0)
+		{
+			termsValues |= ((quint64)1 << i);
+		}
+	}
+
+	return termsValues;
+}
+
+const FsmSimulationEngine::Snapshot_t& FsmSimulationEngine::getSnapshot() const
+{
+	return this->snapshot;
+}
+
+void FsmSimulationEngine::restoreSnapshot(const Snapshot_t& snapshot)
+{
+	this->snapshot = snapshot;
+	this->lastCrossedTransition = -1;
+}
+
+int FsmSimulationEngine::getActiveState() const
+{
+	return this->snapshot.activeState;
+}
+
+int FsmSimulationEngine::getLastCrossedTransition() const
+{
+	return this->lastCrossedTransition;
+}
+
+quint64 FsmSimulationEngine::getVariableValue(uint variable) const
+{
+	if (variable >= (uint)this->variables.count()) return 0;
+
+
+	return this->snapshot.variablesValues.at(variable);
+}
+
+void FsmSimulationEngine::setVariableValue(uint variable, quint64 value)
+{
+	if (variable >= (uint)this->variables.count()) return;
+
+
+	this->snapshot.variablesValues[variable] = value & FsmSimulationEngine::getMask(this->variables.at(variable).size);
+}
+
+/**
+ * @brief FsmSimulationEngine::loadConditionsFromSimulatedFsm only
+ * copies what is needed to evaluate the conditions leaving a state:
+ * the state is made active and the variables read by these conditions
+ * take their value in the interactive simulator. Other variables are
+ * left unchanged, so the engine must not be stepped afterwards.
+ * @param activeState Index of the simulator active state.
+ */
+void FsmSimulationEngine::loadConditionsFromSimulatedFsm(shared_ptr<const SimulatedFsm> simulatedFsm, int activeState)
+{
+	if (simulatedFsm == nullptr) return;
+
+	if ( (activeState < 0) || (activeState >= this->states.count()) ) return;
+
+
+	this->snapshot.activeState = activeState;
+
+	for (auto variable : this->states.at(activeState).conditionsVariables)
+	{
+		auto simulatedVariable = simulatedFsm->getSimulatedVariable(this->variables.at(variable).id);
+		if (simulatedVariable == nullptr) continue;
+
+
+		this->snapshot.variablesValues[variable] = FsmSimulationEngine::packValue(simulatedVariable->getCurrentValue());
+	}
+}
+
+/**
+ * @brief FsmSimulationEngine::loadFromSimulatedFsm copies the
+ * current dynamic state of the interactive simulator.
+ */
+void FsmSimulationEngine::loadFromSimulatedFsm(shared_ptr<const SimulatedFsm> simulatedFsm)
+{
+	if (simulatedFsm == nullptr) return;
+
+
+	for (uint i = 0 ; i < (uint)this->variables.count() ; i++)
+	{
+		auto simulatedVariable = simulatedFsm->getSimulatedVariable(this->variables.at(i).id);
+		if (simulatedVariable == nullptr) continue;
+
+
+		this->snapshot.variablesValues[i] = FsmSimulationEngine::packValue(simulatedVariable->getCurrentValue());
+	}
+
+	this->snapshot.activeState           = this->getStateIndex(simulatedFsm->getActiveStateId());
+	this->snapshot.transitionToBeCrossed = this->getTransitionIndex(simulatedFsm->getTransitionToBeCrossedId());
+
+	this->snapshot.variablesToResetBeforeNextStep.clear();
+	for (const auto& variableId : simulatedFsm->getVariablesToResetBeforeNextStep())
+	{
+		if (this->variablesIndexes.contains(variableId) == false) continue;
+
+
+		this->snapshot.variablesToResetBeforeNextStep.append(this->variablesIndexes.value(variableId));
+	}
+
+	this->snapshot.variablesToResetAfterNextStep.clear();
+	for (const auto& variableId : simulatedFsm->getVariablesToResetAfterNextStep())
+	{
+		if (this->variablesIndexes.contains(variableId) == false) continue;
+
+
+		this->snapshot.variablesToResetAfterNextStep.append(this->variablesIndexes.value(variableId));
+	}
+}
+
+/**
+ * @brief FsmSimulationEngine::applyToSimulatedFsm copies the
+ * engine dynamic state to the interactive simulator.
+ * Only changed variables are written to limit display updates.
+ */
+void FsmSimulationEngine::applyToSimulatedFsm(shared_ptr<SimulatedFsm> simulatedFsm) const
+{
+	if (simulatedFsm == nullptr) return;
+
+
+	// Propagate all variables changes at once
+	simulatedFsm->beginValuesUpdate();
+
+	for (uint i = 0 ; i < (uint)this->variables.count() ; i++)
+	{
+		auto simulatedVariable = simulatedFsm->getSimulatedVariable(this->variables.at(i).id);
+		if (simulatedVariable == nullptr) continue;
+
+
+		auto currentValue = FsmSimulationEngine::packValue(simulatedVariable->getCurrentValue());
+		if (currentValue != this->snapshot.variablesValues.at(i))
+		{
+			simulatedVariable->setCurrentValue(FsmSimulationEngine::unpackValue(this->snapshot.variablesValues.at(i), this->variables.at(i).size));
+		}
+	}
+
+	QList<componentId_t> variablesToResetBeforeNextStep;
+	for (auto variable : this->snapshot.variablesToResetBeforeNextStep)
+	{
+		variablesToResetBeforeNextStep.append(this->variables.at(variable).id);
+	}
+
+	QList<componentId_t> variablesToResetAfterNextStep;
+	for (auto variable : this->snapshot.variablesToResetAfterNextStep)
+	{
+		variablesToResetAfterNextStep.append(this->variables.at(variable).id);
+	}
+
+	componentId_t activeStateId = nullId;
+	if (this->snapshot.activeState >= 0)
+	{
+		activeStateId = this->getStateId(this->snapshot.activeState);
+	}
+
+	componentId_t transitionToBeCrossedId = nullId;
+	if (this->snapshot.transitionToBeCrossed >= 0)
+	{
+		transitionToBeCrossedId = this->getTransitionId(this->snapshot.transitionToBeCrossed);
+	}
+
+	simulatedFsm->restoreDynamicState(activeStateId, transitionToBeCrossedId, variablesToResetBeforeNextStep, variablesToResetAfterNextStep);
+
+	simulatedFsm->endValuesUpdate();
+}
+
+uint FsmSimulationEngine::getVariablesCount() const
+{
+	return this->variables.count();
+}
+
+uint FsmSimulationEngine::getStatesCount() const
+{
+	return this->states.count();
+}
+
+uint FsmSimulationEngine::getTransitionsCount() const
+{
+	return this->transitions.count();
+}
+
+int FsmSimulationEngine::getVariableIndex(componentId_t variableId) const
+{
+	if (this->variablesIndexes.contains(variableId) == false) return -1;
+
+
+	return this->variablesIndexes.value(variableId);
+}
+
+int FsmSimulationEngine::getStateIndex(componentId_t stateId) const
+{
+	if (this->statesIndexes.contains(stateId) == false) return -1;
+
+
+	return this->statesIndexes.value(stateId);
+}
+
+int FsmSimulationEngine::getTransitionIndex(componentId_t transitionId) const
+{
+	if (this->transitionsIndexes.contains(transitionId) == false) return -1;
+
+
+	return this->transitionsIndexes.value(transitionId);
+}
+
+componentId_t FsmSimulationEngine::getVariableId(uint variable) const
+{
+	if (variable >= (uint)this->variables.count()) return nullId;
+
+
+	return this->variables.at(variable).id;
+}
+
+componentId_t FsmSimulationEngine::getStateId(uint state) const
+{
+	if (state >= (uint)this->states.count()) return nullId;
+
+
+	return this->states.at(state).id;
+}
+
+componentId_t FsmSimulationEngine::getTransitionId(uint transition) const
+{
+	if (transition >= (uint)this->transitions.count()) return nullId;
+
+
+	return this->transitions.at(transition).id;
+}
+
+uint FsmSimulationEngine::getVariableSize(uint variable) const
+{
+	if (variable >= (uint)this->variables.count()) return 0;
+
+
+	return this->variables.at(variable).size;
+}
+
+int FsmSimulationEngine::getInitialState() const
+{
+	return this->initialState;
+}
+
+uint FsmSimulationEngine::getTransitionTarget(uint transition) const
+{
+	return this->transitions.at(transition).target;
+}
+
+const QList<uint>& FsmSimulationEngine::getStateOutgoingTransitions(uint state) const
+{
+	return this->states.at(state).outgoingTransitions;
+}
+
+uint FsmSimulationEngine::compileNode(shared_ptr<const Equation> equation)
+{
+	Node_t node;
+	node.operatorType = equation->getOperatorType();
+	node.isValid      = (equation->getComputationFailureCause() == EquationComputationFailureCause_t::nofail);
+	node.rangeL       = equation->getRangeL();
+	node.rangeR       = equation->getRangeR();
+	node.firstOperand = this->operands.count();
+	node.operandCount = 0;
+
+	if (node.isValid == true)
+	{
+		if (equation->getSize() > 64)
+		{
+			this->supported = false;
+		}
+
+		// Operands equations are compiled first, thus their nodes
+		// come before this one and are evaluated before it.
+		QList<Operand_t> nodeOperands;
+		for (uint i = 0 ; i < equation->getOperandCount() ; i++)
+		{
+			auto operand = equation->getOperand(i);
+			if (operand == nullptr) continue;
+
+
+			Operand_t packedOperand;
+			packedOperand.source       = operand->getSource();
+			packedOperand.index        = 0;
+			packedOperand.constantBits = 0;
+			packedOperand.constantSize = 0;
+
+			switch (packedOperand.source)
+			{
+			case OperandSource_t::variable:
+			{
+				int variable = this->getVariableIndex(operand->getVariableId());
+				if (variable >= 0)
+				{
+					packedOperand.index = variable;
+				}
+				else
+				{
+					// Unknown variable behaves as a null constant
+					packedOperand.source = OperandSource_t::constant;
+				}
+				break;
+			}
+			case OperandSource_t::equation:
+				if (operand->getEquation() != nullptr)
+				{
+					packedOperand.index = this->compileNode(operand->getEquation());
+				}
+				else
+				{
+					packedOperand.source = OperandSource_t::constant;
+				}
+				break;
+			case OperandSource_t::constant:
+			{
+				auto constant = operand->getConstant();
+				if (constant.getSize() > 64)
+				{
+					this->supported = false;
+				}
+				packedOperand.constantBits = FsmSimulationEngine::packValue(constant);
+				packedOperand.constantSize = constant.getSize();
+				break;
+			}
+			}
+
+			nodeOperands.append(packedOperand);
+		}
+
+		node.firstOperand = this->operands.count();
+		node.operandCount = nodeOperands.count();
+		this->operands.append(nodeOperands);
+	}
+
+	this->nodes.append(node);
+	return this->nodes.count() - 1;
+}
+
+uint FsmSimulationEngine::compileAction(shared_ptr<const ActionOnVariable> action)
+{
+	auto actionValue = action->getActionValue();
+
+	Action_t packedAction;
+	packedAction.variable  = this->variablesIndexes.value(action->getVariableActedOnId());
+	packedAction.type      = action->getActionType();
+	packedAction.value     = FsmSimulationEngine::packValue(actionValue);
+	packedAction.valueSize = actionValue.getSize();
+	packedAction.rangeL    = action->getActionRangeL();
+	packedAction.rangeR    = action->getActionRangeR();
+
+	this->actions.append(packedAction);
+	return this->actions.count() - 1;
+}
+
+FsmSimulationEngine::Value_t FsmSimulationEngine::getOperandValue(const Operand_t& operand, const Value_t* nodesValues) const
+{
+	Value_t value;
+
+	switch (operand.source)
+	{
+	case OperandSource_t::variable:
+		value.bits = this->snapshot.variablesValues.at(operand.index);
+		value.size = this->variables.at(operand.index).size;
+		break;
+	case OperandSource_t::equation:
+		value = nodesValues[operand.index];
+		break;
+	case OperandSource_t::constant:
+		value.bits = operand.constantBits;
+		value.size = operand.constantSize;
+		break;
+	}
+
+	return value;
+}
+
+/**
+ * @brief FsmSimulationEngine::computeNode mirrors
+ * SimulatedEquation::computeCurrentValue on packed values.
+ * Values bits above their size are always kept to 0.
+ */
+FsmSimulationEngine::Value_t FsmSimulationEngine::computeNode(const Node_t& node, const Value_t* nodesValues) const
+{
+	// Invalid equations are never computed
+	if (node.isValid == false) return Value_t();
+
+	if (node.operandCount == 0) return Value_t();
+
+
+	auto nodeOperands = this->operands.constData() + node.firstOperand;
+
+	Value_t result;
+	bool isInverted = false;
+	switch (node.operatorType)
+	{
+	case OperatorType_t::notOp:
+		isInverted = true;
+		result = this->getOperandValue(nodeOperands[0], nodesValues);
+		break;
+	case OperatorType_t::identity:
+		result = this->getOperandValue(nodeOperands[0], nodesValues);
+		break;
+	case OperatorType_t::equalOp:
+	case OperatorType_t::diffOp:
+	{
+		if (node.operandCount < 2) return Value_t();
+
+
+		auto operand0 = this->getOperandValue(nodeOperands[0], nodesValues);
+		auto operand1 = this->getOperandValue(nodeOperands[1], nodesValues);
+
+		bool equal = ( (operand0.size == operand1.size) && (operand0.bits == operand1.bits) );
+		if (node.operatorType == OperatorType_t::equalOp)
+		{
+			result.bits = (equal == true) ? 1 : 0;
+		}
+		else
+		{
+			result.bits = (equal == true) ? 0 : 1;
+		}
+		result.size = 1;
+		break;
+	}
+	case OperatorType_t::extractOp:
+	{
+		auto operand = this->getOperandValue(nodeOperands[0], nodesValues);
+		if (node.rangeR != -1)
+		{
+			result.size = node.rangeL - node.rangeR + 1;
+			if ( (node.rangeR >= 0) && (node.rangeR < 64) )
+			{
+				result.bits = (operand.bits >> node.rangeR) & FsmSimulationEngine::getMask(result.size);
+			}
+		}
+		else
+		{
+			result.size = 1;
+			if ( (node.rangeL >= 0) && (node.rangeL < 64) )
+			{
+				result.bits = (operand.bits >> node.rangeL) & 1;
+			}
+		}
+		break;
+	}
+	case OperatorType_t::concatOp:
+		for (uint i = 0 ; i < node.operandCount ; i++)
+		{
+			auto operand = this->getOperandValue(nodeOperands[i], nodesValues);
+
+			if (operand.size < 64)
+			{
+				result.bits <<= operand.size;
+			}
+			else
+			{
+				result.bits = 0;
+			}
+			result.bits |= operand.bits;
+			result.size += operand.size;
+		}
+		break;
+	case OperatorType_t::andOp:
+	case OperatorType_t::nandOp:
+	case OperatorType_t::orOp:
+	case OperatorType_t::norOp:
+	case OperatorType_t::xorOp:
+	case OperatorType_t::xnorOp:
+	{
+		result.size = this->getOperandValue(nodeOperands[0], nodesValues).size;
+		if ( (node.operatorType == OperatorType_t::andOp) || (node.operatorType == OperatorType_t::nandOp) )
+		{
+			result.bits = FsmSimulationEngine::getMask(result.size);
+		}
+
+		for (uint i = 0 ; i < node.operandCount ; i++)
+		{
+			auto operand = this->getOperandValue(nodeOperands[i], nodesValues);
+
+			// Operands with a different size leave value unchanged
+			if (operand.size != result.size) continue;
+
+
+			switch (node.operatorType)
+			{
+			case OperatorType_t::andOp:
+			case OperatorType_t::nandOp:
+				result.bits &= operand.bits;
+				break;
+			case OperatorType_t::orOp:
+			case OperatorType_t::norOp:
+				result.bits |= operand.bits;
+				break;
+			case OperatorType_t::xorOp:
+			case OperatorType_t::xnorOp:
+				result.bits ^= operand.bits;
+				break;
+			case OperatorType_t::notOp:
+			case OperatorType_t::identity:
+			case OperatorType_t::equalOp:
+			case OperatorType_t::diffOp:
+			case OperatorType_t::extractOp:
+			case OperatorType_t::concatOp:
+				break;
+			}
+		}
+
+		if ( (node.operatorType == OperatorType_t::nandOp) || (node.operatorType == OperatorType_t::norOp) || (node.operatorType == OperatorType_t::xnorOp) )
+		{
+			isInverted = true;
+		}
+		break;
+	}
+	}
+
+	if (isInverted == true)
+	{
+		result.bits = ~result.bits & FsmSimulationEngine::getMask(result.size);
+	}
+
+	return result;
+}
+
+/**
+ * @brief FsmSimulationEngine::findCandidateTransitions writes
+ * the transitions leaving the active state which condition is
+ * true to the candidates buffer, in priority order.
+ * @return Number of candidate transitions.
+ */
+uint FsmSimulationEngine::findCandidateTransitions() const
+{
+	if (this->snapshot.activeState < 0) return 0;
+
+
+	auto candidates = this->candidatesBuffer.data();
+
+	if (this->nativeConditions != nullptr)
+	{
+		return this->nativeConditions->findCandidates(this->snapshot.activeState, this->snapshot.variablesValues.constData(), candidates);
+	}
+
+
+	uint candidatesCount = 0;
+	for (auto transition : this->states.at(this->snapshot.activeState).outgoingTransitions)
+	{
+		int condition = this->transitions.at(transition).condition;
+
+		// Empty conditions are implicitly true
+		if ( (condition < 0) || (this->isTrue(condition) == true) )
+		{
+			candidates[candidatesCount] = transition;
+			candidatesCount++;
+		}
+	}
+
+	return candidatesCount;
+}
+
+/**
+ * @brief FsmSimulationEngine::generateNativeConditionsSource
+ * translates the transitions conditions programs to straight-line
+ * C++ code on packed values. As variables sizes are known when
+ * generating, sizes checks of computeNode() are resolved here, and
+ * only values are computed by the generated code.
+ */
+QString FsmSimulationEngine::generateNativeConditionsSource() const
+{
+	// Nodes sizes, operands nodes being before the nodes using them
+	QList<uint> nodesSizes;
+	QStringList nodesSources;
+	for (const auto& node : this->nodes)
+	{
+		uint size;
+		nodesSources.append(this->generateNativeNodeSource(node, nodesSizes, size));
+		nodesSizes.append(size);
+	}
+
+	QString source;
+	source += "// Transitions conditions generated by StateS\n\n";
+	source += "#ifdef _WIN32\n";
+	source += "#define STATES_EXPORT __declspec(dllexport)\n";
+	source += "#else\n";
+	source += "#define STATES_EXPORT\n";
+	source += "#endif\n\n";
+	source += "extern \"C\" STATES_EXPORT unsigned int states_find_candidates(unsigned int state, const unsigned long long* v, unsigned int* candidates)\n";
+	source += "{\n";
+	source += "\tunsigned int count = 0;\n\n";
+	source += "\tswitch (state)\n";
+	source += "\t{\n";
+
+	for (int state = 0 ; state < this->states.count() ; state++)
+	{
+		source += "\tcase " + QString::number(state) + ":\n";
+
+		for (auto transition : this->states.at(state).outgoingTransitions)
+		{
+			int condition = this->transitions.at(transition).condition;
+			QString candidateSource = "candidates[count++] = " + QString::number(transition) + ";";
+
+			if (condition < 0)
+			{
+				// Empty conditions are implicitly true
+				source += "\t\t" + candidateSource + "\n";
+				continue;
+			}
+
+
+			const auto& program = this->programs.at(condition);
+			if (nodesSizes.at(program.lastNode) != 1)
+			{
+				// True concept only apply to one bit results
+				continue;
+			}
+
+
+			source += "\t\t{\n";
+			for (uint i = program.firstNode ; i <= program.lastNode ; i++)
+			{
+				source += "\t\t\tconst unsigned long long n" + QString::number(i) + " = " + nodesSources.at(i) + ";\n";
+			}
+			source += "\t\t\tif (n" + QString::number(program.lastNode) + " == 1ull) " + candidateSource + "\n";
+			source += "\t\t}\n";
+		}
+
+		source += "\t\tbreak;\n";
+	}
+
+	source += "\t}\n\n";
+	source += "\treturn count;\n";
+	source += "}\n";
+
+	return source;
+}
+
+/**
+ * @brief FsmSimulationEngine::generateNativeNodeSource
+ * mirrors computeNode() on expressions.
+ * @param size Obtains the size of the node value.
+ */
+QString FsmSimulationEngine::generateNativeNodeSource(const Node_t& node, const QList<uint>& nodesSizes, uint& size) const
+{
+	size = 0;
+
+	// Invalid equations are never computed
+	if (node.isValid == false) return "0ull";
+
+	if (node.operandCount == 0) return "0ull";
+
+
+	auto nodeOperands = this->operands.constData() + node.firstOperand;
+
+	QString text;
+	bool isInverted = false;
+	switch (node.operatorType)
+	{
+	case OperatorType_t::notOp:
+		isInverted = true;
+		text = this->generateNativeOperandSource(nodeOperands[0], nodesSizes, size);
+		break;
+	case OperatorType_t::identity:
+		text = this->generateNativeOperandSource(nodeOperands[0], nodesSizes, size);
+		break;
+	case OperatorType_t::equalOp:
+	case OperatorType_t::diffOp:
+	{
+		if (node.operandCount < 2) return "0ull";
+
+
+		uint size0;
+		uint size1;
+		QString operand0 = this->generateNativeOperandSource(nodeOperands[0], nodesSizes, size0);
+		QString operand1 = this->generateNativeOperandSource(nodeOperands[1], nodesSizes, size1);
+
+		size = 1;
+		if (size0 != size1)
+		{
+			// Values of different sizes are never equal
+			text = (node.operatorType == OperatorType_t::equalOp) ? "0ull" : "1ull";
+		}
+		else if (node.operatorType == OperatorType_t::equalOp)
+		{
+			text = "(unsigned long long)(" + operand0 + " == " + operand1 + ")";
+		}
+		else
+		{
+			text = "(unsigned long long)(" + operand0 + " != " + operand1 + ")";
+		}
+		break;
+	}
+	case OperatorType_t::extractOp:
+	{
+		uint operandSize;
+		QString operand = this->generateNativeOperandSource(nodeOperands[0], nodesSizes, operandSize);
+		if (node.rangeR != -1)
+		{
+			size = node.rangeL - node.rangeR + 1;
+			if ( (node.rangeR >= 0) && (node.rangeR < 64) )
+			{
+				text = "((" + operand + " >> " + QString::number(node.rangeR) + ") & " + QString::number(FsmSimulationEngine::getMask(size)) + "ull)";
+			}
+			else
+			{
+				text = "0ull";
+			}
+		}
+		else
+		{
+			size = 1;
+			if ( (node.rangeL >= 0) && (node.rangeL < 64) )
+			{
+				text = "((" + operand + " >> " + QString::number(node.rangeL) + ") & 1ull)";
+			}
+			else
+			{
+				text = "0ull";
+			}
+		}
+		break;
+	}
+	case OperatorType_t::concatOp:
+		text = "0ull";
+		for (uint i = 0 ; i < node.operandCount ; i++)
+		{
+			uint operandSize;
+			QString operand = this->generateNativeOperandSource(nodeOperands[i], nodesSizes, operandSize);
+
+			if (operandSize < 64)
+			{
+				text = "((" + text + " << " + QString::number(operandSize) + ") | " + operand + ")";
+			}
+			else
+			{
+				text = operand;
+			}
+			size += operandSize;
+		}
+		break;
+	case OperatorType_t::andOp:
+	case OperatorType_t::nandOp:
+	case OperatorType_t::orOp:
+	case OperatorType_t::norOp:
+	case OperatorType_t::xorOp:
+	case OperatorType_t::xnorOp:
+	{
+		QString operatorText;
+		if ( (node.operatorType == OperatorType_t::andOp) || (node.operatorType == OperatorType_t::nandOp) )
+		{
+			operatorText = " & ";
+		}
+		else if ( (node.operatorType == OperatorType_t::orOp) || (node.operatorType == OperatorType_t::norOp) )
+		{
+			operatorText = " | ";
+		}
+		else
+		{
+			operatorText = " ^ ";
+		}
+
+		this->generateNativeOperandSource(nodeOperands[0], nodesSizes, size);
+
+		QStringList operandsTexts;
+		for (uint i = 0 ; i < node.operandCount ; i++)
+		{
+			uint operandSize;
+			QString operand = this->generateNativeOperandSource(nodeOperands[i], nodesSizes, operandSize);
+
+			// Operands with a different size leave value unchanged
+			if (operandSize != size) continue;
+
+
+			operandsTexts.append(operand);
+		}
+		text = "(" + operandsTexts.join(operatorText) + ")";
+
+		if ( (node.operatorType == OperatorType_t::nandOp) || (node.operatorType == OperatorType_t::norOp) || (node.operatorType == OperatorType_t::xnorOp) )
+		{
+			isInverted = true;
+		}
+		break;
+	}
+	}
+
+	if (isInverted == true)
+	{
+		text = "(~" + text + " & " + QString::number(FsmSimulationEngine::getMask(size)) + "ull)";
+	}
+
+	return text;
+}
+
+QString FsmSimulationEngine::generateNativeOperandSource(const Operand_t& operand, const QList<uint>& nodesSizes, uint& size) const
+{
+	switch (operand.source)
+	{
+	case OperandSource_t::variable:
+		size = this->variables.at(operand.index).size;
+		return "v[" + QString::number(operand.index) + "]";
+		break;
+	case OperandSource_t::equation:
+		size = nodesSizes.at(operand.index);
+		return "n" + QString::number(operand.index);
+		break;
+	case OperandSource_t::constant:
+		size = operand.constantSize;
+		return QString::number(operand.constantBits) + "ull";
+		break;
+	}
+
+	size = 0;
+	return "0ull";
+}
+
+void FsmSimulationEngine::prepareActions()
+{
+	// Reset unmemorized actions
+	for (auto variable : this->snapshot.variablesToResetBeforeNextStep)
+	{
+		this->reinitializeVariable(variable);
+	}
+	this->snapshot.variablesToResetBeforeNextStep.clear();
+
+	// Prepare for next actions
+	if (this->snapshot.transitionToBeCrossed >= 0)
+	{
+		for (auto action : this->transitions.at(this->snapshot.transitionToBeCrossed).actions)
+		{
+			uint variable = this->actions.at(action).variable;
+			if ( (this->variables.at(variable).memorized == true) && (this->memorizedTransitionActionBehavior == SimulationBehavior_t::prepare) )
+			{
+				this->doAction(action);
+			}
+			else if ( (this->variables.at(variable).memorized == false) && (this->pulseTransitionActionBehavior == SimulationBehavior_t::prepare) )
+			{
+				this->doAction(action);
+				this->snapshot.variablesToResetBeforeNextStep.append(variable);
+			}
+		}
+	}
+}
+
+/**
+ * @brief FsmSimulationEngine::finishStep mirrors
+ * SimulatedFsm::subMachinePrepareActions() and
+ * SimulatedFsm::subMachineDoStep().
+ */
+void FsmSimulationEngine::finishStep()
+{
+	this->lastCrossedTransition = -1;
+
+	this->prepareActions();
+
+	// Reset unmemorized actions
+	for (auto variable : this->snapshot.variablesToResetAfterNextStep)
+	{
+		this->reinitializeVariable(variable);
+	}
+	this->snapshot.variablesToResetAfterNextStep.clear();
+
+	// Look for postponed actions in current state
+	for (auto action : this->states.at(this->snapshot.activeState).actions)
+	{
+		uint variable = this->actions.at(action).variable;
+		if ( (this->variables.at(variable).memorized == true) && (this->memorizedStateActionBehavior == SimulationBehavior_t::after) )
+		{
+			this->doAction(action);
+		}
+		else if ( (this->variables.at(variable).memorized == false) && (this->continuousStateActionBehavior == SimulationBehavior_t::after) )
+		{
+			this->doAction(action);
+			this->snapshot.variablesToResetAfterNextStep.append(variable);
+		}
+	}
+
+	// Cross transition
+	if (this->snapshot.transitionToBeCrossed >= 0)
+	{
+		const auto& transition = this->transitions.at(this->snapshot.transitionToBeCrossed);
+
+		// Activate transition actions
+		for (auto action : transition.actions)
+		{
+			uint variable = this->actions.at(action).variable;
+			if ( (this->variables.at(variable).memorized == true) && (this->memorizedTransitionActionBehavior == SimulationBehavior_t::immediately) )
+			{
+				this->doAction(action);
+			}
+			else if ( (this->variables.at(variable).memorized == false) && (this->pulseTransitionActionBehavior == SimulationBehavior_t::immediately) )
+			{
+				this->doAction(action);
+				this->snapshot.variablesToResetAfterNextStep.append(variable);
+			}
+		}
+
+		// Update current state
+		this->snapshot.activeState = transition.target;
+		this->lastCrossedTransition = this->snapshot.transitionToBeCrossed;
+		this->snapshot.transitionToBeCrossed = -1;
+	}
+
+	// Activate state actions
+	for (auto action : this->states.at(this->snapshot.activeState).actions)
+	{
+		uint variable = this->actions.at(action).variable;
+		if ( (this->variables.at(variable).memorized == true) && (this->memorizedStateActionBehavior == SimulationBehavior_t::immediately) )
+		{
+			this->doAction(action);
+		}
+		else if ( (this->variables.at(variable).memorized == false) && (this->continuousStateActionBehavior == SimulationBehavior_t::immediately) )
+		{
+			this->doAction(action);
+			this->snapshot.variablesToResetAfterNextStep.append(variable);
+
+			// If action is handled in current state, remove it from the reset list of transitions
+			this->snapshot.variablesToResetBeforeNextStep.removeOne(variable);
+		}
+	}
+}
+
+void FsmSimulationEngine::forceStateActivation(int state)
+{
+	this->snapshot.activeState = state;
+
+	if (state < 0) return;
+
+
+	// Enable state actions
+	for (auto action : this->states.at(state).actions)
+	{
+		uint variable = this->actions.at(action).variable;
+		if ( (this->variables.at(variable).memorized == true) && (this->memorizedStateActionBehavior == SimulationBehavior_t::immediately) )
+		{
+			this->doAction(action);
+		}
+		else if ( (this->variables.at(variable).memorized == false) && (this->continuousStateActionBehavior == SimulationBehavior_t::immediately) )
+		{
+			this->doAction(action);
+			this->snapshot.variablesToResetAfterNextStep.append(variable);
+		}
+	}
+}
+
+/**
+ * @brief FsmSimulationEngine::doAction mirrors
+ * SimulatedActionOnVariable::doAction() and
+ * LogicValue::setSubrange() on packed values.
+ */
+void FsmSimulationEngine::doAction(uint action)
+{
+	const auto& packedAction = this->actions.at(action);
+	const auto& variable = this->variables.at(packedAction.variable);
+	quint64 currentValue = this->snapshot.variablesValues.at(packedAction.variable);
+
+	quint64 value  = 0;
+	uint valueSize = 0;
+	switch (packedAction.type)
+	{
+	case ActionOnVariableType_t::reset:
+	case ActionOnVariableType_t::set:
+	case ActionOnVariableType_t::continuous:
+	case ActionOnVariableType_t::pulse:
+	case ActionOnVariableType_t::assign:
+		value     = packedAction.value;
+		valueSize = packedAction.valueSize;
+		break;
+	case ActionOnVariableType_t::increment:
+		value     = (currentValue + 1) & FsmSimulationEngine::getMask(variable.size);
+		valueSize = variable.size;
+		break;
+	case ActionOnVariableType_t::decrement:
+		value     = (currentValue - 1) & FsmSimulationEngine::getMask(variable.size);
+		valueSize = variable.size;
+		break;
+	case ActionOnVariableType_t::none:
+		return;
+		break;
+	}
+
+	int rangeL = packedAction.rangeL;
+	int rangeR = packedAction.rangeR;
+
+	if ( (rangeL < 0) && (rangeR >= 0) ) return;
+
+	if ( (rangeL >= 0) && ((uint)rangeL >= variable.size) ) return;
+
+	if ( (rangeR >= 0) && ((uint)rangeR >= variable.size) ) return;
+
+	if ( (rangeR >= 0) && (rangeR > rangeL) ) return;
+
+
+	if (rangeL < 0)
+	{
+		// Full range affectation
+		if (valueSize == variable.size)
+		{
+			currentValue = value;
+		}
+	}
+	else if (rangeR < 0)
+	{
+		// Single bit affectation
+		if (valueSize == 1)
+		{
+			currentValue &= ~((quint64)1 << rangeL);
+			currentValue |= (value & 1) << rangeL;
+		}
+	}
+	else
+	{
+		// Sub-range affectation
+		uint width = rangeL - rangeR + 1;
+		if (valueSize == width)
+		{
+			quint64 mask = FsmSimulationEngine::getMask(width) << rangeR;
+			currentValue &= ~mask;
+			currentValue |= (value << rangeR) & mask;
+		}
+	}
+
+	this->snapshot.variablesValues[packedAction.variable] = currentValue;
+}
+
+void FsmSimulationEngine::reinitializeVariable(uint variable)
+{
+	this->snapshot.variablesValues[variable] = this->variables.at(variable).initialValue;
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMSIMULATIONENGINE_H
+#define FSMSIMULATIONENGINE_H
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QList>
+#include <QMap>
+class QString;
+
+// StateS classes
+#include "statestypes.h"
+#include "logicvalue.h"
+class Fsm;
+class Equation;
+class ActionOnVariable;
+class SimulatedFsm;
+class FsmNativeConditions;
+
+
+/**
+ * @brief The FsmSimulationEngine class is a compact copy of
+ * a simulated FSM, with no dependency to the Qt object model
+ * or to the machine manager.
+ *
+ * Components are referred to using dense indexes, variables
+ * values are packed in 64-bit words and equations are compiled
+ * to flat programs. Stepping follows the exact same semantics
+ * as SimulatedFsm, but without emitting any signal.
+ *
+ * The engine is built on the GUI thread, then copies of it can
+ * be stepped from other threads, one copy per thread. A single
+ * copy must not be used from multiple threads, even through const
+ * functions: evaluation writes to working buffers held by the copy.
+ * Copies are cheap as static data is implicitly shared: only the
+ * snapshot and working buffers are detached when used.
+ *
+ * Transitions conditions can optionally be compiled to native
+ * code, in which case interpreted programs are only used for
+ * equations compiled afterwards and for coverage.
+ */
+class FsmSimulationEngine
+{
+
+	/////
+	// Type declarations
+public:
+	enum class StepResult_t { stepped, transitionConflict, noActiveState };
+
+	// Dynamic part of the simulation: this is all that changes when stepping.
+	struct Snapshot_t
+	{
+		int activeState           = -1;
+		int transitionToBeCrossed = -1;
+		QList<quint64> variablesValues;
+		QList<uint> variablesToResetBeforeNextStep;
+		QList<uint> variablesToResetAfterNextStep;
+	};
+
+	// Packed value: a null value has size 0
+	struct Value_t
+	{
+		quint64 bits = 0;
+		uint    size = 0;
+	};
+
+private:
+	struct Variable_t
+	{
+		componentId_t id;
+		uint    size;
+		quint64 initialValue;
+		bool    memorized;
+	};
+
+	struct Action_t
+	{
+		uint variable;
+		ActionOnVariableType_t type;
+		quint64 value;
+		uint    valueSize;
+		int     rangeL;
+		int     rangeR;
+	};
+
+	struct State_t
+	{
+		componentId_t id;
+		QList<uint> actions;
+		QList<uint> outgoingTransitions;
+		QList<uint> conditionsVariables; // Variables read by outgoing transitions conditions
+	};
+
+	struct Transition_t
+	{
+		componentId_t id;
+		uint source;
+		uint target;
+		int  condition; // Equation program, -1 if always true
+		QList<uint> actions;
+	};
+
+	struct Operand_t
+	{
+		OperandSource_t source;
+		uint    index;        // Variable index, or node index for equations
+		quint64 constantBits;
+		uint    constantSize;
+	};
+
+	struct Node_t
+	{
+		OperatorType_t operatorType;
+		bool isValid;
+		int  rangeL;
+		int  rangeR;
+		uint firstOperand;
+		uint operandCount;
+	};
+
+	// An equation program is the range of nodes [firstNode..lastNode],
+	// operands being compiled before the nodes using them.
+	struct Program_t
+	{
+		uint firstNode;
+		uint lastNode;
+	};
+
+	/////
+	// Static functions
+public:
+	static quint64    packValue  (const LogicValue& value);
+	static LogicValue unpackValue(quint64 bits, uint size);
+	static quint64    getMask    (uint size);
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmSimulationEngine() = default;
+	explicit FsmSimulationEngine(shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm);
+
+	/////
+	// Object functions
+public:
+	bool isSupported() const;
+
+	// Equations compilation and evaluation
+	int compileEquation(shared_ptr<const Equation> equation);
+	Value_t evaluate(int program) const;
+	bool isTrue(int program) const;
+
+	// Native transitions conditions
+	bool compileNativeConditions(QString& errorText);
+	bool hasNativeConditions() const;
+
+	// Simulation
+	void reset();
+	StepResult_t doStep();
+	void doStepThroughTransition(int transition);
+	QList<uint> getCandidateTransitions() const;
+
+	// Transitions conditions terms, used for coverage
+	uint    getConditionTermsCount(uint transition) const;
+	quint64 evaluateConditionTerms(uint transition) const;
+
+	const Snapshot_t& getSnapshot() const;
+	void restoreSnapshot(const Snapshot_t& snapshot);
+
+	int     getActiveState() const;
+	int     getLastCrossedTransition() const;
+	quint64 getVariableValue(uint variable) const;
+	void    setVariableValue(uint variable, quint64 value);
+
+	// Link with the interactive simulator
+	void loadFromSimulatedFsm(shared_ptr<const SimulatedFsm> simulatedFsm);
+	void loadConditionsFromSimulatedFsm(shared_ptr<const SimulatedFsm> simulatedFsm, int activeState);
+	void applyToSimulatedFsm(shared_ptr<SimulatedFsm> simulatedFsm) const;
+
+	// Indexes mapping
+	uint getVariablesCount()   const;
+	uint getStatesCount()      const;
+	uint getTransitionsCount() const;
+
+	int getVariableIndex  (componentId_t variableId)   const;
+	int getStateIndex     (componentId_t stateId)      const;
+	int getTransitionIndex(componentId_t transitionId) const;
+
+	componentId_t getVariableId  (uint variable)   const;
+	componentId_t getStateId     (uint state)      const;
+	componentId_t getTransitionId(uint transition) const;
+
+	uint getVariableSize(uint variable) const;
+	int  getInitialState() const;
+	uint getTransitionTarget(uint transition) const;
+	const QList<uint>& getStateOutgoingTransitions(uint state) const;
+
+private:
+	uint compileNode(shared_ptr<const Equation> equation);
+	uint compileAction(shared_ptr<const ActionOnVariable> action);
+
+	Value_t getOperandValue(const Operand_t& operand, const Value_t* nodesValues) const;
+	Value_t computeNode(const Node_t& node, const Value_t* nodesValues) const;
+
+	uint findCandidateTransitions() const;
+
+	QString generateNativeConditionsSource() const;
+	QString generateNativeNodeSource   (const Node_t& node,       const QList<uint>& nodesSizes, uint& size) const;
+	QString generateNativeOperandSource(const Operand_t& operand, const QList<uint>& nodesSizes, uint& size) const;
+
+	void prepareActions();
+	void finishStep();
+	void forceStateActivation(int state);
+	void doAction(uint action);
+	void reinitializeVariable(uint variable);
+
+	/////
+	// Object variables
+private:
+	bool supported = false;
+
+	// Static data
+	SimulationBehavior_t memorizedStateActionBehavior      = SimulationBehavior_t::immediately;
+	SimulationBehavior_t continuousStateActionBehavior     = SimulationBehavior_t::immediately;
+	SimulationBehavior_t memorizedTransitionActionBehavior = SimulationBehavior_t::immediately;
+	SimulationBehavior_t pulseTransitionActionBehavior     = SimulationBehavior_t::immediately;
+
+	int initialState = -1;
+
+	QList<Variable_t>   variables;
+	QList<Action_t>     actions;
+	QList<State_t>      states;
+	QList<Transition_t> transitions;
+	QList<Operand_t>    operands;
+	QList<Node_t>       nodes;
+	QList<Program_t>    programs;
+
+	QMap<componentId_t, uint> variablesIndexes;
+	QMap<componentId_t, uint> statesIndexes;
+	QMap<componentId_t, uint> transitionsIndexes;
+
+	// Shared among copies, null if conditions are interpreted
+	shared_ptr<const FsmNativeConditions> nativeConditions;
+
+	// Dynamic data
+	Snapshot_t snapshot;
+	int lastCrossedTransition = -1; // Transition crossed during last step, if any
+
+	// Working buffers, written by const evaluation functions:
+	// an engine copy must not be used by multiple threads.
+	// Equations evaluation
+	mutable QList<Value_t> nodesValues;
+	// Candidate transitions, sized for the state with most outgoing transitions
+	mutable QList<uint> candidatesBuffer;
+
+};
+
+#endif // FSMSIMULATIONENGINE_H
@@ -0,0 +1,642 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmstatespaceexplorer.h"
+
+// C++ classes
+#include <vector>
+#include <algorithm>
+
+// Qt classes
+#include <QThread>
+#include <QHash>
+
+// StateS classes
+#include "fsm.h"
+
+
+FsmStateSpaceExplorer::FsmStateSpaceExplorer(shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm) :
+	engine(fsm, simulatedFsm)
+{
+	if (fsm == nullptr) return;
+
+
+	for (const auto& inputId : fsm->getInputVariablesIds())
+	{
+		int input = this->engine.getVariableIndex(inputId);
+		if (input < 0) continue;
+
+
+		this->inputsIds.append(inputId);
+		this->inputs.append(input);
+		this->inputsOffsets.append(this->inputsBits);
+		this->inputsBits += this->engine.getVariableSize(input);
+	}
+
+	for (const auto& variableId : fsm->getOutputVariablesIds() + fsm->getInternalVariablesIds())
+	{
+		int variable = this->engine.getVariableIndex(variableId);
+		if (variable < 0) continue;
+
+
+		this->stateVariables.append(variable);
+	}
+
+	for (const auto& outputId : fsm->getOutputVariablesIds())
+	{
+		int output = this->engine.getVariableIndex(outputId);
+		if (output < 0) continue;
+
+
+		this->outputs.append(output);
+		this->report.outputsIds.append(outputId);
+	}
+}
+
+/**
+ * @brief FsmStateSpaceExplorer::explore computes the
+ * reachable configurations graph and the report.
+ * @param maxConfigurations Exploration stops when this number
+ * of configurations is reached, the result being partial.
+ * @param threadsCount Number of worker threads, 0 to use
+ * one per core.
+ */
+ExplorationStatus_t FsmStateSpaceExplorer::explore(uint maxConfigurations, uint threadsCount)
+{
+	this->configurationsWords.clear();
+	this->configurationsOffsets.clear();
+	this->visitedSet.clear();
+	this->edges.clear();
+	this->edgesOffsets.clear();
+	this->parentEdges.clear();
+
+	auto outputsIds = this->report.outputsIds;
+	this->report = Report_t();
+	this->report.outputsIds = outputsIds;
+
+	if ( (this->engine.isSupported() == false) || (this->engine.getInitialState() < 0) )
+	{
+		this->report.status = ExplorationStatus_t::unsupportedMachine;
+		return this->report.status;
+	}
+
+	if (this->inputsBits > FsmStateSpaceExplorer::maxInputsBits)
+	{
+		this->report.status = ExplorationStatus_t::tooManyInputs;
+		return this->report.status;
+	}
+
+
+	if (threadsCount == 0)
+	{
+		threadsCount = qMax(QThread::idealThreadCount(), 1);
+	}
+
+	this->visitedSet.fill(-1, 1024);
+
+	// Initial configuration
+	auto initialEngine = this->engine;
+	initialEngine.reset();
+
+	QList<quint64> initialWords;
+	this->pack(initialEngine, initialWords);
+	this->findOrInsert(initialWords.constData(), initialWords.count(), maxConfigurations);
+	this->parentEdges.append(-1);
+
+	this->report.status = ExplorationStatus_t::complete;
+
+	QSet<uint> deadlocks;
+	QSet<uint> conflicts;
+
+	uint levelBegin = 0;
+	uint levelEnd   = 1;
+	while (levelBegin < levelEnd)
+	{
+		uint levelSize = levelEnd - levelBegin;
+		uint workersCount = qBound((uint)1, levelSize / FsmStateSpaceExplorer::minConfigurationsPerThread, threadsCount);
+
+		QList<WorkerResult_t> results(workersCount);
+		if (workersCount == 1)
+		{
+			this->exploreLevel(levelBegin, levelEnd, results[0]);
+		}
+		else
+		{
+			vector<unique_ptr<QThread>> workers;
+			for (uint i = 0 ; i < workersCount ; i++)
+			{
+				uint first = levelBegin + (quint64)levelSize *  i      / workersCount;
+				uint last  = levelBegin + (quint64)levelSize * (i + 1) / workersCount;
+				WorkerResult_t* result = &results[i];
+
+				workers.emplace_back(QThread::create([this, first, last, result]() { this->exploreLevel(first, last, *result); }));
+				workers.back()->start();
+			}
+
+			for (auto& worker : workers)
+			{
+				worker->wait();
+			}
+		}
+
+		// Level may have been partially explored
+		if (this->stopRequested == true)
+		{
+			this->report.status = ExplorationStatus_t::stopped;
+			break;
+		}
+
+		// Merge in order so that result does not depend on threads count
+		for (const auto& result : results)
+		{
+			for (const auto& successor : result.successors)
+			{
+				while (this->edgesOffsets.count() <= successor.source)
+				{
+					this->edgesOffsets.append(this->edges.count());
+				}
+
+				uint configurationsCount = this->getConfigurationsCount();
+				int target = this->findOrInsert(result.words.constData() + successor.wordsOffset, successor.wordsCount, maxConfigurations);
+				if (target < 0)
+				{
+					this->report.status = ExplorationStatus_t::configurationsLimitReached;
+					break;
+				}
+
+				if ((uint)target == configurationsCount)
+				{
+					// New configuration
+					this->parentEdges.append(this->edges.count());
+				}
+
+				Edge_t edge;
+				edge.target            = target;
+				edge.inputsCombination = successor.inputsCombination;
+				edge.forcedTransition  = successor.forcedTransition;
+				this->edges.append(edge);
+			}
+
+			for (auto configuration : result.deadlocks)
+			{
+				deadlocks.insert(configuration);
+			}
+			for (auto configuration : result.conflicts)
+			{
+				conflicts.insert(configuration);
+			}
+
+			if (this->report.status != ExplorationStatus_t::complete) break;
+		}
+
+		if (this->report.status != ExplorationStatus_t::complete) break;
+
+
+		levelBegin = levelEnd;
+		levelEnd   = this->getConfigurationsCount();
+
+		if (levelBegin < levelEnd)
+		{
+			this->report.depth++;
+		}
+
+		if (this->progressCallback != nullptr)
+		{
+			this->progressCallback(levelEnd, this->report.depth);
+		}
+	}
+
+	// Build report
+	this->report.edgesCount = this->edges.count();
+	this->report.deadlockConfigurationsCount = deadlocks.count();
+
+	QList<bool> stateReached(this->engine.getStatesCount(), false);
+	QList<bool> stateHasDeadlock(this->engine.getStatesCount(), false);
+	QList<bool> stateHasConflict(this->engine.getStatesCount(), false);
+	for (uint i = 0 ; i < this->getConfigurationsCount() ; i++)
+	{
+		const quint64* words = this->configurationsWords.constData() + this->configurationsOffsets.at(i);
+
+		uint activeState = words[0];
+		stateReached[activeState] = true;
+		if (deadlocks.contains(i) == true)
+		{
+			stateHasDeadlock[activeState] = true;
+		}
+		if (conflicts.contains(i) == true)
+		{
+			stateHasConflict[activeState] = true;
+		}
+
+		// Outputs are the first variables in configurations
+		QList<quint64> outputsValues;
+		for (uint j = 0 ; j < (uint)this->outputs.count() ; j++)
+		{
+			outputsValues.append(words[1 + j]);
+		}
+		this->report.outputsCombinations.insert(outputsValues);
+	}
+
+	for (uint i = 0 ; i < this->engine.getStatesCount() ; i++)
+	{
+		auto stateId = this->engine.getStateId(i);
+
+		if (stateReached.at(i) == true)
+		{
+			this->report.reachableStates.append(stateId);
+		}
+		else
+		{
+			this->report.unreachableStates.append(stateId);
+		}
+
+		if (stateHasDeadlock.at(i) == true)
+		{
+			this->report.deadlockStates.append(stateId);
+		}
+
+		if (stateHasConflict.at(i) == true)
+		{
+			this->report.conflictStates.append(stateId);
+		}
+	}
+
+	return this->report.status;
+}
+
+void FsmStateSpaceExplorer::setProgressCallback(ProgressCallback_t callback)
+{
+	this->progressCallback = callback;
+}
+
+/**
+ * @brief FsmStateSpaceExplorer::requestStop can be called
+ * from any thread. Exploration ends with a stopped status.
+ */
+void FsmStateSpaceExplorer::requestStop()
+{
+	this->stopRequested = true;
+}
+
+const FsmStateSpaceExplorer::Report_t& FsmStateSpaceExplorer::getReport() const
+{
+	return this->report;
+}
+
+uint FsmStateSpaceExplorer::getConfigurationsCount() const
+{
+	return this->configurationsOffsets.count();
+}
+
+/**
+ * @brief FsmStateSpaceExplorer::loadConfiguration sets
+ * an initialized engine built from the same FSM to a
+ * configuration. Inputs values are left unchanged.
+ */
+void FsmStateSpaceExplorer::loadConfiguration(uint configuration, FsmSimulationEngine& engine) const
+{
+	if (configuration >= this->getConfigurationsCount()) return;
+
+
+	const quint64* words = this->configurationsWords.constData() + this->configurationsOffsets.at(configuration);
+
+	auto snapshot = engine.getSnapshot();
+	snapshot.activeState           = *words++;
+	snapshot.transitionToBeCrossed = -1;
+
+	for (auto variable : this->stateVariables)
+	{
+		snapshot.variablesValues[variable] = *words++;
+	}
+
+	snapshot.variablesToResetBeforeNextStep.clear();
+	uint count = *words++;
+	for (uint i = 0 ; i < count ; i++)
+	{
+		snapshot.variablesToResetBeforeNextStep.append(*words++);
+	}
+
+	snapshot.variablesToResetAfterNextStep.clear();
+	count = *words++;
+	for (uint i = 0 ; i < count ; i++)
+	{
+		snapshot.variablesToResetAfterNextStep.append(*words++);
+	}
+
+	engine.restoreSnapshot(snapshot);
+}
+
+QList<FsmStateSpaceExplorer::Edge_t> FsmStateSpaceExplorer::getSuccessors(uint configuration) const
+{
+	if (configuration >= (uint)this->edgesOffsets.count()) return QList<Edge_t>();
+
+
+	qsizetype begin = this->edgesOffsets.at(configuration);
+	qsizetype end   = this->edges.count();
+	if (configuration + 1 < (uint)this->edgesOffsets.count())
+	{
+		end = this->edgesOffsets.at(configuration + 1);
+	}
+
+	return this->edges.mid(begin, end - begin);
+}
+
+/**
+ * @brief FsmStateSpaceExplorer::getPathTo obtains
+ * a shortest path from the initial configuration.
+ */
+QList<FsmStateSpaceExplorer::Edge_t> FsmStateSpaceExplorer::getPathTo(uint configuration) const
+{
+	QList<Edge_t> path;
+
+	if (configuration >= this->getConfigurationsCount()) return path;
+
+
+	qsizetype parentEdge = this->parentEdges.at(configuration);
+	while (parentEdge >= 0)
+	{
+		path.prepend(this->edges.at(parentEdge));
+
+		// Find the source of this edge
+		auto source = std::upper_bound(this->edgesOffsets.begin(), this->edgesOffsets.end(), parentEdge) - this->edgesOffsets.begin() - 1;
+		parentEdge = this->parentEdges.at(source);
+	}
+
+	return path;
+}
+
+const FsmSimulationEngine& FsmStateSpaceExplorer::getEngine() const
+{
+	return this->engine;
+}
+
+const QList<componentId_t>& FsmStateSpaceExplorer::getInputsIds() const
+{
+	return this->inputsIds;
+}
+
+quint64 FsmStateSpaceExplorer::getInputsCombinationsCount() const
+{
+	return (quint64)1 << this->inputsBits;
+}
+
+/**
+ * @brief FsmStateSpaceExplorer::getInputsValues converts
+ * an inputs combination to inputs values, in the order of
+ * getInputsIds().
+ */
+QList<LogicValue> FsmStateSpaceExplorer::getInputsValues(quint64 inputsCombination) const
+{
+	QList<LogicValue> values;
+
+	for (uint i = 0 ; i < (uint)this->inputs.count() ; i++)
+	{
+		uint size = this->engine.getVariableSize(this->inputs.at(i));
+		quint64 bits = (inputsCombination >> this->inputsOffsets.at(i)) & FsmSimulationEngine::getMask(size);
+
+		values.append(FsmSimulationEngine::unpackValue(bits, size));
+	}
+
+	return values;
+}
+
+void FsmStateSpaceExplorer::applyInputsCombination(quint64 inputsCombination, FsmSimulationEngine& engine) const
+{
+	for (uint i = 0 ; i < (uint)this->inputs.count() ; i++)
+	{
+		uint input = this->inputs.at(i);
+		engine.setVariableValue(input, inputsCombination >> this->inputsOffsets.at(i));
+	}
+}
+
+/**
+ * @brief FsmStateSpaceExplorer::exploreLevel computes the successors
+ * of a range of configurations. This is run in worker threads:
+ * configurations storage is only read, as merge occurs afterwards.
+ */
+void FsmStateSpaceExplorer::exploreLevel(uint firstConfiguration, uint lastConfiguration, WorkerResult_t& result) const
+{
+	// Each worker needs its own engine
+	auto engine = this->engine;
+	engine.reset();
+
+	quint64 combinationsCount = this->getInputsCombinationsCount();
+
+	QList<int>     choices;
+	QList<quint64> choicesCombinations;
+	QList<bool>    choicesForced;
+	QList<int>     candidateTransitions;
+	for (uint configuration = firstConfiguration ; configuration < lastConfiguration ; configuration++)
+	{
+		if (this->stopRequested == true) return;
+
+
+		this->loadConfiguration(configuration, engine);
+		auto configurationSnapshot = engine.getSnapshot();
+
+		// Determine the different choices for next step
+		choices.clear();
+		choicesCombinations.clear();
+		choicesForced.clear();
+		for (quint64 inputsCombination = 0 ; inputsCombination < combinationsCount ; inputsCombination++)
+		{
+			this->applyInputsCombination(inputsCombination, engine);
+
+			candidateTransitions.clear();
+			for (auto transition : engine.getCandidateTransitions())
+			{
+				candidateTransitions.append(transition);
+			}
+
+			if (candidateTransitions.count() > 1)
+			{
+				if ( (result.conflicts.isEmpty() == true) || (result.conflicts.last() != configuration) )
+				{
+					result.conflicts.append(configuration);
+				}
+			}
+			else if (candidateTransitions.isEmpty() == true)
+			{
+				// Stay in current state
+				candidateTransitions.append(-1);
+			}
+
+			bool forced = (candidateTransitions.count() > 1);
+			for (auto transition : candidateTransitions)
+			{
+				auto choice = choices.indexOf(transition);
+				if (choice < 0)
+				{
+					choices.append(transition);
+					choicesCombinations.append(inputsCombination);
+					choicesForced.append(forced);
+				}
+				else if ( (choicesForced.at(choice) == true) && (forced == false) )
+				{
+					// Prefer choices that do not require user interaction to be replayed
+					choicesCombinations[choice] = inputsCombination;
+					choicesForced[choice] = false;
+				}
+			}
+		}
+
+		// Compute successors
+		const quint64* configurationWords = this->configurationsWords.constData() + this->configurationsOffsets.at(configuration);
+		qsizetype configurationWordsCount = this->getConfigurationWordsCount(configuration);
+
+		bool isDeadlock = true;
+		for (int i = 0 ; i < choices.count() ; i++)
+		{
+			engine.restoreSnapshot(configurationSnapshot);
+			this->applyInputsCombination(choicesCombinations.at(i), engine);
+			engine.doStepThroughTransition(choices.at(i));
+
+			Successor_t successor;
+			successor.source            = configuration;
+			successor.wordsOffset       = result.words.count();
+			successor.inputsCombination = choicesCombinations.at(i);
+			successor.forcedTransition  = (choicesForced.at(i) == true) ? choices.at(i) : -1;
+
+			this->pack(engine, result.words);
+			successor.wordsCount = result.words.count() - successor.wordsOffset;
+
+			if ( (successor.wordsCount != configurationWordsCount) ||
+			     (std::equal(configurationWords, configurationWords + configurationWordsCount, result.words.constData() + successor.wordsOffset) == false) )
+			{
+				isDeadlock = false;
+			}
+
+			result.successors.append(successor);
+		}
+
+		if (isDeadlock == true)
+		{
+			result.deadlocks.append(configuration);
+		}
+	}
+}
+
+/**
+ * @brief FsmStateSpaceExplorer::pack appends the current
+ * configuration of an engine to a words list:
+ * active state, variables values, then pending resets lists
+ * each preceded with its size.
+ */
+void FsmStateSpaceExplorer::pack(const FsmSimulationEngine& engine, QList<quint64>& words) const
+{
+	const auto& snapshot = engine.getSnapshot();
+
+	words.append(snapshot.activeState);
+
+	for (auto variable : this->stateVariables)
+	{
+		words.append(snapshot.variablesValues.at(variable));
+	}
+
+	words.append(snapshot.variablesToResetBeforeNextStep.count());
+	for (auto variable : snapshot.variablesToResetBeforeNextStep)
+	{
+		words.append(variable);
+	}
+
+	words.append(snapshot.variablesToResetAfterNextStep.count());
+	for (auto variable : snapshot.variablesToResetAfterNextStep)
+	{
+		words.append(variable);
+	}
+}
+
+qsizetype FsmStateSpaceExplorer::getConfigurationWordsCount(uint configuration) const
+{
+	if (configuration + 1 < this->getConfigurationsCount())
+	{
+		return this->configurationsOffsets.at(configuration + 1) - this->configurationsOffsets.at(configuration);
+	}
+	else
+	{
+		return this->configurationsWords.count() - this->configurationsOffsets.at(configuration);
+	}
+}
+
+/**
+ * @brief FsmStateSpaceExplorer::findOrInsert looks for a
+ * configuration in the visited set, and adds it if not found.
+ * @return Configuration index, or -1 if it had to be added
+ * but the configurations limit is reached.
+ */
+int FsmStateSpaceExplorer::findOrInsert(const quint64* words, uint wordsCount, uint maxConfigurations)
+{
+	qsizetype mask = this->visitedSet.count() - 1;
+	qsizetype slot = qHashRange(words, words + wordsCount) & mask;
+	while (this->visitedSet.at(slot) >= 0)
+	{
+		uint configuration = this->visitedSet.at(slot);
+		if (this->getConfigurationWordsCount(configuration) == wordsCount)
+		{
+			const quint64* configurationWords = this->configurationsWords.constData() + this->configurationsOffsets.at(configuration);
+			if (std::equal(words, words + wordsCount, configurationWords) == true)
+			{
+				return configuration;
+			}
+		}
+
+		slot = (slot + 1) & mask;
+	}
+
+	if (this->getConfigurationsCount() >= maxConfigurations) return -1;
+
+
+	uint configuration = this->getConfigurationsCount();
+	this->visitedSet[slot] = configuration;
+	this->configurationsOffsets.append(this->configurationsWords.count());
+	for (uint i = 0 ; i < wordsCount ; i++)
+	{
+		this->configurationsWords.append(words[i]);
+	}
+
+	// Keep load factor under 1/2
+	if ((qsizetype)this->getConfigurationsCount() * 2 > this->visitedSet.count())
+	{
+		this->growVisitedSet();
+	}
+
+	return configuration;
+}
+
+void FsmStateSpaceExplorer::growVisitedSet()
+{
+	this->visitedSet.fill(-1, this->visitedSet.count() * 2);
+
+	qsizetype mask = this->visitedSet.count() - 1;
+	for (uint configuration = 0 ; configuration < this->getConfigurationsCount() ; configuration++)
+	{
+		const quint64* words = this->configurationsWords.constData() + this->configurationsOffsets.at(configuration);
+
+		qsizetype slot = qHashRange(words, words + this->getConfigurationWordsCount(configuration)) & mask;
+		while (this->visitedSet.at(slot) >= 0)
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		this->visitedSet[slot] = configuration;
+	}
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMSTATESPACEEXPLORER_H
+#define FSMSTATESPACEEXPLORER_H
+
+// C++ classes
+#include <memory>
+#include <atomic>
+#include <functional>
+using namespace std;
+
+// Qt classes
+#include <QList>
+#include <QSet>
+
+// StateS classes
+#include "statestypes.h"
+#include "logicvalue.h"
+#include "fsmsimulationengine.h"
+class Fsm;
+class SimulatedFsm;
+
+
+/**
+ * @brief The FsmStateSpaceExplorer class computes all the
+ * configurations of a FSM reachable from its initial state.
+ *
+ * A configuration is the active state with the values of all
+ * outputs and internal variables, and the pending resets: this
+ * is the simulation engine snapshot without the inputs, which
+ * are free at each step. It is packed in a few 64-bit words.
+ *
+ * Exploration is a breadth-first search: each level is split
+ * among worker threads that compute successors, which are then
+ * merged in order in the visited set. The result is thus the
+ * same whatever the number of threads, and the path from the
+ * initial configuration to any other one is a shortest path.
+ *
+ * When multiple transitions are crossable, each of them is
+ * explored as a separate successor.
+ *
+ * Exploration can be run in a thread and stopped from another
+ * one: a stop request is definitive for this explorer.
+ */
+class FsmStateSpaceExplorer
+{
+
+	/////
+	// Type declarations
+public:
+	// Edge of the configurations graph.
+	// Inputs values are packed as a combination number.
+	struct Edge_t
+	{
+		uint    target;
+		quint64 inputsCombination;
+		int     forcedTransition; // Transition chosen on a conflict, -1 otherwise
+	};
+
+	// Called from the exploring thread after each level
+	typedef function<void(uint configurationsCount, uint depth)> ProgressCallback_t;
+
+	struct Report_t
+	{
+		ExplorationStatus_t status = ExplorationStatus_t::unsupportedMachine;
+		uint depth = 0;
+		quint64 edgesCount = 0;
+		QList<componentId_t> reachableStates;
+		QList<componentId_t> unreachableStates;
+		// States in which a configuration without any way out was found
+		QList<componentId_t> deadlockStates;
+		quint64 deadlockConfigurationsCount = 0;
+		// States in which multiple transitions can be crossable
+		QList<componentId_t> conflictStates;
+		QList<componentId_t> outputsIds;
+		QSet<QList<quint64>> outputsCombinations;
+	};
+
+private:
+	struct Successor_t
+	{
+		uint      source;
+		qsizetype wordsOffset;
+		uint      wordsCount;
+		quint64   inputsCombination;
+		int       forcedTransition;
+	};
+
+	// Result of a worker for a part of the current level
+	struct WorkerResult_t
+	{
+		QList<quint64>     words;
+		QList<Successor_t> successors;
+		QList<uint>        deadlocks;
+		QList<uint>        conflicts;
+	};
+
+	/////
+	// Static variables
+public:
+	// Inputs combinations are enumerated: limit their number
+	static const uint maxInputsBits = 16;
+	static const uint defaultMaxConfigurations = 1 << 22;
+
+private:
+	// Smaller levels are not worth splitting among threads
+	static const uint minConfigurationsPerThread = 64;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmStateSpaceExplorer(shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm);
+
+	/////
+	// Object functions
+public:
+	ExplorationStatus_t explore(uint maxConfigurations = FsmStateSpaceExplorer::defaultMaxConfigurations, uint threadsCount = 0);
+	void setProgressCallback(ProgressCallback_t callback);
+	void requestStop();
+	const Report_t& getReport() const;
+
+	// Configurations graph
+	uint getConfigurationsCount() const;
+	void loadConfiguration(uint configuration, FsmSimulationEngine& engine) const;
+	QList<Edge_t> getSuccessors(uint configuration) const;
+	QList<Edge_t> getPathTo(uint configuration) const;
+
+	const FsmSimulationEngine& getEngine() const;
+	const QList<componentId_t>& getInputsIds() const;
+	quint64 getInputsCombinationsCount() const;
+	QList<LogicValue> getInputsValues(quint64 inputsCombination) const;
+	void applyInputsCombination(quint64 inputsCombination, FsmSimulationEngine& engine) const;
+
+private:
+	void exploreLevel(uint firstConfiguration, uint lastConfiguration, WorkerResult_t& result) const;
+	void pack(const FsmSimulationEngine& engine, QList<quint64>& words) const;
+	qsizetype getConfigurationWordsCount(uint configuration) const;
+	int findOrInsert(const quint64* words, uint wordsCount, uint maxConfigurations);
+	void growVisitedSet();
+
+	/////
+	// Object variables
+private:
+	FsmSimulationEngine engine;
+
+	QList<componentId_t> inputsIds;
+	QList<uint> inputs;
+	QList<uint> inputsOffsets; // Bit offset of each input in combinations
+	uint inputsBits = 0;
+	QList<uint> stateVariables; // Variables stored in configurations
+	QList<uint> outputs;
+
+	// Configurations packed one after the other
+	QList<quint64> configurationsWords;
+	QList<qsizetype> configurationsOffsets;
+
+	// Open addressing hash table of configurations indexes, -1 for empty slots
+	QList<qint64> visitedSet;
+
+	// Graph, successors of configuration i are edges [edgesOffsets[i]..edgesOffsets[i+1][
+	QList<Edge_t> edges;
+	QList<qsizetype> edgesOffsets;
+	QList<qsizetype> parentEdges; // -1 for initial configuration
+
+	Report_t report;
+
+	ProgressCallback_t progressCallback;
+	atomic<bool> stopRequested = false;
+
+};
+
+#endif // FSMSTATESPACEEXPLORER_H
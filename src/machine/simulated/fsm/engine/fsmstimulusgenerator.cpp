@@ -0,0 +1,196 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "fsmstimulusgenerator.h"
+
+// Qt classes
+#include <QRandomGenerator>
+
+// StateS classes
+#include "fsm.h"
+
+
+FsmStimulusGenerator::FsmStimulusGenerator(shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm) :
+	engine(fsm, simulatedFsm)
+{
+	if (fsm == nullptr) return;
+
+
+	for (const auto& inputId : fsm->getInputVariablesIds())
+	{
+		int index = this->engine.getVariableIndex(inputId);
+		if (index < 0) continue;
+
+
+		Input_t input;
+		input.id     = inputId;
+		input.index  = index;
+		input.size   = this->engine.getVariableSize(index);
+		input.weight = FsmStimulusGenerator::defaultWeight;
+
+		this->inputs.append(input);
+	}
+}
+
+bool FsmStimulusGenerator::isSupported() const
+{
+	return this->engine.isSupported();
+}
+
+/**
+ * @brief FsmStimulusGenerator::setInputWeight sets the
+ * probability, in percent, for each bit of an input to be 1.
+ */
+void FsmStimulusGenerator::setInputWeight(componentId_t inputId, uint weight)
+{
+	for (auto& input : this->inputs)
+	{
+		if (input.id == inputId)
+		{
+			input.weight = qMin(weight, (uint)100);
+		}
+	}
+}
+
+uint FsmStimulusGenerator::getInputWeight(componentId_t inputId) const
+{
+	for (const auto& input : this->inputs)
+	{
+		if (input.id == inputId)
+		{
+			return input.weight;
+		}
+	}
+
+	return FsmStimulusGenerator::defaultWeight;
+}
+
+/**
+ * @brief FsmStimulusGenerator::addConstraint adds an equation
+ * that must be true for the generated inputs values.
+ * @return False if equation is not supported by the engine.
+ */
+bool FsmStimulusGenerator::addConstraint(shared_ptr<const Equation> constraint)
+{
+	if (constraint == nullptr) return false;
+
+
+	auto engine = this->engine;
+	engine.compileEquation(constraint);
+	if (engine.isSupported() == false) return false;
+
+
+	this->constraints.append(this->engine.compileEquation(constraint));
+
+	return true;
+}
+
+/**
+ * @brief FsmStimulusGenerator::compileNativeConditions compiles
+ * the transitions conditions of the engine to native code, so
+ * that copies obtained from getEngine() step faster.
+ */
+bool FsmStimulusGenerator::compileNativeConditions(QString& errorText)
+{
+	return this->engine.compileNativeConditions(errorText);
+}
+
+const FsmSimulationEngine& FsmStimulusGenerator::getEngine() const
+{
+	return this->engine;
+}
+
+/**
+ * @brief FsmStimulusGenerator::generate sets random inputs
+ * values in an engine obtained from getEngine().
+ * @return False if constraints could not be met, in which
+ * case inputs keep their previous values.
+ */
+bool FsmStimulusGenerator::generate(FsmSimulationEngine& engine, QRandomGenerator& generator) const
+{
+	QList<quint64> previousValues;
+	if (this->constraints.isEmpty() == false)
+	{
+		for (const auto& input : this->inputs)
+		{
+			previousValues.append(engine.getVariableValue(input.index));
+		}
+	}
+
+	for (uint attempt = 0 ; attempt < FsmStimulusGenerator::maxAttempts ; attempt++)
+	{
+		for (const auto& input : this->inputs)
+		{
+			engine.setVariableValue(input.index, this->generateValue(input, generator));
+		}
+
+		bool constraintsMet = true;
+		for (auto constraint : this->constraints)
+		{
+			if (engine.isTrue(constraint) == false)
+			{
+				constraintsMet = false;
+				break;
+			}
+		}
+
+		if (constraintsMet == true) return true;
+	}
+
+	for (int i = 0 ; i < previousValues.count() ; i++)
+	{
+		engine.setVariableValue(this->inputs.at(i).index, previousValues.at(i));
+	}
+
+	return false;
+}
+
+quint64 FsmStimulusGenerator::generateValue(const Input_t& input, QRandomGenerator& generator) const
+{
+	quint64 mask = FsmSimulationEngine::getMask(input.size);
+
+	if (input.weight == 50)
+	{
+		// Fast path: all bits at once
+		return generator.generate64() & mask;
+	}
+	else if (input.weight == 0)
+	{
+		return 0;
+	}
+	else if (input.weight == 100)
+	{
+		return mask;
+	}
+	else
+	{
+		quint64 value = 0;
+		for (uint i = 0 ; i < input.size ; i++)
+		{
+			if (generator.bounded(100u) < input.weight)
+			{
+				value |= ((quint64)1 << i);
+			}
+		}
+		return value;
+	}
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FSMSTIMULUSGENERATOR_H
+#define FSMSTIMULUSGENERATOR_H
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QList>
+class QRandomGenerator;
+class QString;
+
+// StateS classes
+#include "statestypes.h"
+#include "fsmsimulationengine.h"
+class Fsm;
+class SimulatedFsm;
+class Equation;
+
+
+/**
+ * @brief The FsmStimulusGenerator class generates random
+ * inputs values for a simulation engine.
+ *
+ * Each input has a weight, which is the probability for each
+ * of its bits to be 1. Constraints are equations that must be
+ * true for generated values: values are drawn again until all
+ * constraints are met, up to a maximum number of attempts.
+ *
+ * Generation only depends on the random generator state, which
+ * makes runs reproducible from their seed. The generator is not
+ * modified by generation and can be shared among threads, each
+ * one using its own copy of the engine obtained from getEngine().
+ */
+class FsmStimulusGenerator
+{
+
+	/////
+	// Type declarations
+private:
+	struct Input_t
+	{
+		componentId_t id;
+		uint index;  // Engine variable index
+		uint size;
+		uint weight; // Percentage of bits set to 1
+	};
+
+	/////
+	// Static variables
+public:
+	static const uint defaultWeight = 50;
+	// Attempts to meet constraints before giving up for current step
+	static const uint maxAttempts = 64;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit FsmStimulusGenerator(shared_ptr<const Fsm> fsm, shared_ptr<const SimulatedFsm> simulatedFsm);
+
+	/////
+	// Object functions
+public:
+	bool isSupported() const;
+
+	void setInputWeight(componentId_t inputId, uint weight);
+	uint getInputWeight(componentId_t inputId) const;
+	bool addConstraint(shared_ptr<const Equation> constraint);
+	bool compileNativeConditions(QString& errorText);
+
+	const FsmSimulationEngine& getEngine() const;
+	bool generate(FsmSimulationEngine& engine, QRandomGenerator& generator) const;
+
+private:
+	quint64 generateValue(const Input_t& input, QRandomGenerator& generator) const;
+
+	/////
+	// Object variables
+private:
+	// Engine in which constraints are compiled
+	FsmSimulationEngine engine;
+
+	QList<Input_t> inputs;
+	QList<int> constraints;
+
+};
+
+#endif // FSMSTIMULUSGENERATOR_H
@@ -41,6 +41,12 @@
 #include "statesui.h"
 
 
+/**
+ * @brief SimulatedFsm::build creates the simulated components
+ * and gives them dense indexes. Transitions source and target
+ * are resolved to these indexes, so that stepping never has to
+ * look up a component by its ID.
+ */
 void SimulatedFsm::build()
 {
 	SimulatedMachine::build();
@@ -49,76 +55,172 @@ void SimulatedFsm::build()
 	if (fsm == nullptr) return;
 
 
-	this->initialStateId = fsm->getInitialStateId();
-
 	for (const auto& stateId : fsm->getAllStatesIds())
 	{
 		auto simulatedState = make_shared<SimulatedFsmState>(stateId);
 		this->registerSimulatedComponent(stateId, simulatedState);
+
+		this->statesIndexes[stateId] = this->simulatedStates.count();
+		this->simulatedStates.append(simulatedState);
 	}
 
 	for (const auto& transitionId : fsm->getAllTransitionsIds())
 	{
 		auto simulatedTransition = make_shared<SimulatedFsmTransition>(transitionId);
 		this->registerSimulatedComponent(transitionId, simulatedTransition);
+		this->registerEquation(simulatedTransition->getCondition());
+
+		this->transitionsIndexes[transitionId] = this->simulatedTransitions.count();
+		this->simulatedTransitions.append(simulatedTransition);
+	}
+
+	this->statesOutgoingTransitions.resize(this->simulatedStates.count());
+	for (int i = 0 ; i < this->simulatedStates.count() ; i++)
+	{
+		for (const auto& transitionId : this->simulatedStates.at(i)->getOutgoingTransitionsIds())
+		{
+			int transition = this->getTransitionIndex(transitionId);
+			if (transition < 0) continue;
+
+
+			this->statesOutgoingTransitions[i].append(transition);
+		}
 	}
+
+	for (const auto& simulatedTransition : this->simulatedTransitions)
+	{
+		this->transitionsTargetStates.append(this->getStateIndex(simulatedTransition->getTargetStateId()));
+	}
+
+	this->initialState = this->getStateIndex(fsm->getInitialStateId());
 }
 
 shared_ptr<SimulatedFsmState> SimulatedFsm::getSimulatedState(componentId_t componentId) const
 {
-	return dynamic_pointer_cast<SimulatedFsmState>(this->getSimulatedComponent(componentId));
+	auto it = this->statesIndexes.constFind(componentId);
+	if (it == this->statesIndexes.constEnd()) return nullptr;
+
+
+	return this->simulatedStates.at(it.value());
 }
 
 shared_ptr<SimulatedFsmTransition> SimulatedFsm::getSimulatedTransition(componentId_t componentId) const
 {
-	return dynamic_pointer_cast<SimulatedFsmTransition>(this->getSimulatedComponent(componentId));
+	auto it = this->transitionsIndexes.constFind(componentId);
+	if (it == this->transitionsIndexes.constEnd()) return nullptr;
+
+
+	return this->simulatedTransitions.at(it.value());
 }
 
 void SimulatedFsm::forceStateActivation(componentId_t stateToActivate)
 {
-	// Disable currently active state
-	auto previousActiveState = this->getSimulatedState(this->activeStateId);
-	if (previousActiveState != nullptr)
-	{
-		previousActiveState->setActive(false);
-	}
+	this->activateState(this->getStateIndex(stateToActivate));
+}
 
-	// Change currently active state
-	this->activeStateId = stateToActivate;
+componentId_t SimulatedFsm::getInitialStateId() const
+{
+	if (this->initialState < 0) return nullId;
 
-	auto newActiveState = this->getSimulatedState(this->activeStateId);
-	if (newActiveState != nullptr)
-	{
-		// Enable new state
-		newActiveState->setActive(true);
 
-		// Enable state actions
-		for (const auto& action : newActiveState->getActions())
-		{
-			if (action == nullptr) continue;
+	return this->simulatedStates.at(this->initialState)->getId();
+}
 
+componentId_t SimulatedFsm::getActiveStateId() const
+{
+	if (this->activeState < 0) return nullId;
 
-			if ( (action->isActionMemorized() == true) && (this->memorizedStateActionBehavior == SimulationBehavior_t::immediately) )
-			{
-				action->doAction();
-			}
-			else if ( (action->isActionMemorized() == false) && (this->continuousStateActionBehavior == SimulationBehavior_t::immediately) )
-			{
-				action->doAction();
-				this->variablesToResetAfterNextStep.append(action->getVariableId());
-			}
-		}
-	}
+
+	return this->simulatedStates.at(this->activeState)->getId();
 }
 
-componentId_t SimulatedFsm::getInitialStateId() const
+componentId_t SimulatedFsm::getTransitionToBeCrossedId() const
+{
+	if (this->transitionToBeCrossed < 0) return nullId;
+
+
+	return this->simulatedTransitions.at(this->transitionToBeCrossed)->getId();
+}
+
+QList<componentId_t> SimulatedFsm::getVariablesToResetBeforeNextStep() const
 {
-	return this->initialStateId;
+	return this->getVariablesIds(this->variablesToResetBeforeNextStep);
 }
 
-componentId_t SimulatedFsm::getActiveStateId() const
+QList<componentId_t> SimulatedFsm::getVariablesToResetAfterNextStep() const
 {
-	return this->activeStateId;
+	return this->getVariablesIds(this->variablesToResetAfterNextStep);
+}
+
+/**
+ * @brief SimulatedFsm::forceTransitionToBeCrossed selects the
+ * transition crossed on next step instead of calling prepareStep().
+ * This is used to replay a step where multiple transitions were
+ * crossable, without asking user.
+ * @return False if transition does not leave the active state.
+ */
+bool SimulatedFsm::forceTransitionToBeCrossed(componentId_t transitionId)
+{
+	if (this->activeState < 0) return false;
+
+	int transition = this->getTransitionIndex(transitionId);
+	if (transition < 0) return false;
+
+	if (this->statesOutgoingTransitions.at(this->activeState).contains(transition) == false) return false;
+
+
+	this->transitionToBeCrossed = transition;
+
+	return true;
+}
+
+/**
+ * @brief SimulatedFsm::restoreDynamicState sets the simulation
+ * internal state without executing any action. This is used to
+ * apply the result of a simulation done outside of this object.
+ * Variables values must be restored separately.
+ */
+void SimulatedFsm::restoreDynamicState(componentId_t activeStateId, componentId_t transitionToBeCrossedId, const QList<componentId_t>& variablesToResetBeforeNextStep, const QList<componentId_t>& variablesToResetAfterNextStep)
+{
+	this->transitionToBeCrossed = this->getTransitionIndex(transitionToBeCrossedId);
+
+	this->variablesToResetBeforeNextStep.clear();
+	for (const auto& variableId : variablesToResetBeforeNextStep)
+	{
+		int variable = this->getSimulatedVariableIndex(variableId);
+		if (variable < 0) continue;
+
+
+		this->variablesToResetBeforeNextStep.append(variable);
+	}
+
+	this->variablesToResetAfterNextStep.clear();
+	for (const auto& variableId : variablesToResetAfterNextStep)
+	{
+		int variable = this->getSimulatedVariableIndex(variableId);
+		if (variable < 0) continue;
+
+
+		this->variablesToResetAfterNextStep.append(variable);
+	}
+
+	int newActiveState = this->getStateIndex(activeStateId);
+	if (newActiveState == this->activeState) return;
+
+
+	if (this->activeState >= 0)
+	{
+		this->simulatedStates.at(this->activeState)->setActive(false);
+	}
+
+	this->activeState = newActiveState;
+
+	if (this->activeState >= 0)
+	{
+		this->simulatedStates.at(this->activeState)->setActive(true);
+	}
+
+	emit this->stateChangedEvent();
 }
 
 void SimulatedFsm::targetStateSelectionMadeEventHandler(int i)
@@ -129,8 +231,8 @@ void SimulatedFsm::targetStateSelectionMadeEventHandler(int i)
 	this->signalMapper->deleteLater(); // Can't be deleted now as we are in a call from this object
 	this->signalMapper = nullptr;
 
-	this->transitionToBeCrossedId = this->potentialTransitionsIds[i];
-	this->potentialTransitionsIds.clear();
+	this->transitionToBeCrossed = this->potentialTransitions[i];
+	this->potentialTransitions.clear();
 
 	emit this->resumeNormalActivitiesEvent();
 }
@@ -138,10 +240,10 @@ void SimulatedFsm::targetStateSelectionMadeEventHandler(int i)
 void SimulatedFsm::subMachineReset()
 {
 	// Clean any remaining internal state
-	this->transitionToBeCrossedId = nullId;
+	this->transitionToBeCrossed = -1;
 	this->variablesToResetBeforeNextStep.clear();
 	this->variablesToResetAfterNextStep.clear();
-	this->potentialTransitionsIds.clear();
+	this->potentialTransitions.clear();
 
 	delete this->targetStateSelector;
 	this->targetStateSelector = nullptr;
@@ -150,43 +252,38 @@ void SimulatedFsm::subMachineReset()
 	this->signalMapper = nullptr;
 
 	// Enable initial state and activate its actions
-	this->forceStateActivation(this->initialStateId);
+	this->activateState(this->initialState);
 }
 
 void SimulatedFsm::subMachinePrepareStep()
 {
-	auto currentActiveState = this->getSimulatedState(this->activeStateId);
-	if (currentActiveState == nullptr) return;
+	if (this->activeState < 0) return;
 
 
 	//
 	// Look for potential transitions
-	QMap<uint, componentId_t> candidateTransitions;
-	for (const auto& transitionId : currentActiveState->getOutgoingTransitionsIds())
+	QMap<uint, uint> candidateTransitions;
+	for (auto transition : this->statesOutgoingTransitions.at(this->activeState))
 	{
-		auto transition = this->getSimulatedTransition(transitionId);
-		if (transition == nullptr) continue;
-
-
-		auto condition = transition->getCondition();
+		auto condition = this->simulatedTransitions.at(transition)->getCondition();
 		if (condition != nullptr)
 		{
 			if (condition->isTrue())
 			{
-				candidateTransitions.insert(candidateTransitions.count(), transition->getId());
+				candidateTransitions.insert(candidateTransitions.count(), transition);
 			}
 		}
 		else // (condition == nullptr)
 		{
 			// Empty conditions are implicitly true
-			candidateTransitions.insert(candidateTransitions.count(), transition->getId());
+			candidateTransitions.insert(candidateTransitions.count(), transition);
 		}
 	}
 
 	if (candidateTransitions.count() == 1)
 	{
 		// One available transition, it will be crossed.
-		this->transitionToBeCrossedId = candidateTransitions[0];
+		this->transitionToBeCrossed = candidateTransitions[0];
 	}
 	else if (candidateTransitions.count() > 1)
 	{
@@ -214,12 +311,11 @@ void SimulatedFsm::subMachinePrepareStep()
 
 		for (int i = 0 ; i < candidateTransitions.count() ; i++)
 		{
-			auto candidateTransition = this->getSimulatedTransition(candidateTransitions[i]);
-			if (candidateTransition == nullptr) continue;
+			int targetState = this->transitionsTargetStates.at(candidateTransitions[i]);
+			if (targetState < 0) continue;
 
 
-			auto targetState = this->getSimulatedState(candidateTransition->getTargetStateId());
-			auto button = new QPushButton(targetState->getName());
+			auto button = new QPushButton(this->simulatedStates.at(targetState)->getName());
 
 			this->signalMapper->setMapping(button, i);
 
@@ -229,7 +325,7 @@ void SimulatedFsm::subMachinePrepareStep()
 			choiceWindowLayout->addWidget(button);
 		}
 
-		this->potentialTransitionsIds = candidateTransitions;
+		this->potentialTransitions = candidateTransitions;
 
 		this->targetStateSelector->open();
 	}
@@ -238,22 +334,16 @@ void SimulatedFsm::subMachinePrepareStep()
 void SimulatedFsm::subMachinePrepareActions()
 {
 	// Reset unmemorized actions
-	for (auto& variableId : this->variablesToResetBeforeNextStep)
+	for (auto variable : this->variablesToResetBeforeNextStep)
 	{
-		auto simulatedVariable = this->getSimulatedVariable(variableId);
-		if (simulatedVariable == nullptr) continue;
-
-
-		simulatedVariable->reinitialize();
+		this->getSimulatedVariableByIndex(variable)->reinitialize();
 	}
 	this->variablesToResetBeforeNextStep.clear();
 
 	// Prepare for next actions
-	if (this->transitionToBeCrossedId != nullId)
+	if (this->transitionToBeCrossed >= 0)
 	{
-		auto simulatedTransition = this->getSimulatedActuatorComponent(this->transitionToBeCrossedId);
-		if (simulatedTransition == nullptr) return;
-
+		const auto& simulatedTransition = this->simulatedTransitions.at(this->transitionToBeCrossed);
 
 		for (const auto& action : simulatedTransition->getActions())
 		{
@@ -267,7 +357,7 @@ void SimulatedFsm::subMachinePrepareActions()
 			else if ( (action->isActionMemorized() == false) && (this->pulseTransitionActionBehavior == SimulationBehavior_t::prepare) )
 			{
 				action->doAction();
-				this->variablesToResetBeforeNextStep.append(action->getVariableId());
+				this->appendVariableToReset(this->variablesToResetBeforeNextStep, action);
 			}
 		}
 	}
@@ -275,23 +365,18 @@ void SimulatedFsm::subMachinePrepareActions()
 
 void SimulatedFsm::subMachineDoStep()
 {
-	auto currentSimulatedState = this->getSimulatedState(this->activeStateId);
-	if (currentSimulatedState == nullptr) return;
+	if (this->activeState < 0) return;
 
 
 	// Reset unmemorized actions
-	for (auto& variableId : this->variablesToResetAfterNextStep)
+	for (auto variable : this->variablesToResetAfterNextStep)
 	{
-		auto simulatedVariable = this->getSimulatedVariable(variableId);
-		if (simulatedVariable == nullptr) continue;
-
-
-		simulatedVariable->reinitialize();
+		this->getSimulatedVariableByIndex(variable)->reinitialize();
 	}
 	this->variablesToResetAfterNextStep.clear();
 
 	// Look for postponed actions in current state
-	for (const auto& action : currentSimulatedState->getActions())
+	for (const auto& action : this->simulatedStates.at(this->activeState)->getActions())
 	{
 		if (action == nullptr) continue;
 
@@ -303,55 +388,52 @@ void SimulatedFsm::subMachineDoStep()
 		else if ( (action->isActionMemorized() == false) && (this->continuousStateActionBehavior == SimulationBehavior_t::after) )
 		{
 			action->doAction();
-			this->variablesToResetAfterNextStep.append(action->getVariableId());
+			this->appendVariableToReset(this->variablesToResetAfterNextStep, action);
 		}
 	}
 
 	// Cross transition
-	if (this->transitionToBeCrossedId != nullId)
+	if (this->transitionToBeCrossed >= 0)
 	{
-		auto simulatedTransition = this->getSimulatedTransition(this->transitionToBeCrossedId);
-		if (simulatedTransition != nullptr)
+		const auto& simulatedTransition = this->simulatedTransitions.at(this->transitionToBeCrossed);
+
+		// Deactivate previous state
+		this->simulatedStates.at(this->activeState)->setActive(false);
+
+		// Activate transition actions
+		for (const auto& action : simulatedTransition->getActions())
 		{
-			// Deactivate previous state
-			auto previousActiveState = this->getSimulatedState(this->activeStateId);
-			if (previousActiveState != nullptr)
-			{
-				previousActiveState->setActive(false);
-			}
+			if (action == nullptr) continue;
 
-			// Activate transition actions
-			for (const auto& action : simulatedTransition->getActions())
+
+			if ( (action->isActionMemorized() == true) && (this->memorizedTransitionActionBehavior == SimulationBehavior_t::immediately) )
 			{
-				if (action == nullptr) continue;
-
-
-				if ( (action->isActionMemorized() == true) && (this->memorizedTransitionActionBehavior == SimulationBehavior_t::immediately) )
-				{
-					action->doAction();
-				}
-				else if ( (action->isActionMemorized() == false) && (this->pulseTransitionActionBehavior == SimulationBehavior_t::immediately) )
-				{
-					action->doAction();
-					this->variablesToResetAfterNextStep.append(action->getVariableId());
-				}
+				action->doAction();
 			}
-
-			// Update current state
-			this->activeStateId = simulatedTransition->getTargetStateId();
-			currentSimulatedState = this->getSimulatedState(this->activeStateId);
-			if (currentSimulatedState != nullptr)
+			else if ( (action->isActionMemorized() == false) && (this->pulseTransitionActionBehavior == SimulationBehavior_t::immediately) )
 			{
-				currentSimulatedState->setActive(true);
+				action->doAction();
+				this->appendVariableToReset(this->variablesToResetAfterNextStep, action);
 			}
+		}
 
-			emit this->stateChangedEvent();
+		// Update current state
+		this->activeState = this->transitionsTargetStates.at(this->transitionToBeCrossed);
+		if (this->activeState >= 0)
+		{
+			this->simulatedStates.at(this->activeState)->setActive(true);
 		}
-		this->transitionToBeCrossedId = nullId;
+
+		emit this->stateChangedEvent();
+
+		this->transitionToBeCrossed = -1;
 	}
 
+	if (this->activeState < 0) return;
+
+
 	// Activate state actions
-	for (const auto& action : currentSimulatedState->getActions())
+	for (const auto& action : this->simulatedStates.at(this->activeState)->getActions())
 	{
 		if (action == nullptr) continue;
 
@@ -363,13 +445,93 @@ void SimulatedFsm::subMachineDoStep()
 		else if ( (action->isActionMemorized() == false) && (this->continuousStateActionBehavior == SimulationBehavior_t::immediately) )
 		{
 			action->doAction();
-			auto variableId = action->getVariableId();
-			this->variablesToResetAfterNextStep.append(variableId);
-			if (this->variablesToResetBeforeNextStep.contains(variableId))
+			this->appendVariableToReset(this->variablesToResetAfterNextStep, action);
+
+			// If action is handled in current state, remove it from the reset list of transitions
+			int variable = action->getVariableIndex();
+			if (variable >= 0)
 			{
-				// If action is handled in current state, remove it from the reset list of transitions
-				this->variablesToResetBeforeNextStep.removeOne(variableId);
+				this->variablesToResetBeforeNextStep.removeOne(variable);
 			}
 		}
 	}
 }
+
+/**
+ * @brief SimulatedFsm::activateState deactivates the
+ * currently active state and activates the given one,
+ * executing its immediate actions.
+ * @param state Index of the state, -1 to only deactivate.
+ */
+void SimulatedFsm::activateState(int state)
+{
+	// Disable currently active state
+	if (this->activeState >= 0)
+	{
+		this->simulatedStates.at(this->activeState)->setActive(false);
+	}
+
+	// Change currently active state
+	this->activeState = state;
+	if (this->activeState < 0) return;
+
+
+	// Enable new state
+	const auto& newActiveState = this->simulatedStates.at(this->activeState);
+	newActiveState->setActive(true);
+
+	// Enable state actions
+	for (const auto& action : newActiveState->getActions())
+	{
+		if (action == nullptr) continue;
+
+
+		if ( (action->isActionMemorized() == true) && (this->memorizedStateActionBehavior == SimulationBehavior_t::immediately) )
+		{
+			action->doAction();
+		}
+		else if ( (action->isActionMemorized() == false) && (this->continuousStateActionBehavior == SimulationBehavior_t::immediately) )
+		{
+			action->doAction();
+			this->appendVariableToReset(this->variablesToResetAfterNextStep, action);
+		}
+	}
+}
+
+int SimulatedFsm::getStateIndex(componentId_t stateId) const
+{
+	auto it = this->statesIndexes.constFind(stateId);
+	if (it == this->statesIndexes.constEnd()) return -1;
+
+
+	return it.value();
+}
+
+int SimulatedFsm::getTransitionIndex(componentId_t transitionId) const
+{
+	auto it = this->transitionsIndexes.constFind(transitionId);
+	if (it == this->transitionsIndexes.constEnd()) return -1;
+
+
+	return it.value();
+}
+
+void SimulatedFsm::appendVariableToReset(QList<uint>& variablesToReset, const shared_ptr<SimulatedActionOnVariable>& action)
+{
+	int variable = action->getVariableIndex();
+	if (variable < 0) return;
+
+
+	variablesToReset.append(variable);
+}
+
+QList<componentId_t> SimulatedFsm::getVariablesIds(const QList<uint>& variablesIndexes) const
+{
+	QList<componentId_t> variablesIds;
+	for (auto variable : variablesIndexes)
+	{
+		variablesIds.append(this->getSimulatedVariableByIndex(variable)->getId());
+	}
+
+	return variablesIds;
+}
@@ -34,6 +34,7 @@ class QSignalMapper;
 #include "statestypes.h"
 class SimulatedFsmState;
 class SimulatedFsmTransition;
+class SimulatedActionOnVariable;
 
 
 class SimulatedFsm : public SimulatedMachine
@@ -54,10 +55,17 @@ public:
 	shared_ptr<SimulatedFsmTransition> getSimulatedTransition(componentId_t componentId) const;
 
 	void forceStateActivation(componentId_t stateToActivate);
+	bool forceTransitionToBeCrossed(componentId_t transitionId);
 
 	componentId_t getInitialStateId() const;
 	componentId_t getActiveStateId()  const;
 
+	componentId_t getTransitionToBeCrossedId() const;
+	QList<componentId_t> getVariablesToResetBeforeNextStep() const;
+	QList<componentId_t> getVariablesToResetAfterNextStep()  const;
+
+	void restoreDynamicState(componentId_t activeStateId, componentId_t transitionToBeCrossedId, const QList<componentId_t>& variablesToResetBeforeNextStep, const QList<componentId_t>& variablesToResetAfterNextStep);
+
 private slots:
 	void targetStateSelectionMadeEventHandler(int i);
 
@@ -67,6 +75,12 @@ private:
 	virtual void subMachinePrepareActions() override;
 	virtual void subMachineDoStep()         override;
 
+	void activateState(int state);
+	int  getStateIndex     (componentId_t stateId)      const;
+	int  getTransitionIndex(componentId_t transitionId) const;
+	void appendVariableToReset(QList<uint>& variablesToReset, const shared_ptr<SimulatedActionOnVariable>& action);
+	QList<componentId_t> getVariablesIds(const QList<uint>& variablesIndexes) const;
+
 	/////
 	// Signals
 signals:
@@ -75,19 +89,29 @@ signals:
 	/////
 	// Object variables
 private:
+	// Components, referred to using dense indexes while stepping
+	QList<shared_ptr<SimulatedFsmState>>      simulatedStates;
+	QList<shared_ptr<SimulatedFsmTransition>> simulatedTransitions;
+	QMap<componentId_t, uint> statesIndexes;
+	QMap<componentId_t, uint> transitionsIndexes;
+
+	// Machine structure, resolved at build time
+	QList<QList<uint>> statesOutgoingTransitions;
+	QList<int> transitionsTargetStates; // -1 if target does not exist
+
 	// Static state
-	componentId_t initialStateId = nullId;
+	int initialState = -1;
 
 	// Dynamic state
-	componentId_t activeStateId = nullId;
+	int activeState = -1;
 
 	// Temporary working variables
-	componentId_t transitionToBeCrossedId = nullId;
-	QList<componentId_t> variablesToResetBeforeNextStep;
-	QList<componentId_t> variablesToResetAfterNextStep;
+	int transitionToBeCrossed = -1;
+	QList<uint> variablesToResetBeforeNextStep; // Variables indexes
+	QList<uint> variablesToResetAfterNextStep;
 
 	// Resolution of transition conflict
-	QMap<uint, componentId_t> potentialTransitionsIds;
+	QMap<uint, uint> potentialTransitions;
 	QDialog* targetStateSelector = nullptr;
 	QSignalMapper* signalMapper  = nullptr;
 
@@ -27,6 +27,7 @@
 #include "machine.h"
 #include "simulatedactuatorcomponent.h"
 #include "simulatedvariable.h"
+#include "simulatedequation.h"
 
 
 /**
@@ -49,6 +50,9 @@ void SimulatedMachine::build()
 	{
 		auto simulatedVariable = make_shared<SimulatedVariable>(variableId);
 		this->registerSimulatedComponent(variableId, simulatedVariable);
+
+		this->variablesIndexes[variableId] = this->simulatedVariables.count();
+		this->simulatedVariables.append(simulatedVariable);
 	}
 }
 
@@ -59,29 +63,103 @@ shared_ptr<SimulatedActuatorComponent> SimulatedMachine::getSimulatedActuatorCom
 
 shared_ptr<SimulatedVariable> SimulatedMachine::getSimulatedVariable(componentId_t variableId) const
 {
-	return dynamic_pointer_cast<SimulatedVariable>(this->getSimulatedComponent(variableId));
+	auto it = this->variablesIndexes.constFind(variableId);
+	if (it == this->variablesIndexes.constEnd()) return nullptr;
+
+
+	return this->simulatedVariables.at(it.value());
 }
 
-void SimulatedMachine::reset()
+/**
+ * @brief SimulatedMachine::getSimulatedVariableIndex
+ * @return The dense index of the variable, or -1 if
+ * the variable does not exist.
+ */
+int SimulatedMachine::getSimulatedVariableIndex(componentId_t variableId) const
 {
-	auto machine = machineManager->getMachine();
-	if (machine == nullptr) return;
+	auto it = this->variablesIndexes.constFind(variableId);
+	if (it == this->variablesIndexes.constEnd()) return -1;
 
 
-	// Reset all machine variables
-	auto variablesIds = machine->getInputVariablesIds();
-	variablesIds += machine->getInternalVariablesIds();
-	variablesIds += machine->getOutputVariablesIds();
-	for (auto& variableId : variablesIds)
+	return it.value();
+}
+
+shared_ptr<SimulatedVariable> SimulatedMachine::getSimulatedVariableByIndex(uint variableIndex) const
+{
+	if (variableIndex >= (uint)this->simulatedVariables.count()) return nullptr;
+
+
+	return this->simulatedVariables.at(variableIndex);
+}
+
+/**
+ * @brief SimulatedMachine::registerEquation registers a root
+ * equation, i.e. an equation which value is used outside of
+ * another equation (transition condition, breakpoint, etc.)
+ * Only registered equations are updated when variables change.
+ * The machine does not own the equation: it is dropped
+ * from the list once expired.
+ */
+void SimulatedMachine::registerEquation(shared_ptr<SimulatedEquation> equation)
+{
+	if (equation == nullptr) return;
+
+
+	this->rootEquations.append(equation);
+}
+
+/**
+ * @brief SimulatedMachine::requestValuesPropagation is called
+ * by variables when their value changes. Outside of an update
+ * block, propagation is immediate. Inside an update block,
+ * it is deferred until the block ends.
+ */
+void SimulatedMachine::requestValuesPropagation()
+{
+	this->valuesPropagationPending = true;
+
+	if (this->valuesUpdateDepth == 0)
 	{
-		auto simulatedVariable = this->getSimulatedVariable(variableId);
-		if (simulatedVariable == nullptr) continue;
+		this->propagateValues();
+	}
+}
+
+/**
+ * @brief SimulatedMachine::beginValuesUpdate starts an
+ * update block: variables changes occuring until the matching
+ * endValuesUpdate() are propagated at once. Blocks can be nested.
+ */
+void SimulatedMachine::beginValuesUpdate()
+{
+	this->valuesUpdateDepth++;
+}
+
+void SimulatedMachine::endValuesUpdate()
+{
+	if (this->valuesUpdateDepth == 0) return;
+
 
+	this->valuesUpdateDepth--;
 
+	if ( (this->valuesUpdateDepth == 0) && (this->valuesPropagationPending == true) )
+	{
+		this->propagateValues();
+	}
+}
+
+void SimulatedMachine::reset()
+{
+	this->beginValuesUpdate();
+
+	// Reset all machine variables
+	for (const auto& simulatedVariable : this->simulatedVariables)
+	{
 		simulatedVariable->reinitialize();
 	}
 
 	this->subMachineReset();
+
+	this->endValuesUpdate();
 }
 
 void SimulatedMachine::prepareStep()
@@ -91,12 +169,16 @@ void SimulatedMachine::prepareStep()
 
 void SimulatedMachine::prepareActions()
 {
+	this->beginValuesUpdate();
 	this->subMachinePrepareActions();
+	this->endValuesUpdate();
 }
 
 void SimulatedMachine::doStep()
 {
+	this->beginValuesUpdate();
 	this->subMachineDoStep();
+	this->endValuesUpdate();
 }
 
 void SimulatedMachine::setMemorizedStateActionBehavior(SimulationBehavior_t behv)
@@ -119,6 +201,26 @@ void SimulatedMachine::setPulseTransitionActionBehavior(SimulationBehavior_t beh
 	this->pulseTransitionActionBehavior = behv;
 }
 
+SimulationBehavior_t SimulatedMachine::getMemorizedStateActionBehavior() const
+{
+	return this->memorizedStateActionBehavior;
+}
+
+SimulationBehavior_t SimulatedMachine::getContinuousStateActionBehavior() const
+{
+	return this->continuousStateActionBehavior;
+}
+
+SimulationBehavior_t SimulatedMachine::getMemorizedTransitionActionBehavior() const
+{
+	return this->memorizedTransitionActionBehavior;
+}
+
+SimulationBehavior_t SimulatedMachine::getPulseTransitionActionBehavior() const
+{
+	return this->pulseTransitionActionBehavior;
+}
+
 void SimulatedMachine::registerSimulatedComponent(componentId_t componentId, shared_ptr<SimulatedComponent> component)
 {
 	this->simulatedComponents[componentId] = component;
@@ -133,3 +235,62 @@ shared_ptr<SimulatedComponent> SimulatedMachine::getSimulatedComponent(component
 
 	return this->simulatedComponents[componentId];
 }
+
+/**
+ * @brief SimulatedMachine::propagateValues updates all root
+ * equations from the variables that changed since last
+ * propagation. Each equation updates its operands before
+ * computing its own value, so that each node is computed
+ * once. Change notifications are emitted only when all
+ * values are up to date: listeners can thus not observe
+ * an intermediate state. If a listener changes a variable,
+ * a new propagation pass is performed.
+ */
+void SimulatedMachine::propagateValues()
+{
+	while (this->valuesPropagationPending == true)
+	{
+		this->valuesPropagationPending = false;
+		this->valuesUpdateDepth++;
+
+		QList<shared_ptr<SimulatedEquation>> changedEquations;
+		for (auto it = this->rootEquations.begin() ; it != this->rootEquations.end() ; )
+		{
+			auto equation = it->lock();
+			if (equation == nullptr)
+			{
+				it = this->rootEquations.erase(it);
+				continue;
+			}
+
+			if (equation->updateCurrentValue() == true)
+			{
+				changedEquations.append(equation);
+			}
+
+			it++;
+		}
+
+		QList<shared_ptr<SimulatedVariable>> changedVariables;
+		for (const auto& simulatedVariable : this->simulatedVariables)
+		{
+			if (simulatedVariable->hasPendingValueChange() == true)
+			{
+				simulatedVariable->clearPendingValueChange();
+				changedVariables.append(simulatedVariable);
+			}
+		}
+
+		for (const auto& simulatedVariable : changedVariables)
+		{
+			simulatedVariable->notifyValueChange();
+		}
+
+		for (const auto& equation : changedEquations)
+		{
+			equation->notifyValueChange();
+		}
+
+		this->valuesUpdateDepth--;
+	}
+}
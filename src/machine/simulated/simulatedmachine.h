@@ -31,12 +31,14 @@ using namespace std;
 
 // Qt classes
 #include <QMap>
+#include <QList>
 
 // SateS classes
 #include "statestypes.h"
 class SimulatedComponent;
 class SimulatedActuatorComponent;
 class SimulatedVariable;
+class SimulatedEquation;
 
 
 class SimulatedMachine : public QObject
@@ -56,6 +58,16 @@ public:
 	shared_ptr<SimulatedActuatorComponent> getSimulatedActuatorComponent(componentId_t actuatorId) const;
 	shared_ptr<SimulatedVariable>          getSimulatedVariable         (componentId_t variableId) const;
 
+	// Dense indexes, valid from build() to machine destruction
+	int getSimulatedVariableIndex(componentId_t variableId) const;
+	shared_ptr<SimulatedVariable> getSimulatedVariableByIndex(uint variableIndex) const;
+
+	// Equations values are propagated from variables once per update
+	void registerEquation(shared_ptr<SimulatedEquation> equation);
+	void requestValuesPropagation();
+	void beginValuesUpdate();
+	void endValuesUpdate();
+
 	void reset();
 	void prepareStep();
 	void prepareActions();
@@ -66,11 +78,18 @@ public:
 	void setMemorizedTransitionActionBehavior(SimulationBehavior_t behv);
 	void setPulseTransitionActionBehavior    (SimulationBehavior_t behv);
 
+	SimulationBehavior_t getMemorizedStateActionBehavior()      const;
+	SimulationBehavior_t getContinuousStateActionBehavior()     const;
+	SimulationBehavior_t getMemorizedTransitionActionBehavior() const;
+	SimulationBehavior_t getPulseTransitionActionBehavior()     const;
+
 protected:
 	void registerSimulatedComponent(componentId_t componentId, shared_ptr<SimulatedComponent> component);
 	shared_ptr<SimulatedComponent> getSimulatedComponent(componentId_t componentId) const;
 
 private:
+	void propagateValues();
+
 	virtual void subMachineReset()          = 0;
 	virtual void subMachinePrepareStep()    = 0;
 	virtual void subMachinePrepareActions() = 0;
@@ -94,6 +113,15 @@ protected:
 private:
 	QMap<componentId_t, shared_ptr<SimulatedComponent>> simulatedComponents;
 
+	// Typed storage used while stepping, avoiding lookups and casts
+	QList<shared_ptr<SimulatedVariable>> simulatedVariables;
+	QMap<componentId_t, uint> variablesIndexes;
+
+	// Values propagation
+	QList<weak_ptr<SimulatedEquation>> rootEquations;
+	uint valuesUpdateDepth = 0;
+	bool valuesPropagationPending = false;
+
 };
 
 #endif // SIMULATEDMACHINE_H
@@ -31,6 +31,7 @@ using namespace std;
 // StateS classes
 #include "states.h"
 #include "statesexception.h"
+#include "commandlineexporter.h"
 
 
 // Debug management (inactive for now)
@@ -51,6 +52,13 @@ using namespace std;
 
 int main(int argc, char* argv[])
 {
+	// Export command runs without any window
+	bool isExportCommand = CommandLineExporter::isExportCommand(argc, argv);
+	if ( (isExportCommand == true) && (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM") == true) )
+	{
+		qputenv("QT_QPA_PLATFORM", "offscreen");
+	}
+
 	// Create application
 	QApplication* app = new QApplication(argc, argv);
 
@@ -59,17 +67,25 @@ int main(int argc, char* argv[])
 	unique_ptr<StateS> states;
 	try
 	{
-		if (argc >= 2)
+		if (isExportCommand == true)
 		{
-			states = make_unique<StateS>(app, argv[1]);
+			CommandLineExporter exporter;
+			res = exporter.run(app->arguments());
 		}
 		else
 		{
-			states = make_unique<StateS>(app);
+			if (argc >= 2)
+			{
+				states = make_unique<StateS>(app, argv[1]);
+			}
+			else
+			{
+				states = make_unique<StateS>(app);
+			}
+
+			// Start event loop
+			res = app->exec();
 		}
-
-		// Start event loop
-		res = app->exec();
 	}
 	catch (const StatesException& e)
 	{
@@ -0,0 +1,269 @@
+/*
+ * Copyright © 2014-2025 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with StateS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "codeexportdialog.h"
+
+// Qt classes
+#include <QFormLayout>
+#include <QLabel>
+#include <QComboBox>
+#include <QPushButton>
+#include <QFileDialog>
+
+// StateS classes
+#include "machinemanager.h"
+#include "fsm.h"
+#include "fsmhdlmodel.h"
+
+
+CodeExportDialog::CodeExportDialog(const QString& baseFileName, const QString& searchPath, bool exportTestbench, QWidget* parent) :
+	StatesDialog(parent)
+{
+	this->baseFileName    = baseFileName;
+	this->searchPath      = searchPath;
+	this->exportTestbench = exportTestbench;
+
+	if (exportTestbench == false)
+	{
+		this->setWindowTitle(tr("Code export"));
+	}
+	else
+	{
+		this->setWindowTitle(tr("VHDL testbench export"));
+	}
+
+	QVBoxLayout* layout = new QVBoxLayout(this);
+
+	QLabel* title = new QLabel("<b>" + tr("Choose export options:") + "</b>");
+	title->setAlignment(Qt::AlignCenter);
+	layout->addWidget(title);
+
+	this->formLayout = new QFormLayout();
+	layout->addLayout(this->formLayout);
+
+	// Items order must match getLanguage()
+	this->languageSelectionBox = new QComboBox();
+	this->languageSelectionBox->addItem(tr("VHDL"));
+	this->languageSelectionBox->addItem(tr("SystemVerilog"));
+	this->languageSelectionBox->addItem(tr("C++ (embedded targets)"));
+	connect(this->languageSelectionBox, &QComboBox::currentIndexChanged, this, &CodeExportDialog::languageChangedEventHandler);
+	this->formLayout->addRow(tr("Language:"), this->languageSelectionBox);
+
+	this->resetLogicSelectionBox = new QComboBox();
+	this->resetLogicSelectionBox->addItem(tr("Positive"));
+	this->resetLogicSelectionBox->addItem(tr("Negative"));
+	this->formLayout->addRow(tr("Reset logic:"), this->resetLogicSelectionBox);
+
+	this->addPrefixSelectionBox = new QComboBox();
+	this->addPrefixSelectionBox->addItem(tr("No"));
+	this->addPrefixSelectionBox->addItem(tr("Yes"));
+	this->formLayout->addRow(tr("Prefix inputs and outputs with 'I_' and 'O_' respectively:"), this->addPrefixSelectionBox);
+
+	// Items order must match getStateEncoding()
+	this->stateEncodingSelectionBox = new QComboBox();
+	this->stateEncodingSelectionBox->addItem(tr("Automatic, optimized for timing"));
+	this->stateEncodingSelectionBox->addItem(tr("Automatic, optimized for area"));
+	this->stateEncodingSelectionBox->addItem(tr("Symbolic (chosen by synthesizer)"));
+	this->stateEncodingSelectionBox->addItem(tr("Binary"));
+	this->stateEncodingSelectionBox->addItem(tr("Gray"));
+	this->stateEncodingSelectionBox->addItem(tr("One-hot"));
+	this->stateEncodingSelectionBox->addItem(tr("Johnson"));
+	this->formLayout->addRow(tr("State encoding:"), this->stateEncodingSelectionBox);
+
+	this->mealyOutputsSelectionBox = new QComboBox();
+	this->mealyOutputsSelectionBox->addItem(tr("Combinatorial (prepared before transition is crossed)"));
+	this->mealyOutputsSelectionBox->addItem(tr("Registered (active after transition is crossed)"));
+	this->formLayout->addRow(tr("Pulse actions on transitions:"), this->mealyOutputsSelectionBox);
+
+	// Testbench instantiates the VHDL entity exported with the same reset and prefix options,
+	// while state encoding does not change outputs and Mealy outputs follow the simulator.
+	if (exportTestbench == true)
+	{
+		this->formLayout->setRowVisible(this->languageSelectionBox,      false);
+		this->formLayout->setRowVisible(this->stateEncodingSelectionBox, false);
+		this->formLayout->setRowVisible(this->mealyOutputsSelectionBox,  false);
+	}
+
+	QHBoxLayout* buttonsLayout = new QHBoxLayout();
+	layout->addLayout(buttonsLayout);
+
+	QPushButton* buttonOK = new QPushButton(tr("OK"));
+	connect(buttonOK, &QPushButton::clicked, this, &QDialog::accept);
+	buttonsLayout->addWidget(buttonOK);
+
+	QPushButton* buttonCancel = new QPushButton(tr("Cancel"));
+	connect(buttonCancel, &QPushButton::clicked, this, &QDialog::reject);
+	buttonsLayout->addWidget(buttonCancel);
+}
+
+CodeLanguage_t CodeExportDialog::getLanguage() const
+{
+	if (this->languageSelectionBox->currentIndex() == 1)
+	{
+		return CodeLanguage_t::systemVerilog;
+	}
+	else if (this->languageSelectionBox->currentIndex() == 2)
+	{
+		return CodeLanguage_t::cpp;
+	}
+	else
+	{
+		return CodeLanguage_t::vhdl;
+	}
+}
+
+bool CodeExportDialog::isResetPositive() const
+{
+	if (this->resetLogicSelectionBox->currentIndex() == 0)
+	{
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+}
+
+bool CodeExportDialog::prefixIOs() const
+{
+	if (this->addPrefixSelectionBox->currentIndex() == 0)
+	{
+		return false;
+	}
+	else
+	{
+		return true;
+	}
+}
+
+HdlStateEncoding_t CodeExportDialog::getStateEncoding() const
+{
+	uint statesCount = 0;
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm != nullptr)
+	{
+		statesCount = fsm->getAllStatesIds().count();
+	}
+
+	int index = this->stateEncodingSelectionBox->currentIndex();
+	if (index == 0)
+	{
+		return FsmHdlModel::getRecommendedStateEncoding(statesCount, HdlOptimizationGoal_t::timing);
+	}
+	else if (index == 1)
+	{
+		return FsmHdlModel::getRecommendedStateEncoding(statesCount, HdlOptimizationGoal_t::area);
+	}
+	else if (index == 3)
+	{
+		return HdlStateEncoding_t::binary;
+	}
+	else if (index == 4)
+	{
+		return HdlStateEncoding_t::gray;
+	}
+	else if (index == 5)
+	{
+		return HdlStateEncoding_t::oneHot;
+	}
+	else if (index == 6)
+	{
+		return HdlStateEncoding_t::johnson;
+	}
+	else
+	{
+		return HdlStateEncoding_t::symbolic;
+	}
+}
+
+bool CodeExportDialog::registerMealyOutputs() const
+{
+	if (this->mealyOutputsSelectionBox->currentIndex() == 0)
+	{
+		return false;
+	}
+	else
+	{
+		return true;
+	}
+}
+
+QString CodeExportDialog::getFilePath() const
+{
+	return this->filePath;
+}
+
+void CodeExportDialog::accept()
+{
+	QString defaultFilePath;
+
+	if (this->searchPath.isEmpty() == false)
+	{
+		defaultFilePath += this->searchPath;
+		defaultFilePath += "/"; // TODO: check if environment dependant!
+	}
+
+	defaultFilePath += this->baseFileName;
+
+	QString extension = ".vhdl";
+	if (this->exportTestbench == true)
+	{
+		this->filePath = QFileDialog::getSaveFileName(this, tr("Export VHDL testbench"), defaultFilePath + "_tb" + extension, "*" + extension);
+	}
+	else if (this->getLanguage() == CodeLanguage_t::systemVerilog)
+	{
+		extension = ".sv";
+		this->filePath = QFileDialog::getSaveFileName(this, tr("Export machine to SystemVerilog"), defaultFilePath + extension, "*" + extension);
+	}
+	else if (this->getLanguage() == CodeLanguage_t::cpp)
+	{
+		extension = ".h";
+		this->filePath = QFileDialog::getSaveFileName(this, tr("Export machine to C++"), defaultFilePath + extension, "*" + extension);
+	}
+	else
+	{
+		this->filePath = QFileDialog::getSaveFileName(this, tr("Export machine to VHDL"), defaultFilePath + extension, "*" + extension);
+	}
+
+	if ( (this->filePath.isEmpty() == false) && (! this->filePath.endsWith(extension, Qt::CaseInsensitive)) )
+	{
+		this->filePath += extension;
+	}
+
+	if (this->filePath.isEmpty() == false)
+	{
+		QDialog::accept();
+	}
+}
+
+/**
+ * @brief CodeExportDialog::languageChangedEventHandler hides options
+ * that have no meaning in software: generated C++ has no reset signal
+ * and states are stored as an enumeration.
+ */
+void CodeExportDialog::languageChangedEventHandler()
+{
+	bool isHdl = (this->getLanguage() != CodeLanguage_t::cpp);
+
+	this->formLayout->setRowVisible(this->resetLogicSelectionBox,    isHdl);
+	this->formLayout->setRowVisible(this->stateEncodingSelectionBox, isHdl);
+}
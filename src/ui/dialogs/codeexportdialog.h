@@ -19,31 +19,28 @@
  * along with StateS. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef VHDLEXPORTDIALOG_H
-#define VHDLEXPORTDIALOG_H
+#ifndef CODEEXPORTDIALOG_H
+#define CODEEXPORTDIALOG_H
 
 // Parent
 #include "statesdialog.h"
 
-// C++ classes
-#include <memory>
-using namespace std;
-
 // Qt classes
 class QComboBox;
+class QFormLayout;
 
 // StateS classes
-class FsmVhdlExport;
+#include "statestypes.h"
 
 
-class VhdlExportDialog : public StatesDialog
+class CodeExportDialog : public StatesDialog
 {
 	Q_OBJECT
 
 	/////
 	// Constructors/destructors
 public:
-	explicit VhdlExportDialog(const QString& baseFileName, const QString& searchPath, shared_ptr<FsmVhdlExport> fsmVhdlExport, QWidget* parent = nullptr);
+	explicit CodeExportDialog(const QString& baseFileName, const QString& searchPath, bool exportTestbench, QWidget* parent = nullptr);
 
 	/////
 	// Object functions
@@ -51,24 +48,32 @@ public slots:
 	virtual void accept() override;
 
 public:
+	CodeLanguage_t getLanguage() const;
 	bool isResetPositive() const;
 	bool prefixIOs() const;
+	HdlStateEncoding_t getStateEncoding() const;
+	bool registerMealyOutputs() const;
 	QString getFilePath() const;
 
-	shared_ptr<FsmVhdlExport> getFsmVhdlExport() const;
+private slots:
+	void languageChangedEventHandler();
 
 	/////
 	// Object variables
 private:
+	QFormLayout* formLayout = nullptr;
+
+	QComboBox* languageSelectionBox   = nullptr;
 	QComboBox* resetLogicSelectionBox = nullptr;
 	QComboBox* addPrefixSelectionBox  = nullptr;
+	QComboBox* stateEncodingSelectionBox = nullptr;
+	QComboBox* mealyOutputsSelectionBox  = nullptr;
 
 	QString baseFileName;
 	QString searchPath;
 	QString filePath;
-
-	shared_ptr<FsmVhdlExport> fsmVhdlExport;
+	bool exportTestbench = false;
 
 };
 
-#endif // VHDLEXPORTDIALOG_H
+#endif // CODEEXPORTDIALOG_H
@@ -28,8 +28,11 @@
 #include <QPushButton>
 #include <QComboBox>
 #include <QFileDialog>
+#include <QTimer>
+#include <QThread>
 
 // StateS classes
+#include "machinemanager.h"
 #include "checkboxhtml.h"
 #include "machineimageexporter.h"
 
@@ -42,10 +45,18 @@ ImageExportDialog::ImageExportDialog(const QString& baseFileName, shared_ptr<Mac
 
 	this->previewManager = imageExporter;
 
-	this->previewPixmap = this->previewManager->renderPreview(QSizeF(200, 200));
+	this->previewTimer = make_shared<QTimer>();
+	this->previewTimer->setSingleShot(true);
+	this->previewTimer->setInterval(ImageExportDialog::previewDebounceDelay);
+	connect(this->previewTimer.get(), &QTimer::timeout, this, &ImageExportDialog::previewTimerEventHandler);
+
+	// Simulation can go on while dialog is open
+	connect(machineManager.get(), &MachineManager::machineUpdatedEvent,            this, &ImageExportDialog::sceneChangedEventHandler);
+	connect(machineManager.get(), &MachineManager::simulationModeChangedEvent,     this, &ImageExportDialog::sceneChangedEventHandler);
+	connect(machineManager.get(), &MachineManager::simulatedDisplayRefreshedEvent, this, &ImageExportDialog::sceneChangedEventHandler);
+
 	this->previewWidget = new QLabel();
 	this->previewWidget->setMinimumSize(200, 200);
-	this->previewWidget->setPixmap(*this->previewPixmap.get());
 
 	this->setWindowTitle(tr("Image export"));
 
@@ -62,6 +73,14 @@ ImageExportDialog::ImageExportDialog(const QString& baseFileName, shared_ptr<Mac
 	this->imageFormatSelectionBox->addItem("Png");
 	this->imageFormatSelectionBox->addItem("Jpeg");
 	formLayout->addRow(tr("Image format"), this->imageFormatSelectionBox);
+
+	this->bitmapScaleSelectionBox = new QComboBox();
+	for (int scale : {1, 2, 4, 8})
+	{
+		this->bitmapScaleSelectionBox->addItem("×" + QString::number(scale), scale);
+	}
+	connect(this->bitmapScaleSelectionBox, &QComboBox::currentIndexChanged, this, &ImageExportDialog::bitmapScaleSelectionChanged);
+	formLayout->addRow(tr("Png and Jpeg resolution"), this->bitmapScaleSelectionBox);
 	layout->addLayout(formLayout);
 
 	this->includeComponentCheckBox = new CheckBoxHtml(tr("Include component external view"));
@@ -114,6 +133,15 @@ ImageExportDialog::ImageExportDialog(const QString& baseFileName, shared_ptr<Mac
 	buttonsLayout->addWidget(buttonCancel);
 }
 
+ImageExportDialog::~ImageExportDialog()
+{
+	// Worker uses dialog members
+	if (this->previewWorker != nullptr)
+	{
+		this->previewWorker->wait();
+	}
+}
+
 ImageFormat_t ImageExportDialog::getImageFormat() const
 {
 	if (this->imageFormatSelectionBox->currentText() == "Pdf")
@@ -243,8 +271,62 @@ void ImageExportDialog::ratioSliderValueChanged(int i)
 	this->updatePreview();
 }
 
+void ImageExportDialog::bitmapScaleSelectionChanged(int index)
+{
+	this->previewManager->setBitmapScale(this->bitmapScaleSelectionBox->itemData(index).toInt());
+}
+
+/**
+ * @brief ImageExportDialog::sceneChangedEventHandler discards
+ * the recorded panels, which no longer match the scene.
+ */
+void ImageExportDialog::sceneChangedEventHandler()
+{
+	this->previewManager->clearPreviewCache();
+	this->updatePreview();
+}
+
+/**
+ * @brief ImageExportDialog::updatePreview requests a new preview.
+ * Successive calls restart the delay, so that a single preview
+ * is rendered at the end of a resize.
+ */
 void ImageExportDialog::updatePreview()
 {
-	this->previewPixmap = this->previewManager->renderPreview(QSizeF(this->previewWidget->width(), this->previewWidget->height()));
-	this->previewWidget->setPixmap(*this->previewPixmap.get());
+	this->previewTimer->start();
+}
+
+void ImageExportDialog::previewTimerEventHandler()
+{
+	// Only one preview is rendered at a time: the last request is served when done
+	if ( (this->previewWorker != nullptr) && (this->previewWorker->isFinished() == false) )
+	{
+		this->previewRequested = true;
+		return;
+	}
+
+
+	this->previewRequested = false;
+
+	// Layout is computed here, only rasterization is done by the worker
+	auto preview = this->previewManager->preparePreview(QSizeF(this->previewWidget->width(), this->previewWidget->height()));
+
+	this->previewWorker.reset(QThread::create([this, preview]() { this->previewImage = MachineImageExporter::renderPreview(preview); }));
+	connect(this->previewWorker.get(), &QThread::finished, this, &ImageExportDialog::previewRenderedEventHandler);
+	this->previewWorker->start();
+}
+
+void ImageExportDialog::previewRenderedEventHandler()
+{
+	if (this->previewWorker == nullptr) return;
+
+	if (this->previewWorker->isFinished() == false) return;
+
+
+	this->previewWidget->setPixmap(QPixmap::fromImage(this->previewImage));
+
+	if (this->previewRequested == true)
+	{
+		this->previewTimerEventHandler();
+	}
 }
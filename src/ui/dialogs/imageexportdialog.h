@@ -30,9 +30,12 @@
 using namespace std;
 
 // Qt classes
+#include <QImage>
 class QComboBox;
 class QLabel;
 class QSlider;
+class QTimer;
+class QThread;
 
 // StateS classes
 #include "statestypes.h"
@@ -40,14 +43,28 @@ class MachineImageExporter;
 class CheckBoxHtml;
 
 
+/**
+ * @brief The ImageExportDialog class configures image export.
+ *
+ * The preview is rendered in a worker thread from panels recorded
+ * once by the exporter. Requests are debounced: a preview is only
+ * rendered once options or size did not change for a short delay.
+ */
 class ImageExportDialog : public StatesDialog
 {
 	Q_OBJECT
 
+	/////
+	// Static variables
+private:
+	// Delay between last change and preview rendering (ms)
+	static const int previewDebounceDelay = 50;
+
 	/////
 	// Constructors/destructors
 public:
 	explicit ImageExportDialog(const QString& baseFileName, shared_ptr<MachineImageExporter> imageExporter, const QString& searchPath, QWidget* parent = nullptr);
+	~ImageExportDialog();
 
 	/////
 	// Object functions
@@ -70,6 +87,10 @@ private slots:
 	void infoToTheRightCheckBoxChanged(bool b);
 	void addBorderCheckBoxChanged(bool b);
 	void ratioSliderValueChanged(int i);
+	void bitmapScaleSelectionChanged(int index);
+	void previewTimerEventHandler();
+	void previewRenderedEventHandler();
+	void sceneChangedEventHandler();
 
 private:
 	void updatePreview();
@@ -78,6 +99,7 @@ private:
 	// Object variables
 private:
 	QComboBox*    imageFormatSelectionBox  = nullptr;
+	QComboBox*    bitmapScaleSelectionBox  = nullptr;
 	CheckBoxHtml* includeComponentCheckBox = nullptr;
 	CheckBoxHtml* includeConstantsCheckBox = nullptr;
 	CheckBoxHtml* includeVariablesCheckBox = nullptr;
@@ -87,7 +109,12 @@ private:
 	QLabel*       previewWidget            = nullptr;
 
 	shared_ptr<MachineImageExporter> previewManager;
-	shared_ptr<QPixmap> previewPixmap;
+
+	// Preview rendering
+	shared_ptr<QTimer>  previewTimer;
+	unique_ptr<QThread> previewWorker;
+	QImage previewImage; // Written by worker
+	bool previewRequested = false;
 
 	QString baseFileName;
 	QString searchPath;
@@ -0,0 +1,421 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "multiinstancesimulationdialog.h"
+
+// Qt classes
+#include <QVBoxLayout>
+#include <QFormLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QComboBox>
+#include <QTableWidget>
+#include <QHeaderView>
+#include <QListWidget>
+#include <QPushButton>
+#include <QProgressBar>
+#include <QTimer>
+
+// StateS classes
+#include "machinemanager.h"
+#include "fsm.h"
+#include "simulatedfsm.h"
+#include "multiinstancesimulator.h"
+#include "contextmenu.h"
+
+
+MultiInstanceSimulationDialog::MultiInstanceSimulationDialog(QWidget* parent) :
+	StatesDialog(parent)
+{
+	this->setWindowTitle(tr("Multi-instance simulation"));
+
+	this->simulator = make_shared<MultiInstanceSimulator>();
+	connect(this->simulator.get(), &MultiInstanceSimulator::runFinishedEvent, this, &MultiInstanceSimulationDialog::runFinishedEventHandler);
+
+	auto layout = new QVBoxLayout(this);
+
+	auto title = new QLabel("<b>" + tr("Simulation of several machines together") + "</b>");
+	title->setAlignment(Qt::AlignCenter);
+	layout->addWidget(title);
+
+	auto hint = new QLabel(tr("Instances are copies of the machine loaded when they are added.") + " " +
+	                       tr("This window can be kept open while loading another machine to simulate different machines together."));
+	hint->setWordWrap(true);
+	layout->addWidget(hint);
+
+	// Instances
+	this->instancesTable = new QTableWidget(0, 7);
+	this->instancesTable->setHorizontalHeaderLabels({tr("Instance"), tr("Machine"), tr("Steps per run"), tr("Steps done"), tr("Conflicts"), tr("Active state"), tr("Outputs")});
+	this->instancesTable->horizontalHeader()->setStretchLastSection(true);
+	this->instancesTable->verticalHeader()->hide();
+	this->instancesTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+	layout->addWidget(this->instancesTable);
+
+	auto instancesButtonsLayout = new QHBoxLayout();
+	layout->addLayout(instancesButtonsLayout);
+
+	this->buttonAddInstance = new QPushButton(tr("Add instance of current machine"));
+	connect(this->buttonAddInstance, &QPushButton::clicked, this, &MultiInstanceSimulationDialog::buttonAddInstanceClicked);
+	instancesButtonsLayout->addWidget(this->buttonAddInstance);
+
+	this->buttonRemoveInstance = new QPushButton(tr("Remove"));
+	connect(this->buttonRemoveInstance, &QPushButton::clicked, this, &MultiInstanceSimulationDialog::buttonRemoveInstanceClicked);
+	instancesButtonsLayout->addWidget(this->buttonRemoveInstance);
+
+	// Wires
+	layout->addWidget(new QLabel(tr("Outputs driving inputs:")));
+
+	auto wireEditorLayout = new QHBoxLayout();
+	layout->addLayout(wireEditorLayout);
+
+	this->sourceSelector = new QComboBox();
+	wireEditorLayout->addWidget(this->sourceSelector);
+
+	wireEditorLayout->addWidget(new QLabel("→"));
+
+	this->targetSelector = new QComboBox();
+	wireEditorLayout->addWidget(this->targetSelector);
+
+	this->buttonAddWire = new QPushButton(tr("Connect"));
+	connect(this->buttonAddWire, &QPushButton::clicked, this, &MultiInstanceSimulationDialog::buttonAddWireClicked);
+	wireEditorLayout->addWidget(this->buttonAddWire);
+
+	this->wiresList = new QListWidget();
+	layout->addWidget(this->wiresList);
+
+	this->buttonRemoveWire = new QPushButton(tr("Remove"));
+	connect(this->buttonRemoveWire, &QPushButton::clicked, this, &MultiInstanceSimulationDialog::buttonRemoveWireClicked);
+	layout->addWidget(this->buttonRemoveWire);
+
+	// Run configuration
+	auto formLayout = new QFormLayout();
+	layout->addLayout(formLayout);
+
+	this->modeSelector = new QComboBox();
+	this->modeSelector->addItem(tr("Lockstep: all instances do one step per cycle"));
+	this->modeSelector->addItem(tr("Independent: each instance does its own number of steps"));
+	formLayout->addRow(tr("Stepping:"), this->modeSelector);
+
+	this->cyclesValue = new QLineEdit("1000");
+	formLayout->addRow(tr("Cycles (lockstep):"), this->cyclesValue);
+
+	// Run
+	auto runButtonsLayout = new QHBoxLayout();
+	layout->addLayout(runButtonsLayout);
+
+	this->buttonRun = new QPushButton(tr("Run"));
+	connect(this->buttonRun, &QPushButton::clicked, this, &MultiInstanceSimulationDialog::buttonRunClicked);
+	runButtonsLayout->addWidget(this->buttonRun);
+
+	this->buttonReset = new QPushButton(tr("Reset"));
+	connect(this->buttonReset, &QPushButton::clicked, this, &MultiInstanceSimulationDialog::buttonResetClicked);
+	runButtonsLayout->addWidget(this->buttonReset);
+
+	this->progressBar = new QProgressBar();
+	layout->addWidget(this->progressBar);
+
+	this->summaryLabel = new QLabel();
+	this->summaryLabel->setWordWrap(true);
+	layout->addWidget(this->summaryLabel);
+
+	auto buttonClose = new QPushButton(tr("Close"));
+	connect(buttonClose, &QPushButton::clicked, this, &QDialog::reject);
+	layout->addWidget(buttonClose);
+
+	this->progressTimer = make_shared<QTimer>();
+	this->progressTimer->setInterval(MultiInstanceSimulationDialog::progressRefreshPeriod);
+	connect(this->progressTimer.get(), &QTimer::timeout, this, &MultiInstanceSimulationDialog::progressTimerEventHandler);
+}
+
+MultiInstanceSimulationDialog::~MultiInstanceSimulationDialog()
+{
+	this->stopRun();
+}
+
+void MultiInstanceSimulationDialog::reject()
+{
+	this->stopRun();
+
+	StatesDialog::reject();
+}
+
+void MultiInstanceSimulationDialog::buttonAddInstanceClicked()
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	// Use simulation actions behaviors if simulating
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(machineManager->getSimulatedMachine());
+
+	QString name = fsm->getName() + " #" + QString::number(this->simulator->getInstancesCount() + 1);
+	if (this->simulator->addInstance(name, fsm, simulatedFsm) == false)
+	{
+		ContextMenu* menu = ContextMenu::createErrorMenu(tr("Machine not supported (variables larger than 64 bits)"));
+		menu->popup(this->buttonAddInstance->mapToGlobal(QPoint(this->buttonAddInstance->width(), -menu->sizeHint().height())));
+		return;
+	}
+
+
+	this->displayInstances();
+	this->displayWires();
+}
+
+void MultiInstanceSimulationDialog::buttonRemoveInstanceClicked()
+{
+	int rank = this->instancesTable->currentRow();
+	if (rank < 0) return;
+
+
+	this->simulator->removeInstance(rank);
+
+	this->displayInstances();
+	this->displayWires();
+}
+
+void MultiInstanceSimulationDialog::buttonAddWireClicked()
+{
+	int sourceRank = this->sourceSelector->currentIndex();
+	int targetRank = this->targetSelector->currentIndex();
+	if ( (sourceRank < 0) || (targetRank < 0) ) return;
+
+
+	MultiInstanceSimulator::Wire_t wire;
+	wire.sourceInstance = this->sourcePorts.at(sourceRank).first;
+	wire.sourceOutput   = this->sourcePorts.at(sourceRank).second;
+	wire.targetInstance = this->targetPorts.at(targetRank).first;
+	wire.targetInput    = this->targetPorts.at(targetRank).second;
+
+	if (this->simulator->addWire(wire) == false)
+	{
+		ContextMenu* menu = ContextMenu::createErrorMenu(tr("Sizes differ or input is already driven"));
+		menu->popup(this->buttonAddWire->mapToGlobal(QPoint(this->buttonAddWire->width(), -menu->sizeHint().height())));
+		return;
+	}
+
+
+	this->displayInstances();
+	this->displayWires();
+}
+
+void MultiInstanceSimulationDialog::buttonRemoveWireClicked()
+{
+	int rank = this->wiresList->currentRow();
+	if (rank < 0) return;
+
+
+	this->simulator->removeWire(rank);
+
+	this->displayWires();
+}
+
+void MultiInstanceSimulationDialog::buttonRunClicked()
+{
+	if (this->running == true)
+	{
+		this->simulator->requestStop();
+		return;
+	}
+
+	if (this->simulator->getInstancesCount() == 0) return;
+
+
+	// Steps per run are edited in the instances table
+	for (uint i = 0 ; i < this->simulator->getInstancesCount() ; i++)
+	{
+		auto item = this->instancesTable->item(i, 2);
+		if (item == nullptr) continue;
+
+
+		bool ok;
+		quint64 steps = item->text().toULongLong(&ok);
+		if (ok == true)
+		{
+			this->simulator->setInstanceStepsPerRun(i, steps);
+		}
+	}
+
+	MultiInstanceSimulator::Settings_t settings;
+	if (this->modeSelector->currentIndex() == 0)
+	{
+		settings.mode = MultiInstanceSimulator::SteppingMode_t::lockstep;
+	}
+	else
+	{
+		settings.mode = MultiInstanceSimulator::SteppingMode_t::independent;
+	}
+	settings.cycles = qMax(this->cyclesValue->text().toULongLong(), (quint64)1);
+
+	this->running = true;
+	this->setConfigurationEnabled(false);
+	this->summaryLabel->clear();
+	this->buttonRun->setText(tr("Stop"));
+
+	this->simulator->start(settings);
+
+	this->progressBar->setRange(0, 1000);
+	this->progressBar->setValue(0);
+	this->progressTimer->start();
+}
+
+void MultiInstanceSimulationDialog::buttonResetClicked()
+{
+	this->simulator->reset();
+
+	this->summaryLabel->clear();
+	this->progressBar->setValue(0);
+	this->displayInstances();
+}
+
+void MultiInstanceSimulationDialog::progressTimerEventHandler()
+{
+	quint64 totalSteps = this->simulator->getTotalSteps();
+	if (totalSteps == 0) return;
+
+
+	this->progressBar->setValue((int)((this->simulator->getCompletedSteps() * 1000) / totalSteps));
+}
+
+void MultiInstanceSimulationDialog::runFinishedEventHandler()
+{
+	if (this->running == false) return;
+
+
+	this->simulator->wait();
+	this->progressTimer->stop();
+	this->progressTimerEventHandler();
+
+	this->running = false;
+	this->setConfigurationEnabled(true);
+	this->buttonRun->setText(tr("Run"));
+
+	this->summaryLabel->setText(QString::number(this->simulator->getCompletedSteps()) + " " + tr("steps simulated."));
+	this->displayInstances();
+}
+
+void MultiInstanceSimulationDialog::stopRun()
+{
+	if (this->running == false) return;
+
+
+	this->simulator->requestStop();
+	this->simulator->wait();
+	this->progressTimer->stop();
+
+	this->running = false;
+	this->setConfigurationEnabled(true);
+	this->buttonRun->setText(tr("Run"));
+}
+
+void MultiInstanceSimulationDialog::setConfigurationEnabled(bool enabled)
+{
+	this->instancesTable->setEnabled(enabled);
+	this->buttonAddInstance->setEnabled(enabled);
+	this->buttonRemoveInstance->setEnabled(enabled);
+	this->sourceSelector->setEnabled(enabled);
+	this->targetSelector->setEnabled(enabled);
+	this->buttonAddWire->setEnabled(enabled);
+	this->wiresList->setEnabled(enabled);
+	this->buttonRemoveWire->setEnabled(enabled);
+	this->modeSelector->setEnabled(enabled);
+	this->cyclesValue->setEnabled(enabled);
+	this->buttonReset->setEnabled(enabled);
+}
+
+void MultiInstanceSimulationDialog::displayInstances()
+{
+	this->instancesTable->setRowCount(0);
+	for (uint i = 0 ; i < this->simulator->getInstancesCount() ; i++)
+	{
+		const auto& instance = this->simulator->getInstance(i);
+
+		QString stateName;
+		int activeState = instance.engine.getActiveState();
+		if (activeState >= 0)
+		{
+			stateName = instance.statesNames.at(activeState);
+		}
+
+		QString outputsText;
+		for (const auto& output : instance.outputs)
+		{
+			if (outputsText.isEmpty() == false)
+			{
+				outputsText += ", ";
+			}
+			outputsText += output.name + " = " + FsmSimulationEngine::unpackValue(instance.engine.getVariableValue(output.variable), output.size).toString();
+		}
+
+		auto nameItem = new QTableWidgetItem(instance.name);
+		nameItem->setFlags(Qt::ItemIsEnabled | Qt::ItemIsSelectable);
+		auto machineItem = new QTableWidgetItem(instance.machineName);
+		machineItem->setFlags(Qt::ItemIsEnabled | Qt::ItemIsSelectable);
+
+		this->instancesTable->insertRow(i);
+		this->instancesTable->setItem(i, 0, nameItem);
+		this->instancesTable->setItem(i, 1, machineItem);
+		this->instancesTable->setItem(i, 2, new QTableWidgetItem(QString::number(instance.stepsPerRun)));
+
+		QList<QString> resultsTexts = {QString::number(instance.steps), QString::number(instance.conflicts), stateName, outputsText};
+		for (int j = 0 ; j < resultsTexts.count() ; j++)
+		{
+			auto resultItem = new QTableWidgetItem(resultsTexts.at(j));
+			resultItem->setFlags(Qt::ItemIsEnabled | Qt::ItemIsSelectable);
+			this->instancesTable->setItem(i, 3 + j, resultItem);
+		}
+	}
+}
+
+void MultiInstanceSimulationDialog::displayWires()
+{
+	this->sourceSelector->clear();
+	this->targetSelector->clear();
+	this->sourcePorts.clear();
+	this->targetPorts.clear();
+
+	for (uint i = 0 ; i < this->simulator->getInstancesCount() ; i++)
+	{
+		const auto& instance = this->simulator->getInstance(i);
+
+		for (uint j = 0 ; j < (uint)instance.outputs.count() ; j++)
+		{
+			this->sourceSelector->addItem(instance.name + "." + instance.outputs.at(j).name);
+			this->sourcePorts.append(QPair<uint, uint>(i, j));
+		}
+
+		for (uint j = 0 ; j < (uint)instance.inputs.count() ; j++)
+		{
+			this->targetSelector->addItem(instance.name + "." + instance.inputs.at(j).name);
+			this->targetPorts.append(QPair<uint, uint>(i, j));
+		}
+	}
+
+	this->wiresList->clear();
+	for (const auto& wire : this->simulator->getWires())
+	{
+		const auto& source = this->simulator->getInstance(wire.sourceInstance);
+		const auto& target = this->simulator->getInstance(wire.targetInstance);
+
+		this->wiresList->addItem(source.name + "." + source.outputs.at(wire.sourceOutput).name + " → " +
+		                         target.name + "." + target.inputs.at(wire.targetInput).name);
+	}
+}
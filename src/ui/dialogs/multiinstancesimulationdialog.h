@@ -0,0 +1,122 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MULTIINSTANCESIMULATIONDIALOG_H
+#define MULTIINSTANCESIMULATIONDIALOG_H
+
+// Parent
+#include "statesdialog.h"
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+#include <QList>
+#include <QPair>
+class QTableWidget;
+class QListWidget;
+class QComboBox;
+class QLineEdit;
+class QPushButton;
+class QProgressBar;
+class QLabel;
+class QTimer;
+
+// StateS classes
+class MultiInstanceSimulator;
+
+
+/**
+ * @brief The MultiInstanceSimulationDialog class simulates
+ * several instances of machines together, with outputs of
+ * instances wired to inputs of other instances.
+ *
+ * The dialog is not modal: it can be kept open while another
+ * machine is loaded, in order to add instances of it.
+ */
+class MultiInstanceSimulationDialog : public StatesDialog
+{
+	Q_OBJECT
+
+	/////
+	// Static variables
+private:
+	// Progress display refresh period (ms)
+	static const int progressRefreshPeriod = 100;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit MultiInstanceSimulationDialog(QWidget* parent = nullptr);
+	~MultiInstanceSimulationDialog();
+
+	/////
+	// Object functions
+public slots:
+	virtual void reject() override;
+
+private slots:
+	void buttonAddInstanceClicked();
+	void buttonRemoveInstanceClicked();
+	void buttonAddWireClicked();
+	void buttonRemoveWireClicked();
+	void buttonRunClicked();
+	void buttonResetClicked();
+	void progressTimerEventHandler();
+	void runFinishedEventHandler();
+
+private:
+	void stopRun();
+	void setConfigurationEnabled(bool enabled);
+	void displayInstances();
+	void displayWires();
+
+	/////
+	// Object variables
+private:
+	QTableWidget* instancesTable       = nullptr;
+	QPushButton*  buttonAddInstance    = nullptr;
+	QPushButton*  buttonRemoveInstance = nullptr;
+	QComboBox*    sourceSelector       = nullptr;
+	QComboBox*    targetSelector       = nullptr;
+	QPushButton*  buttonAddWire        = nullptr;
+	QListWidget*  wiresList            = nullptr;
+	QPushButton*  buttonRemoveWire     = nullptr;
+	QComboBox*    modeSelector         = nullptr;
+	QLineEdit*    cyclesValue          = nullptr;
+	QPushButton*  buttonRun            = nullptr;
+	QPushButton*  buttonReset          = nullptr;
+	QProgressBar* progressBar          = nullptr;
+	QLabel*       summaryLabel         = nullptr;
+
+	// (instance, port) pairs matching selectors entries
+	QList<QPair<uint, uint>> sourcePorts;
+	QList<QPair<uint, uint>> targetPorts;
+
+	shared_ptr<MultiInstanceSimulator> simulator;
+	shared_ptr<QTimer> progressTimer;
+
+	bool running = false;
+
+};
+
+#endif // MULTIINSTANCESIMULATIONDIALOG_H
@@ -0,0 +1,474 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "randomregressiondialog.h"
+
+// Qt classes
+#include <QVBoxLayout>
+#include <QFormLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QCheckBox>
+#include <QTableWidget>
+#include <QHeaderView>
+#include <QListWidget>
+#include <QPushButton>
+#include <QProgressBar>
+#include <QSpinBox>
+#include <QTimer>
+#include <QFileDialog>
+#include <QThread>
+
+// StateS classes
+#include "machinemanager.h"
+#include "fsm.h"
+#include "variable.h"
+#include "simulatedfsm.h"
+#include "equation.h"
+#include "equationeditordialog.h"
+#include "fsmstimulusgenerator.h"
+#include "randomregressionrunner.h"
+#include "machinesimulator.h"
+#include "contextmenu.h"
+
+
+RandomRegressionDialog::RandomRegressionDialog(QWidget* parent) :
+	StatesDialog(parent)
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	this->setWindowTitle(tr("Random regression"));
+
+	auto layout = new QVBoxLayout(this);
+
+	auto title = new QLabel("<b>" + tr("Random simulation of the machine on many seeds") + "</b>");
+	title->setAlignment(Qt::AlignCenter);
+	layout->addWidget(title);
+
+	auto formLayout = new QFormLayout();
+	layout->addLayout(formLayout);
+
+	this->firstSeedValue = new QLineEdit("1");
+	formLayout->addRow(tr("First seed:"), this->firstSeedValue);
+
+	this->seedsCountValue = new QLineEdit("64");
+	formLayout->addRow(tr("Number of seeds:"), this->seedsCountValue);
+
+	this->stepsPerSeedValue = new QLineEdit("10000");
+	formLayout->addRow(tr("Steps per seed:"), this->stepsPerSeedValue);
+
+	this->nativeConditions = new QCheckBox(tr("Compile transitions conditions to native code"));
+	this->nativeConditions->setToolTip(tr("Requires a C++ compiler, given by the CXX environment variable or c++ by default. Conditions are interpreted if compilation fails."));
+	formLayout->addRow(this->nativeConditions);
+
+	// Terms are interpreted: disable by default when conditions are native
+	this->termsCoverage = new QCheckBox(tr("Record conditions terms coverage"));
+	this->termsCoverage->setChecked(true);
+	connect(this->nativeConditions, &QCheckBox::toggled, this->termsCoverage, [this](bool checked) { this->termsCoverage->setChecked(!checked); });
+	formLayout->addRow(this->termsCoverage);
+
+	// Inputs weights
+	layout->addWidget(new QLabel(tr("Probability for each input bit to be 1:")));
+
+	this->inputsIds = fsm->getInputVariablesIds();
+	this->weightsTable = new QTableWidget(this->inputsIds.count(), 2);
+	this->weightsTable->setHorizontalHeaderLabels({tr("Input"), tr("Probability")});
+	this->weightsTable->horizontalHeader()->setStretchLastSection(true);
+	this->weightsTable->verticalHeader()->hide();
+	for (int i = 0 ; i < this->inputsIds.count() ; i++)
+	{
+		auto input = fsm->getVariable(this->inputsIds.at(i));
+		if (input == nullptr) continue;
+
+
+		auto nameItem = new QTableWidgetItem(input->getName());
+		nameItem->setFlags(Qt::ItemIsEnabled);
+		this->weightsTable->setItem(i, 0, nameItem);
+
+		auto weightEditor = new QSpinBox();
+		weightEditor->setRange(0, 100);
+		weightEditor->setSuffix(" %");
+		weightEditor->setValue(FsmStimulusGenerator::defaultWeight);
+		this->weightsTable->setCellWidget(i, 1, weightEditor);
+	}
+	layout->addWidget(this->weightsTable);
+
+	// Constraints
+	layout->addWidget(new QLabel(tr("Constraints that generated inputs must meet:")));
+
+	this->constraintsList = new QListWidget();
+	layout->addWidget(this->constraintsList);
+
+	auto constraintsButtonsLayout = new QHBoxLayout();
+	layout->addLayout(constraintsButtonsLayout);
+
+	auto buttonAddConstraint = new QPushButton(tr("Add constraint…"));
+	connect(buttonAddConstraint, &QPushButton::clicked, this, &RandomRegressionDialog::buttonAddConstraintClicked);
+	constraintsButtonsLayout->addWidget(buttonAddConstraint);
+
+	auto buttonRemoveConstraint = new QPushButton(tr("Remove"));
+	connect(buttonRemoveConstraint, &QPushButton::clicked, this, &RandomRegressionDialog::buttonRemoveConstraintClicked);
+	constraintsButtonsLayout->addWidget(buttonRemoveConstraint);
+
+	// Run
+	this->buttonRun = new QPushButton(tr("Run"));
+	connect(this->buttonRun, &QPushButton::clicked, this, &RandomRegressionDialog::buttonRunClicked);
+	layout->addWidget(this->buttonRun);
+
+	this->progressBar = new QProgressBar();
+	layout->addWidget(this->progressBar);
+
+	this->summaryLabel = new QLabel();
+	this->summaryLabel->setWordWrap(true);
+	layout->addWidget(this->summaryLabel);
+
+	this->resultsTable = new QTableWidget(0, 7);
+	this->resultsTable->setHorizontalHeaderLabels({tr("Seed"), tr("Steps"), tr("States covered"), tr("Transitions covered"), tr("Terms covered"), tr("Conflicts"), tr("Unmet constraints")});
+	this->resultsTable->verticalHeader()->hide();
+	this->resultsTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+	layout->addWidget(this->resultsTable);
+
+	auto coverageButtonsLayout = new QHBoxLayout();
+	layout->addLayout(coverageButtonsLayout);
+
+	this->buttonExportCoverage = new QPushButton(tr("Export coverage…"));
+	this->buttonExportCoverage->setEnabled(false);
+	connect(this->buttonExportCoverage, &QPushButton::clicked, this, &RandomRegressionDialog::buttonExportCoverageClicked);
+	coverageButtonsLayout->addWidget(this->buttonExportCoverage);
+
+	this->buttonMergeCoverage = new QPushButton(tr("Add to simulator coverage"));
+	this->buttonMergeCoverage->setToolTip(tr("Only available while simulating"));
+	this->buttonMergeCoverage->setEnabled(false);
+	connect(this->buttonMergeCoverage, &QPushButton::clicked, this, &RandomRegressionDialog::buttonMergeCoverageClicked);
+	coverageButtonsLayout->addWidget(this->buttonMergeCoverage);
+
+	auto buttonClose = new QPushButton(tr("Close"));
+	connect(buttonClose, &QPushButton::clicked, this, &QDialog::reject);
+	layout->addWidget(buttonClose);
+
+	this->progressTimer = make_shared<QTimer>();
+	this->progressTimer->setInterval(RandomRegressionDialog::progressRefreshPeriod);
+	connect(this->progressTimer.get(), &QTimer::timeout, this, &RandomRegressionDialog::progressTimerEventHandler);
+}
+
+RandomRegressionDialog::~RandomRegressionDialog()
+{
+	this->stopRun();
+}
+
+void RandomRegressionDialog::reject()
+{
+	this->stopRun();
+
+	StatesDialog::reject();
+}
+
+void RandomRegressionDialog::buttonAddConstraintClicked()
+{
+	if (this->equationEditor != nullptr) return;
+
+
+	this->equationEditor = new EquationEditorDialog(nullptr, this);
+	connect(this->equationEditor, &EquationEditorDialog::finished, this, &RandomRegressionDialog::equationEditorClosedEventHandler);
+
+	this->equationEditor->open();
+}
+
+void RandomRegressionDialog::buttonRemoveConstraintClicked()
+{
+	int rank = this->constraintsList->currentRow();
+	if (rank < 0) return;
+
+
+	this->constraints.removeAt(rank);
+	delete this->constraintsList->takeItem(rank);
+}
+
+void RandomRegressionDialog::equationEditorClosedEventHandler(int result)
+{
+	if (this->equationEditor == nullptr) return;
+
+
+	if (result == QDialog::DialogCode::Accepted)
+	{
+		auto constraint = this->equationEditor->getResultEquation();
+		if (constraint != nullptr)
+		{
+			this->constraints.append(constraint);
+			this->constraintsList->addItem(constraint->getText());
+		}
+	}
+
+	this->equationEditor->deleteLater();
+	this->equationEditor = nullptr;
+}
+
+void RandomRegressionDialog::buttonRunClicked()
+{
+	if (this->compilationWorker != nullptr) return;
+
+	if (this->runner != nullptr)
+	{
+		this->runner->requestStop();
+		return;
+	}
+
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	// Use simulation actions behaviors if simulating
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(machineManager->getSimulatedMachine());
+
+	auto generator = make_shared<FsmStimulusGenerator>(fsm, simulatedFsm);
+	for (int i = 0 ; i < this->inputsIds.count() ; i++)
+	{
+		auto weightEditor = dynamic_cast<QSpinBox*>(this->weightsTable->cellWidget(i, 1));
+		if (weightEditor == nullptr) continue;
+
+
+		generator->setInputWeight(this->inputsIds.at(i), weightEditor->value());
+	}
+
+	bool constraintsSupported = true;
+	for (const auto& constraint : this->constraints)
+	{
+		if (generator->addConstraint(constraint) == false)
+		{
+			constraintsSupported = false;
+		}
+	}
+
+	if ( (generator->isSupported() == false) || (constraintsSupported == false) )
+	{
+		this->summaryLabel->setText(tr("Random regression is not available for this machine (variables or constraints larger than 64 bits)."));
+		return;
+	}
+
+
+	this->nativeConditionsError.clear();
+	if (this->nativeConditions->isChecked() == true)
+	{
+		this->summaryLabel->setText(tr("Compiling transitions conditions…"));
+		this->buttonRun->setEnabled(false);
+
+		this->compiledGenerator = generator;
+		this->compilationWorker.reset(QThread::create([this, generator]() { generator->compileNativeConditions(this->nativeConditionsError); }));
+		connect(this->compilationWorker.get(), &QThread::finished, this, &RandomRegressionDialog::compilationFinishedEventHandler);
+		this->compilationWorker->start();
+	}
+	else
+	{
+		this->startRun(generator);
+	}
+}
+
+void RandomRegressionDialog::compilationFinishedEventHandler()
+{
+	if (this->compilationWorker == nullptr) return;
+
+	if (this->compilationWorker->isFinished() == false) return;
+
+
+	auto generator = this->compiledGenerator;
+
+	this->compilationWorker.reset();
+	this->compiledGenerator.reset();
+	this->buttonRun->setEnabled(true);
+
+	this->startRun(generator);
+}
+
+void RandomRegressionDialog::startRun(shared_ptr<FsmStimulusGenerator> generator)
+{
+	RandomRegressionRunner::Settings_t settings;
+	settings.firstSeed    = this->firstSeedValue->text().toUInt();
+	settings.seedsCount   = qMax(this->seedsCountValue->text().toUInt(), (uint)1);
+	settings.stepsPerSeed = this->stepsPerSeedValue->text().toULongLong();
+	settings.recordTermsCoverage = this->termsCoverage->isChecked();
+
+	this->termsCoverageRecorded = settings.recordTermsCoverage;
+
+	this->runner = make_shared<RandomRegressionRunner>(generator, settings);
+	connect(this->runner.get(), &RandomRegressionRunner::runFinishedEvent, this, &RandomRegressionDialog::runFinishedEventHandler);
+
+	this->progressBar->setRange(0, settings.seedsCount);
+	this->progressBar->setValue(0);
+	this->summaryLabel->clear();
+	this->resultsTable->setRowCount(0);
+	this->buttonExportCoverage->setEnabled(false);
+	this->buttonMergeCoverage->setEnabled(false);
+	this->buttonRun->setText(tr("Stop"));
+
+	this->runner->start();
+	this->progressTimer->start();
+}
+
+void RandomRegressionDialog::progressTimerEventHandler()
+{
+	if (this->runner == nullptr) return;
+
+
+	this->progressBar->setValue(this->runner->getCompletedSeedsCount());
+}
+
+void RandomRegressionDialog::runFinishedEventHandler()
+{
+	if (this->runner == nullptr) return;
+
+
+	this->runner->wait();
+	this->progressTimer->stop();
+	this->progressBar->setValue(this->runner->getCompletedSeedsCount());
+
+	this->displayResults();
+
+	this->runner.reset();
+	this->buttonRun->setText(tr("Run"));
+}
+
+void RandomRegressionDialog::buttonExportCoverageClicked()
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	QString filePath = QFileDialog::getSaveFileName(this, tr("Export coverage"), fsm->getName() + "_coverage.csv", "*.csv");
+	if (filePath.isEmpty() == true) return;
+
+
+	if (filePath.endsWith(".csv", Qt::CaseInsensitive) == false)
+	{
+		filePath += ".csv";
+	}
+
+	if (this->mergedCoverage.exportToCsv(filePath, fsm) == false)
+	{
+		ContextMenu* menu = ContextMenu::createErrorMenu(tr("Unable to write file"));
+		menu->popup(this->buttonExportCoverage->mapToGlobal(QPoint(this->buttonExportCoverage->width(), -menu->sizeHint().height())));
+	}
+}
+
+/**
+ * @brief RandomRegressionDialog::buttonMergeCoverageClicked adds
+ * the regression coverage to the interactive simulator one, so that
+ * the uncovered elements can be highlighted on the machine.
+ */
+void RandomRegressionDialog::buttonMergeCoverageClicked()
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	machineSimulator->mergeCoverage(this->mergedCoverage);
+	this->buttonMergeCoverage->setEnabled(false);
+}
+
+void RandomRegressionDialog::stopRun()
+{
+	// Compilation can't be interrupted, but is bounded by its timeout
+	if (this->compilationWorker != nullptr)
+	{
+		this->compilationWorker->wait();
+
+		this->compilationWorker.reset();
+		this->compiledGenerator.reset();
+		this->buttonRun->setEnabled(true);
+		this->summaryLabel->clear();
+	}
+
+	if (this->runner == nullptr) return;
+
+
+	this->runner->requestStop();
+	this->runner->wait();
+	this->progressTimer->stop();
+
+	this->runner.reset();
+	this->buttonRun->setText(tr("Run"));
+}
+
+void RandomRegressionDialog::displayResults()
+{
+	const auto& results = this->runner->getResults();
+
+	// Coverage over all seeds
+	this->mergedCoverage = FsmCoverage();
+	uint doneSeeds = 0;
+
+	this->resultsTable->setRowCount(0);
+	for (const auto& result : results)
+	{
+		if (result.done == false) continue;
+
+
+		doneSeeds++;
+
+		this->mergedCoverage.merge(result.coverage);
+
+		const auto& coverage = result.coverage;
+
+		int row = this->resultsTable->rowCount();
+		this->resultsTable->insertRow(row);
+		this->resultsTable->setItem(row, 0, new QTableWidgetItem(QString::number(result.seed)));
+		this->resultsTable->setItem(row, 1, new QTableWidgetItem(QString::number(result.steps)));
+		this->resultsTable->setItem(row, 2, new QTableWidgetItem(QString::number(coverage.getCoveredStatesCount())      + " / " + QString::number(coverage.getStatesCount())));
+		this->resultsTable->setItem(row, 3, new QTableWidgetItem(QString::number(coverage.getCoveredTransitionsCount()) + " / " + QString::number(coverage.getTransitionsCount())));
+		if (this->termsCoverageRecorded == true)
+		{
+			this->resultsTable->setItem(row, 4, new QTableWidgetItem(QString::number(coverage.getCoveredTermsCount()) + " / " + QString::number(coverage.getTermsCount())));
+		}
+		else
+		{
+			this->resultsTable->setItem(row, 4, new QTableWidgetItem("-"));
+		}
+		this->resultsTable->setItem(row, 5, new QTableWidgetItem(QString::number(result.conflicts)));
+		this->resultsTable->setItem(row, 6, new QTableWidgetItem(QString::number(result.unsatisfiedConstraints)));
+	}
+
+	this->summaryLabel->setText(QString::number(doneSeeds) + " " + tr("seeds simulated.") + " " +
+	                            tr("All seeds together covered") + " " +
+	                            QString::number(this->mergedCoverage.getCoveredStatesCount())      + " / " + QString::number(this->mergedCoverage.getStatesCount())      + " " + tr("states,") + " " +
+	                            QString::number(this->mergedCoverage.getCoveredTransitionsCount()) + " / " + QString::number(this->mergedCoverage.getTransitionsCount()) + " " + tr("transitions"));
+
+	if (this->termsCoverageRecorded == true)
+	{
+		this->summaryLabel->setText(this->summaryLabel->text() + " " + tr("and") + " " +
+		                            QString::number(this->mergedCoverage.getCoveredTermsCount()) + " / " + QString::number(this->mergedCoverage.getTermsCount()) + " " + tr("conditions terms."));
+	}
+	else
+	{
+		this->summaryLabel->setText(this->summaryLabel->text() + ".");
+	}
+
+	if (this->nativeConditionsError.isEmpty() == false)
+	{
+		this->summaryLabel->setText(this->summaryLabel->text() + "<br />" + tr("Conditions were interpreted as native compilation failed:") + " " + this->nativeConditionsError.toHtmlEscaped());
+	}
+
+	bool coverageAvailable = (this->mergedCoverage.isEmpty() == false);
+	this->buttonExportCoverage->setEnabled(coverageAvailable);
+	this->buttonMergeCoverage->setEnabled( (coverageAvailable == true) && (machineManager->getMachineSimulator() != nullptr) );
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RANDOMREGRESSIONDIALOG_H
+#define RANDOMREGRESSIONDIALOG_H
+
+// Parent
+#include "statesdialog.h"
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+class QLineEdit;
+class QCheckBox;
+class QTableWidget;
+class QListWidget;
+class QPushButton;
+class QProgressBar;
+class QLabel;
+class QTimer;
+class QThread;
+
+// StateS classes
+#include "statestypes.h"
+#include "fsmcoverage.h"
+class Equation;
+class EquationEditorDialog;
+class RandomRegressionRunner;
+class FsmStimulusGenerator;
+
+
+/**
+ * @brief The RandomRegressionDialog class configures and runs
+ * random simulations of the machine on many seeds in parallel,
+ * and displays the coverage obtained by each seed.
+ */
+class RandomRegressionDialog : public StatesDialog
+{
+	Q_OBJECT
+
+	/////
+	// Static variables
+private:
+	// Progress display refresh period (ms)
+	static const int progressRefreshPeriod = 100;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit RandomRegressionDialog(QWidget* parent = nullptr);
+	~RandomRegressionDialog();
+
+	/////
+	// Object functions
+public slots:
+	virtual void reject() override;
+
+private slots:
+	void buttonAddConstraintClicked();
+	void buttonRemoveConstraintClicked();
+	void equationEditorClosedEventHandler(int result);
+	void buttonRunClicked();
+	void progressTimerEventHandler();
+	void compilationFinishedEventHandler();
+	void runFinishedEventHandler();
+	void buttonExportCoverageClicked();
+	void buttonMergeCoverageClicked();
+
+private:
+	void startRun(shared_ptr<FsmStimulusGenerator> generator);
+	void stopRun();
+	void displayResults();
+
+	/////
+	// Object variables
+private:
+	QList<componentId_t> inputsIds;
+	QList<shared_ptr<Equation>> constraints;
+
+	QLineEdit*    firstSeedValue       = nullptr;
+	QLineEdit*    seedsCountValue      = nullptr;
+	QLineEdit*    stepsPerSeedValue    = nullptr;
+	QCheckBox*    nativeConditions     = nullptr;
+	QCheckBox*    termsCoverage        = nullptr;
+	QTableWidget* weightsTable         = nullptr;
+	QListWidget*  constraintsList      = nullptr;
+	QPushButton*  buttonRun            = nullptr;
+	QProgressBar* progressBar          = nullptr;
+	QLabel*       summaryLabel         = nullptr;
+	QTableWidget* resultsTable         = nullptr;
+	QPushButton*  buttonExportCoverage = nullptr;
+	QPushButton*  buttonMergeCoverage  = nullptr;
+
+	EquationEditorDialog* equationEditor = nullptr;
+
+	shared_ptr<RandomRegressionRunner> runner;
+	// Native conditions are compiled out of the GUI thread before the run starts
+	unique_ptr<QThread> compilationWorker;
+	shared_ptr<FsmStimulusGenerator> compiledGenerator;
+	shared_ptr<QTimer> progressTimer;
+
+	// Coverage of all seeds of the last run
+	FsmCoverage mergedCoverage;
+	bool termsCoverageRecorded = true;
+	// Reason why conditions were interpreted during the last run, if native compilation failed
+	QString nativeConditionsError;
+
+};
+
+#endif // RANDOMREGRESSIONDIALOG_H
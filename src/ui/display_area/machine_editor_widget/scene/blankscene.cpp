@@ -37,6 +37,11 @@ BlankScene::BlankScene()
 	this->text->setDefaultTextColor(QColor("light gray"));
 }
 
+void BlankScene::flushPendingGeometryRefreshes()
+{
+	// Ignore
+}
+
 void BlankScene::updateSimulationMode(SimulationMode_t)
 {
 	// Ignore
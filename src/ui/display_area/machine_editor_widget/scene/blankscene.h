@@ -38,6 +38,11 @@ class BlankScene : public GenericScene
 public:
 	explicit BlankScene();
 
+	/////
+	// Object functions
+public:
+	virtual void flushPendingGeometryRefreshes() override;
+
 protected:
 	virtual void updateSimulationMode(SimulationMode_t) override;
 
@@ -485,6 +485,22 @@ void FsmScene::contextMenuEvent(QGraphicsSceneContextMenuEvent* ce)
 	}
 }
 
+/**
+ * @brief FsmScene::flushPendingGeometryRefreshes applies
+ * transitions geometry refreshes delayed by states moves.
+ */
+void FsmScene::flushPendingGeometryRefreshes()
+{
+	auto graphicFsm = dynamic_pointer_cast<GraphicFsm>(machineManager->getGraphicMachine());
+	if (graphicFsm == nullptr) return;
+
+
+	for (auto graphicTransition : graphicFsm->getTransitions())
+	{
+		graphicTransition->flushPendingGeometryRefresh();
+	}
+}
+
 void FsmScene::updateSimulationMode(SimulationMode_t newMode)
 {
 	shared_ptr<MachineBuilder> machineBuilder = machineManager->getMachineBuilder();
@@ -873,14 +889,12 @@ void FsmScene::displayGraphicMachine()
 	if (graphicFsm == nullptr) return;
 
 
-	QList<GraphicFsmState*> states = graphicFsm->getStates();
-	for (GraphicFsmState* graphicState : states)
+	for (GraphicFsmState* graphicState : graphicFsm->getStates())
 	{
 		this->addState(graphicState, true);
 	}
 
-	QList<GraphicFsmTransition*> transitions = graphicFsm->getTransitions();
-	for (GraphicFsmTransition* graphicTransition : transitions)
+	for (GraphicFsmTransition* graphicTransition : graphicFsm->getTransitions())
 	{
 		this->addTransition(graphicTransition, true);
 	}
@@ -894,25 +908,14 @@ void FsmScene::displaySimulatedMachine()
 	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(machineManager->getSimulatedMachine());
 	if (simulatedFsm == nullptr) return;
 
-	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
-	if (fsm == nullptr) return;
-
 
-	for (auto& stateId : fsm->getAllStatesIds())
+	for (auto simulatedState : graphicFsm->getSimulatedStates())
 	{
-		auto simulatedState = graphicFsm->getSimulatedState(stateId);
-		if (simulatedState == nullptr) continue;
-
-
 		this->addState(simulatedState, false);
 	}
 
-	for (auto& transitionId : fsm->getAllTransitionsIds())
+	for (auto simulatedTransition : graphicFsm->getSimulatedTransitions())
 	{
-		auto simulatedTransition = graphicFsm->getSimulatedTransition(transitionId);
-		if (simulatedTransition == nullptr) continue;
-
-
 		this->addTransition(simulatedTransition, false);
 	}
 }
@@ -1090,7 +1093,10 @@ void FsmScene::cancelOngoingAction()
 
 GraphicFsmState* FsmScene::getStateAt(const QPointF& location) const
 {
-	const QList<QGraphicsItem*> itemsAtThisPoint = this->items(location, Qt::IntersectsItemShape, Qt::DescendingOrder);
+	// Only use bounding rects to get candidates: this avoids testing
+	// the shape of all transitions passing there, as we are only
+	// interested in states.
+	const QList<QGraphicsItem*> itemsAtThisPoint = this->items(location, Qt::IntersectsItemBoundingRect, Qt::DescendingOrder);
 	// Warning: if using transform on view, the upper line should be adapted!
 
 	for (QGraphicsItem* item : itemsAtThisPoint)
@@ -1098,7 +1104,7 @@ GraphicFsmState* FsmScene::getStateAt(const QPointF& location) const
 		// Select the topmost visible state
 		GraphicFsmState* currentItem = dynamic_cast<GraphicFsmState*> (item);
 
-		if ( currentItem != nullptr)
+		if ( (currentItem != nullptr) && (currentItem->contains(currentItem->mapFromScene(location)) == true) )
 		{
 			return currentItem;
 		}
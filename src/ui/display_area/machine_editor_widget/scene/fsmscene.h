@@ -78,6 +78,9 @@ public:
 
 	/////
 	// Object functions
+public:
+	virtual void flushPendingGeometryRefreshes() override;
+
 protected:
 	virtual void mousePressEvent  (QGraphicsSceneMouseEvent*       me) override;
 	virtual void mouseMoveEvent   (QGraphicsSceneMouseEvent*       me) override;
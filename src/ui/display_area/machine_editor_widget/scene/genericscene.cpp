@@ -39,6 +39,9 @@ QRectF GenericScene::getItemsBoundingRect()
 {
 	if (this->items().count() == 0) return QRectF();
 
+
+	this->flushPendingGeometryRefreshes();
+
 	// Use one item to initialize rect
 	auto firstItem = this->items().at(0);
 	qreal leftmostPosition   = firstItem->mapToScene(firstItem->boundingRect().topLeft()).x();
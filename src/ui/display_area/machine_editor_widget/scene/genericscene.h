@@ -44,6 +44,8 @@ public:
 	QRectF getItemsBoundingRect();
 	void recomputeSceneRect();
 
+	virtual void flushPendingGeometryRefreshes() = 0;
+
 protected:
 	virtual void updateSimulationMode(SimulationMode_t newMode) = 0;
 
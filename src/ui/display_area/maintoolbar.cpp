@@ -66,8 +66,8 @@ MainToolBar::MainToolBar(QWidget* parent) :
 
 	this->actionExportCode = new QAction(this);
 	this->actionExportCode->setIcon(QIcon(PixmapGenerator::getPixmapFromSvg(QString(":/icons/export_VHDL"))));
-	this->actionExportCode->setText(tr("Export to VHDL"));
-	this->actionExportCode->setToolTip(tr("Export machine to VHDL"));
+	this->actionExportCode->setText(tr("Export to VHDL, SystemVerilog or C++"));
+	this->actionExportCode->setToolTip(tr("Export machine to a hardware description language"));
 
 	this->actionUndo = new QAction(this);
 	this->actionUndo->setIcon(QIcon(PixmapGenerator::getPixmapFromSvg(QString(":/icons/undo"))));
@@ -103,10 +103,11 @@ void StateTimeLine::resetEventHandler()
 	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(machineManager->getSimulatedMachine());
 	if (simulatedFsm == nullptr) return;
 
-	auto initialStateId = simulatedFsm->getInitialStateId();
-	auto initialSimulatedState = simulatedFsm->getSimulatedState(initialStateId);
-	if (initialSimulatedState == nullptr) return;
+	// Simulation may be reset to a previous step rather than to initial state
+	auto currentStateId = simulatedFsm->getActiveStateId();
+	auto currentSimulatedState = simulatedFsm->getSimulatedState(currentStateId);
+	if (currentSimulatedState == nullptr) return;
 
 
-	this->stateDisplay->reset(initialSimulatedState->getName());
+	this->stateDisplay->reset(currentSimulatedState->getName());
 }
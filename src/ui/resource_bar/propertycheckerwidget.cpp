@@ -0,0 +1,370 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "propertycheckerwidget.h"
+
+// Qt classes
+#include <QLabel>
+#include <QPushButton>
+#include <QComboBox>
+#include <QLineEdit>
+#include <QVBoxLayout>
+#include <QGridLayout>
+
+// StateS classes
+#include "machinemanager.h"
+#include "machinesimulator.h"
+#include "fsm.h"
+#include "simulatedfsm.h"
+#include "simulatedvariable.h"
+#include "equation.h"
+#include "equationeditordialog.h"
+#include "fsmstatespaceexplorer.h"
+#include "statespaceexplorationrunner.h"
+
+
+PropertyCheckerWidget::PropertyCheckerWidget(QWidget* parent) :
+	QWidget(parent)
+{
+	connect(machineManager.get(), &MachineManager::machineUpdatedEvent, this, &PropertyCheckerWidget::clearResult);
+
+	auto mainLayout = new QVBoxLayout(this);
+
+	auto title = new QLabel("<b>" + tr("Property checking") + "</b>");
+	title->setAlignment(Qt::AlignCenter);
+
+	this->propertyType = new QComboBox();
+	this->propertyType->addItem(tr("Always P"));
+	this->propertyType->addItem(tr("P implies Q within k steps"));
+
+	auto equationsLayout = new QGridLayout();
+
+	this->premiseLabel = new QLabel("P:");
+	this->premiseText = new QLabel();
+	this->premiseText->setWordWrap(true);
+	auto buttonEditPremise = new QPushButton(tr("Edit…"));
+	equationsLayout->addWidget(this->premiseLabel, 0, 0);
+	equationsLayout->addWidget(this->premiseText,  0, 1);
+	equationsLayout->addWidget(buttonEditPremise,  0, 2);
+
+	this->responseLabel = new QLabel("Q:");
+	this->responseText = new QLabel();
+	this->responseText->setWordWrap(true);
+	this->buttonEditResponse = new QPushButton(tr("Edit…"));
+	equationsLayout->addWidget(this->responseLabel,      1, 0);
+	equationsLayout->addWidget(this->responseText,       1, 1);
+	equationsLayout->addWidget(this->buttonEditResponse, 1, 2);
+
+	this->stepsLabel = new QLabel("k:");
+	this->stepsValue = new QLineEdit("1");
+	equationsLayout->addWidget(this->stepsLabel, 2, 0);
+	equationsLayout->addWidget(this->stepsValue, 2, 1);
+
+	this->buttonCheck = new QPushButton(tr("Check property"));
+
+	this->resultLabel = new QLabel();
+	this->resultLabel->setWordWrap(true);
+
+	this->buttonReplay = new QPushButton(tr("Replay counterexample in simulator"));
+
+	connect(this->propertyType,       &QComboBox::currentIndexChanged, this, &PropertyCheckerWidget::propertyTypeChangedEventHandler);
+	connect(buttonEditPremise,        &QPushButton::clicked,           this, &PropertyCheckerWidget::buttonEditPremiseClicked);
+	connect(this->buttonEditResponse, &QPushButton::clicked,           this, &PropertyCheckerWidget::buttonEditResponseClicked);
+	connect(this->buttonCheck,        &QPushButton::clicked,           this, &PropertyCheckerWidget::buttonCheckClicked);
+	connect(this->buttonReplay,       &QPushButton::clicked,           this, &PropertyCheckerWidget::buttonReplayClicked);
+
+	mainLayout->addWidget(title);
+	mainLayout->addWidget(this->propertyType);
+	mainLayout->addLayout(equationsLayout);
+	mainLayout->addWidget(this->buttonCheck);
+	mainLayout->addWidget(this->resultLabel);
+	mainLayout->addWidget(this->buttonReplay);
+
+	this->propertyTypeChangedEventHandler(0);
+	this->refreshEquationsDisplay();
+	this->clearResult();
+}
+
+PropertyCheckerWidget::~PropertyCheckerWidget()
+{
+	// Required for unique_ptr on incomplete type
+}
+
+void PropertyCheckerWidget::propertyTypeChangedEventHandler(int index)
+{
+	bool isResponse = (index == 1);
+
+	this->responseLabel->setVisible(isResponse);
+	this->responseText->setVisible(isResponse);
+	this->buttonEditResponse->setVisible(isResponse);
+	this->stepsLabel->setVisible(isResponse);
+	this->stepsValue->setVisible(isResponse);
+
+	this->clearResult();
+}
+
+void PropertyCheckerWidget::buttonEditPremiseClicked()
+{
+	this->openEquationEditor(this->premise, false);
+}
+
+void PropertyCheckerWidget::buttonEditResponseClicked()
+{
+	this->openEquationEditor(this->response, true);
+}
+
+void PropertyCheckerWidget::equationEditorClosedEventHandler(int result)
+{
+	if (this->equationEditor == nullptr) return;
+
+
+	if (result == QDialog::DialogCode::Accepted)
+	{
+		if (this->editingResponse == true)
+		{
+			this->response = this->equationEditor->getResultEquation();
+		}
+		else
+		{
+			this->premise = this->equationEditor->getResultEquation();
+		}
+
+		this->refreshEquationsDisplay();
+		this->clearResult();
+	}
+
+	this->equationEditor->deleteLater();
+	this->equationEditor = nullptr;
+}
+
+/**
+ * @brief PropertyCheckerWidget::buttonCheckClicked explores the
+ * reachable states then checks the property in a worker thread.
+ * When running, the button stops the check.
+ */
+void PropertyCheckerWidget::buttonCheckClicked()
+{
+	if (this->checkRunner != nullptr)
+	{
+		this->checkRunner->requestStop();
+		return;
+	}
+
+
+	this->clearResult();
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	bool isResponse = (this->propertyType->currentIndex() == 1);
+	if ( (this->premise == nullptr) || ( (isResponse == true) && (this->response == nullptr) ) )
+	{
+		this->resultLabel->setText(tr("Please define the property equations first."));
+		return;
+	}
+
+
+	// Use simulation actions behaviors if simulating
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(machineManager->getSimulatedMachine());
+	this->explorer = make_shared<FsmStateSpaceExplorer>(fsm, simulatedFsm);
+
+	auto explorer = this->explorer;
+	auto premise  = this->premise;
+	auto response = this->response;
+	uint maxSteps = this->stepsValue->text().toUInt();
+	auto check = [this, explorer, isResponse, premise, response, maxSteps]()
+	{
+		FsmPropertyChecker checker(explorer);
+		if (isResponse == true)
+		{
+			this->result = checker.checkBoundedResponse(premise, response, maxSteps);
+		}
+		else
+		{
+			this->result = checker.checkInvariant(premise);
+		}
+		this->inputsIds = checker.getInputsIds();
+	};
+
+	this->checkRunner = make_unique<StateSpaceExplorationRunner>(this->explorer, check);
+	connect(this->checkRunner.get(), &StateSpaceExplorationRunner::progressEvent,    this, &PropertyCheckerWidget::explorationProgressEventHandler);
+	connect(this->checkRunner.get(), &StateSpaceExplorationRunner::runFinishedEvent, this, &PropertyCheckerWidget::checkFinishedEventHandler);
+
+	this->resultLabel->setText(tr("Exploring reachable states…"));
+	this->buttonCheck->setText(tr("Stop checking"));
+
+	this->checkRunner->start();
+}
+
+void PropertyCheckerWidget::explorationProgressEventHandler(uint configurationsCount, uint)
+{
+	if (this->checkRunner == nullptr) return;
+
+
+	this->resultLabel->setText(tr("Exploring reachable states…") + " " + QString::number(configurationsCount) + " " + tr("configurations found."));
+}
+
+void PropertyCheckerWidget::checkFinishedEventHandler()
+{
+	if (this->checkRunner == nullptr) return;
+
+	if (this->checkRunner->isFinished() == false) return;
+
+
+	this->checkRunner.reset();
+	this->buttonCheck->setText(tr("Check property"));
+
+	if (this->explorer->getReport().status == ExplorationStatus_t::stopped)
+	{
+		this->resultLabel->setText(tr("Check stopped on user request."));
+		return;
+	}
+
+
+	switch (this->result.status)
+	{
+	case PropertyCheckStatus_t::holds:
+		this->resultLabel->setText(tr("Property holds in all the") + " " + QString::number(this->explorer->getConfigurationsCount()) + " " + tr("reachable configurations."));
+		break;
+	case PropertyCheckStatus_t::holdsOnExploredPart:
+		this->resultLabel->setText(tr("No violation found, but only part of the reachable configurations could be explored."));
+		break;
+	case PropertyCheckStatus_t::violated:
+		this->resultLabel->setText(tr("Property is violated.") + " " + tr("Shortest counterexample found has") + " " + QString::number(this->result.counterexample.count()) + " " + tr("steps."));
+		this->buttonReplay->setVisible(true);
+		break;
+	case PropertyCheckStatus_t::unsupportedProperty:
+		this->resultLabel->setText(tr("This property can't be checked: equations are limited to 64 bits, response properties can't refer to inputs and are limited to") + " " + QString::number(FsmPropertyChecker::maxResponseSteps) + " " + tr("steps."));
+		break;
+	case PropertyCheckStatus_t::explorationFailed:
+		this->resultLabel->setText(tr("Reachable states exploration failed for this machine.") + " " + tr("Use the verifier tool for details."));
+		break;
+	}
+}
+
+/**
+ * @brief PropertyCheckerWidget::buttonReplayClicked resets
+ * the simulation and replays the counterexample steps, so
+ * that it can be observed in the simulator and timeline.
+ */
+void PropertyCheckerWidget::buttonReplayClicked()
+{
+	if (this->result.status != PropertyCheckStatus_t::violated) return;
+
+
+	if (machineManager->getCurrentSimulationMode() != SimulationMode_t::simulateMode)
+	{
+		machineManager->setSimulationMode(SimulationMode_t::simulateMode);
+	}
+
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+	auto simulatedMachine = machineSimulator->getSimulatedMachine();
+	if (simulatedMachine == nullptr) return;
+
+
+	auto setInputs = [&](const QList<LogicValue>& inputsValues)
+	{
+		for (int i = 0 ; (i < this->inputsIds.count()) && (i < inputsValues.count()) ; i++)
+		{
+			auto simulatedVariable = simulatedMachine->getSimulatedVariable(this->inputsIds.at(i));
+			if (simulatedVariable == nullptr) continue;
+
+
+			simulatedVariable->setCurrentValue(inputsValues.at(i));
+		}
+	};
+
+	machineSimulator->reset();
+
+	for (const auto& step : this->result.counterexample)
+	{
+		setInputs(step.inputsValues);
+
+		if (step.forcedTransitionId != nullId)
+		{
+			machineSimulator->doStepThroughTransition(step.forcedTransitionId);
+		}
+		else
+		{
+			machineSimulator->doStep();
+		}
+	}
+
+	setInputs(this->result.finalInputsValues);
+}
+
+void PropertyCheckerWidget::clearResult()
+{
+	// Worker writes the result
+	if (this->checkRunner != nullptr)
+	{
+		this->checkRunner->requestStop();
+		this->checkRunner->wait();
+
+		this->checkRunner.reset();
+		this->buttonCheck->setText(tr("Check property"));
+	}
+
+	this->explorer.reset();
+	this->result = FsmPropertyChecker::Result_t();
+	this->inputsIds.clear();
+
+	this->resultLabel->clear();
+	this->buttonReplay->setVisible(false);
+}
+
+void PropertyCheckerWidget::openEquationEditor(shared_ptr<const Equation> initialEquation, bool editingResponse)
+{
+	if (this->equationEditor != nullptr) return;
+
+
+	this->editingResponse = editingResponse;
+
+	this->equationEditor = new EquationEditorDialog(initialEquation, this);
+	connect(this->equationEditor, &EquationEditorDialog::finished, this, &PropertyCheckerWidget::equationEditorClosedEventHandler);
+
+	this->equationEditor->open();
+}
+
+void PropertyCheckerWidget::refreshEquationsDisplay()
+{
+	if (this->premise != nullptr)
+	{
+		this->premiseText->setText(this->premise->getColoredText());
+	}
+	else
+	{
+		this->premiseText->setText("<i>" + tr("(not defined)") + "</i>");
+	}
+
+	if (this->response != nullptr)
+	{
+		this->responseText->setText(this->response->getColoredText());
+	}
+	else
+	{
+		this->responseText->setText("<i>" + tr("(not defined)") + "</i>");
+	}
+}
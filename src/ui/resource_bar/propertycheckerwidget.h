@@ -0,0 +1,108 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROPERTYCHECKERWIDGET_H
+#define PROPERTYCHECKERWIDGET_H
+
+// Parent
+#include <QWidget>
+
+// C++ classes
+#include <memory>
+using namespace std;
+
+// Qt classes
+class QLabel;
+class QPushButton;
+class QComboBox;
+class QLineEdit;
+
+// StateS classes
+#include "fsmpropertychecker.h"
+class Equation;
+class EquationEditorDialog;
+class FsmStateSpaceExplorer;
+class StateSpaceExplorationRunner;
+
+
+/**
+ * @brief The PropertyCheckerWidget class allows to check
+ * a property on the reachable states of the machine, and
+ * to replay the counterexample in the simulator.
+ */
+class PropertyCheckerWidget : public QWidget
+{
+	Q_OBJECT
+
+	/////
+	// Constructors/destructors
+public:
+	explicit PropertyCheckerWidget(QWidget* parent = nullptr);
+	~PropertyCheckerWidget();
+
+	/////
+	// Object functions
+private slots:
+	void propertyTypeChangedEventHandler(int index);
+	void buttonEditPremiseClicked();
+	void buttonEditResponseClicked();
+	void equationEditorClosedEventHandler(int result);
+	void buttonCheckClicked();
+	void explorationProgressEventHandler(uint configurationsCount, uint depth);
+	void checkFinishedEventHandler();
+	void buttonReplayClicked();
+	void clearResult();
+
+private:
+	void openEquationEditor(shared_ptr<const Equation> initialEquation, bool editingResponse);
+	void refreshEquationsDisplay();
+
+	/////
+	// Object variables
+private:
+	shared_ptr<Equation> premise;
+	shared_ptr<Equation> response;
+
+	// Written by the check worker, only read when it is finished
+	FsmPropertyChecker::Result_t result;
+	QList<componentId_t> inputsIds;
+
+	shared_ptr<FsmStateSpaceExplorer> explorer;
+	unique_ptr<StateSpaceExplorationRunner> checkRunner;
+
+	QComboBox*   propertyType       = nullptr;
+	QLabel*      premiseLabel       = nullptr;
+	QLabel*      premiseText        = nullptr;
+	QLabel*      responseLabel      = nullptr;
+	QLabel*      responseText       = nullptr;
+	QPushButton* buttonEditResponse = nullptr;
+	QLabel*      stepsLabel         = nullptr;
+	QLineEdit*   stepsValue         = nullptr;
+	QPushButton* buttonCheck        = nullptr;
+	QLabel*      resultLabel        = nullptr;
+	QPushButton* buttonReplay       = nullptr;
+
+	EquationEditorDialog* equationEditor = nullptr;
+	bool editingResponse = false;
+
+};
+
+#endif // PROPERTYCHECKERWIDGET_H
@@ -0,0 +1,252 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "simulatorbreakpointseditor.h"
+
+// Qt classes
+#include <QLabel>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <QListWidget>
+#include <QTimer>
+
+// StateS classes
+#include "machinemanager.h"
+#include "machinesimulator.h"
+#include "simulationbreakpoints.h"
+#include "machine.h"
+#include "graphicmachine.h"
+#include "equation.h"
+#include "equationeditordialog.h"
+#include "contextmenu.h"
+
+
+SimulatorBreakpointsEditor::SimulatorBreakpointsEditor(QWidget* parent) :
+	QWidget(parent)
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+	auto breakpoints = machineSimulator->getBreakpoints();
+
+
+	auto mainLayout = new QVBoxLayout();
+	this->setLayout(mainLayout);
+
+	auto hintLabel = new QLabel("<i>" + tr("Right-click on a state or a transition to add a breakpoint.") + " "
+	                            + tr("Watched conditions break the simulation when they become true if checked.") + "</i>");
+	hintLabel->setWordWrap(true);
+
+	this->summaryLabel = new QLabel();
+
+	this->conditionsList = new QListWidget();
+
+	auto buttonsLayout = new QHBoxLayout();
+	auto buttonAddCondition = new QPushButton(tr("Watch condition…"));
+	this->buttonRemoveCondition = new QPushButton(tr("Remove"));
+	auto buttonClear = new QPushButton(tr("Clear all"));
+	buttonsLayout->addWidget(buttonAddCondition);
+	buttonsLayout->addWidget(this->buttonRemoveCondition);
+	buttonsLayout->addWidget(buttonClear);
+
+	this->lastHitLabel = new QLabel();
+	this->lastHitLabel->setWordWrap(true);
+
+	connect(buttonAddCondition,          &QPushButton::clicked, this, &SimulatorBreakpointsEditor::buttonAddConditionClicked);
+	connect(this->buttonRemoveCondition, &QPushButton::clicked, this, &SimulatorBreakpointsEditor::buttonRemoveConditionClicked);
+	connect(buttonClear,                 &QPushButton::clicked, this, &SimulatorBreakpointsEditor::buttonClearClicked);
+
+	connect(this->conditionsList, &QListWidget::itemChanged, this, &SimulatorBreakpointsEditor::conditionItemChangedEventHandler);
+
+	connect(breakpoints.get(), &SimulationBreakpoints::breakpointsChangedEvent,      this, &SimulatorBreakpointsEditor::breakpointsChangedEventHandler);
+	connect(breakpoints.get(), &SimulationBreakpoints::conditionsValuesChangedEvent, this, &SimulatorBreakpointsEditor::conditionsValuesChangedEventHandler);
+	connect(machineSimulator.get(), &MachineSimulator::breakpointHitEvent,           this, &SimulatorBreakpointsEditor::breakpointHitEventHandler);
+
+	mainLayout->addWidget(hintLabel);
+	mainLayout->addWidget(this->summaryLabel);
+	mainLayout->addWidget(this->conditionsList);
+	mainLayout->addLayout(buttonsLayout);
+	mainLayout->addWidget(this->lastHitLabel);
+
+	this->refreshList();
+}
+
+void SimulatorBreakpointsEditor::buttonAddConditionClicked()
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return;
+
+	if (this->equationEditor != nullptr) return;
+
+
+	if (machine->getReadableVariablesIds().count() != 0)
+	{
+		this->equationEditor = new EquationEditorDialog(nullptr, this);
+		connect(this->equationEditor, &EquationEditorDialog::finished, this, &SimulatorBreakpointsEditor::equationEditorClosedEventHandler);
+
+		this->equationEditor->open();
+	}
+	else
+	{
+		auto menu = ContextMenu::createErrorMenu(tr("No variable to watch!"));
+		menu->popup(this->conditionsList->mapToGlobal(QPoint(0, 0)));
+	}
+}
+
+void SimulatorBreakpointsEditor::buttonRemoveConditionClicked()
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+	int rank = this->conditionsList->currentRow();
+	if (rank < 0) return;
+
+
+	machineSimulator->getBreakpoints()->removeCondition(rank);
+}
+
+void SimulatorBreakpointsEditor::buttonClearClicked()
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	machineSimulator->getBreakpoints()->clear();
+
+	// Breakpoints are displayed on graphic states
+	auto graphicMachine = machineManager->getGraphicMachine();
+	if (graphicMachine != nullptr)
+	{
+		graphicMachine->forceRefreshSimulatedDisplay();
+	}
+}
+
+void SimulatorBreakpointsEditor::equationEditorClosedEventHandler(int result)
+{
+	if (this->equationEditor == nullptr) return;
+
+
+	if (result == QDialog::DialogCode::Accepted)
+	{
+		auto machineSimulator = machineManager->getMachineSimulator();
+		if (machineSimulator != nullptr)
+		{
+			machineSimulator->getBreakpoints()->addCondition(this->equationEditor->getResultEquation());
+		}
+	}
+
+	this->equationEditor->deleteLater();
+	this->equationEditor = nullptr;
+}
+
+void SimulatorBreakpointsEditor::conditionItemChangedEventHandler(QListWidgetItem* item)
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+	int rank = this->conditionsList->row(item);
+	if (rank < 0) return;
+
+
+	bool breakWhenTrue = (item->checkState() == Qt::Checked);
+	if (machineSimulator->getBreakpoints()->getConditionBreakWhenTrue(rank) != breakWhenTrue)
+	{
+		machineSimulator->getBreakpoints()->setConditionBreakWhenTrue(rank, breakWhenTrue);
+	}
+}
+
+void SimulatorBreakpointsEditor::breakpointsChangedEventHandler()
+{
+	this->refreshList();
+}
+
+/**
+ * @brief SimulatorBreakpointsEditor::conditionsValuesChangedEventHandler
+ * Values can change at each step: coalesce refreshes to avoid slowing
+ * down the simulation.
+ */
+void SimulatorBreakpointsEditor::conditionsValuesChangedEventHandler()
+{
+	if (this->valuesRefreshPending == true) return;
+
+
+	this->valuesRefreshPending = true;
+	QTimer::singleShot(SimulatorBreakpointsEditor::valuesRefreshPeriod, this, &SimulatorBreakpointsEditor::refreshConditionsValues);
+}
+
+void SimulatorBreakpointsEditor::breakpointHitEventHandler(const QString& description)
+{
+	this->lastHitLabel->setText("<b>" + tr("Breakpoint reached:") + "</b><br />" + description);
+}
+
+void SimulatorBreakpointsEditor::refreshConditionsValues()
+{
+	this->valuesRefreshPending = false;
+
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	auto breakpoints = machineSimulator->getBreakpoints();
+
+	// Only text is changed: do not notify check state changes
+	this->conditionsList->blockSignals(true);
+	for (uint i = 0 ; (i < breakpoints->getConditionsCount()) && (i < (uint)this->conditionsList->count()) ; i++)
+	{
+		auto item = this->conditionsList->item(i);
+		item->setText(breakpoints->getCondition(i)->getText() + " = " + breakpoints->getConditionCurrentValue(i).toString());
+	}
+	this->conditionsList->blockSignals(false);
+}
+
+void SimulatorBreakpointsEditor::refreshList()
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	auto breakpoints = machineSimulator->getBreakpoints();
+
+	this->summaryLabel->setText(QString::number(breakpoints->getStateBreakpointsCount()) + " " + tr("breakpoint(s) on states") + ", "
+	                            + QString::number(breakpoints->getTransitionBreakpointsCount()) + " " + tr("breakpoint(s) on transitions"));
+
+	this->conditionsList->blockSignals(true);
+	this->conditionsList->clear();
+	for (uint i = 0 ; i < breakpoints->getConditionsCount() ; i++)
+	{
+		auto item = new QListWidgetItem(this->conditionsList);
+		item->setFlags(item->flags() | Qt::ItemIsUserCheckable);
+		if (breakpoints->getConditionBreakWhenTrue(i) == true)
+		{
+			item->setCheckState(Qt::Checked);
+		}
+		else
+		{
+			item->setCheckState(Qt::Unchecked);
+		}
+	}
+	this->conditionsList->blockSignals(false);
+
+	this->buttonRemoveCondition->setEnabled(breakpoints->getConditionsCount() != 0);
+
+	this->refreshConditionsValues();
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SIMULATORBREAKPOINTSEDITOR_H
+#define SIMULATORBREAKPOINTSEDITOR_H
+
+// Parent
+#include <QWidget>
+
+// Qt classes
+class QLabel;
+class QPushButton;
+class QListWidget;
+class QListWidgetItem;
+
+// StateS classes
+class EquationEditorDialog;
+
+
+class SimulatorBreakpointsEditor : public QWidget
+{
+	Q_OBJECT
+
+	/////
+	// Static variables
+private:
+	// Minimum delay between two refreshes of watched values (ms)
+	static const int valuesRefreshPeriod = 100;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit SimulatorBreakpointsEditor(QWidget* parent = nullptr);
+
+	/////
+	// Object functions
+private slots:
+	void buttonAddConditionClicked();
+	void buttonRemoveConditionClicked();
+	void buttonClearClicked();
+	void equationEditorClosedEventHandler(int result);
+	void conditionItemChangedEventHandler(QListWidgetItem* item);
+
+	void breakpointsChangedEventHandler();
+	void conditionsValuesChangedEventHandler();
+	void breakpointHitEventHandler(const QString& description);
+
+	void refreshConditionsValues();
+
+private:
+	void refreshList();
+
+	/////
+	// Object variables
+private:
+	QLabel*      summaryLabel          = nullptr;
+	QListWidget* conditionsList        = nullptr;
+	QPushButton* buttonRemoveCondition = nullptr;
+	QLabel*      lastHitLabel          = nullptr;
+
+	EquationEditorDialog* equationEditor = nullptr;
+
+	bool valuesRefreshPending = false;
+
+};
+
+#endif // SIMULATORBREAKPOINTSEDITOR_H
@@ -0,0 +1,154 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "simulatorcoverageviewer.h"
+
+// Qt classes
+#include <QLabel>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <QCheckBox>
+#include <QTimer>
+#include <QFileDialog>
+
+// StateS classes
+#include "machinemanager.h"
+#include "machinesimulator.h"
+#include "fsm.h"
+#include "contextmenu.h"
+
+
+SimulatorCoverageViewer::SimulatorCoverageViewer(QWidget* parent) :
+	QWidget(parent)
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	auto mainLayout = new QVBoxLayout();
+	this->setLayout(mainLayout);
+
+	auto hintLabel = new QLabel(tr("Coverage is accumulated over all steps since simulation started, including fast simulations."));
+	hintLabel->setWordWrap(true);
+
+	this->summaryLabel = new QLabel();
+	this->summaryLabel->setWordWrap(true);
+
+	this->overlayCheckBox = new QCheckBox(tr("Highlight uncovered states and transitions"));
+	this->overlayCheckBox->setChecked(machineSimulator->getCoverageOverlayEnabled());
+
+	auto buttonsLayout = new QHBoxLayout();
+	auto buttonClear  = new QPushButton(tr("Clear"));
+	this->buttonExport = new QPushButton(tr("Export…"));
+	buttonsLayout->addWidget(buttonClear);
+	buttonsLayout->addWidget(this->buttonExport);
+
+	connect(this->overlayCheckBox, &QCheckBox::toggled,   this, &SimulatorCoverageViewer::overlayCheckBoxToggled);
+	connect(buttonClear,           &QPushButton::clicked, this, &SimulatorCoverageViewer::buttonClearClicked);
+	connect(this->buttonExport,    &QPushButton::clicked, this, &SimulatorCoverageViewer::buttonExportClicked);
+
+	connect(machineSimulator.get(), &MachineSimulator::coverageChangedEvent, this, &SimulatorCoverageViewer::coverageChangedEventHandler);
+
+	mainLayout->addWidget(hintLabel);
+	mainLayout->addWidget(this->summaryLabel);
+	mainLayout->addWidget(this->overlayCheckBox);
+	mainLayout->addLayout(buttonsLayout);
+
+	this->refreshSummary();
+}
+
+void SimulatorCoverageViewer::overlayCheckBoxToggled(bool checked)
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	machineSimulator->setCoverageOverlayEnabled(checked);
+}
+
+void SimulatorCoverageViewer::buttonClearClicked()
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	machineSimulator->clearCoverage();
+}
+
+void SimulatorCoverageViewer::buttonExportClicked()
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	QString filePath = QFileDialog::getSaveFileName(this, tr("Export coverage"), fsm->getName() + "_coverage.csv", "*.csv");
+	if (filePath.isEmpty() == true) return;
+
+
+	if (filePath.endsWith(".csv", Qt::CaseInsensitive) == false)
+	{
+		filePath += ".csv";
+	}
+
+	if (machineSimulator->getCoverage().exportToCsv(filePath, fsm) == false)
+	{
+		ContextMenu* menu = ContextMenu::createErrorMenu(tr("Unable to write file"));
+		menu->popup(this->buttonExport->mapToGlobal(QPoint(this->buttonExport->width(), -menu->sizeHint().height())));
+	}
+}
+
+void SimulatorCoverageViewer::coverageChangedEventHandler()
+{
+	if (this->summaryRefreshPending == true) return;
+
+
+	this->summaryRefreshPending = true;
+	QTimer::singleShot(SimulatorCoverageViewer::summaryRefreshPeriod, this, &SimulatorCoverageViewer::refreshSummary);
+}
+
+void SimulatorCoverageViewer::refreshSummary()
+{
+	this->summaryRefreshPending = false;
+
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	const auto& coverage = machineSimulator->getCoverage();
+
+	QString text;
+	text += tr("States visited:")     + " " + QString::number(coverage.getCoveredStatesCount())      + " / " + QString::number(coverage.getStatesCount())      + "<br />";
+	text += tr("Transitions crossed:") + " " + QString::number(coverage.getCoveredTransitionsCount()) + " / " + QString::number(coverage.getTransitionsCount()) + "<br />";
+	if (machineSimulator->getTermsCoverageSupported() == true)
+	{
+		text += tr("Conditions terms seen both true and false:") + " " + QString::number(coverage.getCoveredTermsCount()) + " / " + QString::number(coverage.getTermsCount());
+	}
+	else
+	{
+		text += tr("Conditions terms coverage is not available for machines with values larger than 64 bits.");
+	}
+
+	this->summaryLabel->setText(text);
+}
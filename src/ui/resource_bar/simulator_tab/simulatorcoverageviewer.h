@@ -0,0 +1,70 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SIMULATORCOVERAGEVIEWER_H
+#define SIMULATORCOVERAGEVIEWER_H
+
+// Parent
+#include <QWidget>
+
+// Qt classes
+class QLabel;
+class QCheckBox;
+class QPushButton;
+
+
+class SimulatorCoverageViewer : public QWidget
+{
+	Q_OBJECT
+
+	/////
+	// Static variables
+private:
+	// Minimum delay between two refreshes of the summary (ms)
+	static const int summaryRefreshPeriod = 100;
+
+	/////
+	// Constructors/destructors
+public:
+	explicit SimulatorCoverageViewer(QWidget* parent = nullptr);
+
+	/////
+	// Object functions
+private slots:
+	void overlayCheckBoxToggled(bool checked);
+	void buttonClearClicked();
+	void buttonExportClicked();
+
+	void coverageChangedEventHandler();
+	void refreshSummary();
+
+	/////
+	// Object variables
+private:
+	QLabel*      summaryLabel    = nullptr;
+	QCheckBox*   overlayCheckBox = nullptr;
+	QPushButton* buttonExport    = nullptr;
+
+	bool summaryRefreshPending = false;
+
+};
+
+#endif // SIMULATORCOVERAGEVIEWER_H
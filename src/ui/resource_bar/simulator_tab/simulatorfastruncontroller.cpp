@@ -0,0 +1,242 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Current class header
+#include "simulatorfastruncontroller.h"
+
+// Qt classes
+#include <QLabel>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <QLineEdit>
+#include <QCheckBox>
+#include <QComboBox>
+
+// StateS classes
+#include "machinemanager.h"
+#include "machinesimulator.h"
+#include "fsm.h"
+#include "fsmstate.h"
+#include "variable.h"
+#include "logicvalue.h"
+
+
+SimulatorFastRunController::SimulatorFastRunController(QWidget* parent) :
+	QWidget(parent)
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	auto mainLayout = new QVBoxLayout();
+	this->setLayout(mainLayout);
+
+	auto runLabel = new QLabel(tr("Or run the simulation as fast as possible, until:"));
+	runLabel->setWordWrap(true);
+
+	// Stop conditions
+	auto cyclesLayout = new QHBoxLayout();
+	this->stopOnCycles = new QCheckBox(tr("Steps count reaches"));
+	this->stopOnCycles->setChecked(true);
+	this->cyclesValue = new QLineEdit("1000000");
+	cyclesLayout->addWidget(this->stopOnCycles);
+	cyclesLayout->addWidget(this->cyclesValue);
+
+	auto stateLayout = new QHBoxLayout();
+	this->stopOnState = new QCheckBox(tr("State is reached"));
+	this->stateSelector = new QComboBox();
+	for (const auto& stateId : fsm->getAllStatesIds())
+	{
+		auto state = fsm->getState(stateId);
+		if (state == nullptr) continue;
+
+
+		this->stateSelector->addItem(state->getName(), QVariant::fromValue(stateId));
+	}
+	stateLayout->addWidget(this->stopOnState);
+	stateLayout->addWidget(this->stateSelector);
+
+	auto variableLayout = new QHBoxLayout();
+	this->stopOnVariable = new QCheckBox(tr("Variable"));
+	this->variableSelector = new QComboBox();
+	auto variablesIds = fsm->getOutputVariablesIds();
+	variablesIds += fsm->getInternalVariablesIds();
+	for (const auto& variableId : variablesIds)
+	{
+		auto variable = fsm->getVariable(variableId);
+		if (variable == nullptr) continue;
+
+
+		this->variableSelector->addItem(variable->getName(), QVariant::fromValue(variableId));
+	}
+	auto variableEqualsLabel = new QLabel(tr("equals"));
+	this->variableValue = new QLineEdit("1");
+	variableLayout->addWidget(this->stopOnVariable);
+	variableLayout->addWidget(this->variableSelector);
+	variableLayout->addWidget(variableEqualsLabel);
+	variableLayout->addWidget(this->variableValue);
+
+	auto conflictLabel = new QLabel("<i>" + tr("Simulation also stops when multiple transitions can be crossed.") + "</i>");
+	conflictLabel->setWordWrap(true);
+
+	this->buttonRun = new QPushButton(">>> " + tr("Run as fast as possible") + " >>>");
+	this->buttonRun->setCheckable(true);
+
+	this->statusLabel = new QLabel();
+	this->statusLabel->setWordWrap(true);
+
+	connect(this->buttonRun, &QPushButton::clicked, this, &SimulatorFastRunController::buttonRunClicked);
+
+	connect(machineSimulator.get(), &MachineSimulator::fastSimulationToggledEvent,  this, &SimulatorFastRunController::fastSimulationToggledEventHandler);
+	connect(machineSimulator.get(), &MachineSimulator::fastSimulationProgressEvent, this, &SimulatorFastRunController::fastSimulationProgressEventHandler);
+	connect(machineSimulator.get(), &MachineSimulator::fastSimulationEndedEvent,    this, &SimulatorFastRunController::fastSimulationEndedEventHandler);
+
+	mainLayout->addWidget(runLabel);
+	mainLayout->addLayout(cyclesLayout);
+	mainLayout->addLayout(stateLayout);
+	mainLayout->addLayout(variableLayout);
+	mainLayout->addWidget(conflictLabel);
+	mainLayout->addWidget(this->buttonRun);
+	mainLayout->addWidget(this->statusLabel);
+}
+
+void SimulatorFastRunController::buttonRunClicked()
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	if (this->buttonRun->isChecked() == false)
+	{
+		machineSimulator->suspend();
+		return;
+	}
+
+
+	quint64 maxCycles = 0;
+	if (this->stopOnCycles->isChecked() == true)
+	{
+		maxCycles = this->cyclesValue->text().toULongLong();
+	}
+
+	componentId_t stopStateId = nullId;
+	if ( (this->stopOnState->isChecked() == true) && (this->stateSelector->currentIndex() >= 0) )
+	{
+		stopStateId = this->stateSelector->currentData().value<componentId_t>();
+	}
+
+	componentId_t stopVariableId = nullId;
+	LogicValue stopVariableValue;
+	if ( (this->stopOnVariable->isChecked() == true) && (this->variableSelector->currentIndex() >= 0) )
+	{
+		stopVariableId = this->variableSelector->currentData().value<componentId_t>();
+		stopVariableValue = LogicValue::fromString(this->variableValue->text());
+
+		auto variable = machineManager->getMachine()->getVariable(stopVariableId);
+		if ( (variable == nullptr) || (variable->getSize() != stopVariableValue.getSize()) )
+		{
+			this->buttonRun->setChecked(false);
+			this->statusLabel->setText(tr("Variable value must be a binary value of the variable size."));
+			return;
+		}
+	}
+
+	if ( (maxCycles == 0) && (stopStateId == nullId) && (stopVariableId == nullId) )
+	{
+		this->buttonRun->setChecked(false);
+		this->statusLabel->setText(tr("Select at least one stop condition."));
+		return;
+	}
+
+	this->statusLabel->clear();
+	machineSimulator->startFastSimulation(maxCycles, stopStateId, stopVariableId, stopVariableValue);
+
+	// If simulation could not be started
+	if (machineSimulator->isFastSimulationRunning() == false)
+	{
+		this->buttonRun->setChecked(false);
+	}
+}
+
+void SimulatorFastRunController::fastSimulationToggledEventHandler(bool started)
+{
+	this->buttonRun->setChecked(started);
+	this->stopOnCycles->setEnabled(!started);
+	this->cyclesValue->setEnabled(!started);
+	this->stopOnState->setEnabled(!started);
+	this->stateSelector->setEnabled(!started);
+	this->stopOnVariable->setEnabled(!started);
+	this->variableSelector->setEnabled(!started);
+	this->variableValue->setEnabled(!started);
+
+	if (started == true)
+	{
+		this->buttonRun->setText(tr("Stop"));
+	}
+	else
+	{
+		this->buttonRun->setText(">>> " + tr("Run as fast as possible") + " >>>");
+	}
+}
+
+void SimulatorFastRunController::fastSimulationProgressEventHandler(quint64 cycles)
+{
+	this->statusLabel->setText(QString::number(cycles) + " " + tr("steps done"));
+}
+
+void SimulatorFastRunController::fastSimulationEndedEventHandler(FastSimulationStopReason_t reason, quint64 cycles, qint64 elapsedTime)
+{
+	QString reasonText;
+	switch (reason)
+	{
+	case FastSimulationStopReason_t::userRequest:
+		reasonText = tr("Stopped by user.");
+		break;
+	case FastSimulationStopReason_t::cycleCountReached:
+		reasonText = tr("Steps count reached.");
+		break;
+	case FastSimulationStopReason_t::stateReached:
+		reasonText = tr("State reached.");
+		break;
+	case FastSimulationStopReason_t::variableValueReached:
+		reasonText = tr("Variable value reached.");
+		break;
+	case FastSimulationStopReason_t::breakpointHit:
+		reasonText = tr("Breakpoint reached.");
+		break;
+	case FastSimulationStopReason_t::transitionConflict:
+		reasonText = tr("Multiple transitions can be crossed: do one step to select which one to follow.");
+		break;
+	case FastSimulationStopReason_t::unsupportedMachine:
+		this->statusLabel->setText(tr("This machine uses values larger than 64 bits, which is not supported by fast simulation."));
+		return;
+		break;
+	case FastSimulationStopReason_t::noActiveState:
+		this->statusLabel->setText(tr("The machine has no active state: fast simulation can not start."));
+		return;
+		break;
+	}
+
+	this->statusLabel->setText(reasonText + "<br />" + QString::number(cycles) + " " + tr("steps done in") + " " + QString::number(elapsedTime / 1000.0) + " " + tr("second(s)"));
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright © 2026 Clément Foucher
+ *
+ * Distributed under the GNU GPL v2. For full terms see the file LICENSE.txt.
+ *
+ *
+ * This file is part of StateS.
+ *
+ * StateS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, version 2 of the License.
+ *
+ * StateS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SIMULATORFASTRUNCONTROLLER_H
+#define SIMULATORFASTRUNCONTROLLER_H
+
+// Parent
+#include <QWidget>
+
+// Qt classes
+class QPushButton;
+class QLineEdit;
+class QCheckBox;
+class QComboBox;
+class QLabel;
+
+// StateS classes
+#include "statestypes.h"
+
+
+class SimulatorFastRunController : public QWidget
+{
+	Q_OBJECT
+
+	/////
+	// Constructors/destructors
+public:
+	explicit SimulatorFastRunController(QWidget* parent = nullptr);
+
+	/////
+	// Object functions
+private slots:
+	void buttonRunClicked();
+
+	void fastSimulationToggledEventHandler(bool started);
+	void fastSimulationProgressEventHandler(quint64 cycles);
+	void fastSimulationEndedEventHandler(FastSimulationStopReason_t reason, quint64 cycles, qint64 elapsedTime);
+
+	/////
+	// Object variables
+private:
+	QPushButton* buttonRun        = nullptr;
+	QCheckBox*   stopOnCycles     = nullptr;
+	QLineEdit*   cyclesValue      = nullptr;
+	QCheckBox*   stopOnState      = nullptr;
+	QComboBox*   stateSelector    = nullptr;
+	QCheckBox*   stopOnVariable   = nullptr;
+	QComboBox*   variableSelector = nullptr;
+	QLineEdit*   variableValue    = nullptr;
+	QLabel*      statusLabel      = nullptr;
+
+};
+
+#endif // SIMULATORFASTRUNCONTROLLER_H
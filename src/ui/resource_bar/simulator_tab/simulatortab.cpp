@@ -35,7 +35,11 @@
 #include "contextmenu.h"
 #include "simulatorconfigurator.h"
 #include "simulatortimecontroller.h"
+#include "simulatorfastruncontroller.h"
+#include "simulatorbreakpointseditor.h"
+#include "simulatorcoverageviewer.h"
 #include "inputsselector.h"
+#include "multiinstancesimulationdialog.h"
 
 
 SimulatorTab::SimulatorTab(QWidget* parent) :
@@ -66,6 +70,10 @@ SimulatorTab::SimulatorTab(QWidget* parent) :
 
 	this->simulatorConfigurator = new SimulatorConfigurator();
 	configurationLayout->addWidget(this->simulatorConfigurator);
+
+	auto buttonMultiInstance = new QPushButton(tr("Multi-instance simulation…"));
+	connect(buttonMultiInstance, &QPushButton::clicked, this, &SimulatorTab::openMultiInstanceSimulation);
+	configurationLayout->addWidget(buttonMultiInstance);
 }
 
 SimulatorTab::~SimulatorTab()
@@ -113,9 +121,32 @@ void SimulatorTab::triggerSimulationMode(bool enabled)
 				auto simulationTimeManager = new SimulatorTimeController();
 				timeManagerLayout->addWidget(simulationTimeManager);
 
+				auto simulationFastRunController = new SimulatorFastRunController();
+				timeManagerLayout->addWidget(simulationFastRunController);
+
 				this->boxLayout->addWidget(this->timeManagerGroup);
 
 
+				// Build breakpoints editor
+				this->breakpointsGroup = new QGroupBox(tr("Breakpoints and watches"));
+				QVBoxLayout* breakpointsLayout = new QVBoxLayout(this->breakpointsGroup);
+
+				auto breakpointsEditor = new SimulatorBreakpointsEditor();
+				breakpointsLayout->addWidget(breakpointsEditor);
+
+				this->boxLayout->addWidget(this->breakpointsGroup);
+
+
+				// Build coverage viewer
+				this->coverageGroup = new QGroupBox(tr("Coverage"));
+				QVBoxLayout* coverageLayout = new QVBoxLayout(this->coverageGroup);
+
+				auto coverageViewer = new SimulatorCoverageViewer();
+				coverageLayout->addWidget(coverageViewer);
+
+				this->boxLayout->addWidget(this->coverageGroup);
+
+
 				// Build inputs selector
 				this->inputsGroup = new QGroupBox(tr("Inputs"));
 				QVBoxLayout* inputsLayout = new QVBoxLayout(this->inputsGroup);
@@ -124,6 +155,9 @@ void SimulatorTab::triggerSimulationMode(bool enabled)
 				inputsLayout->addWidget(inputList);
 
 				this->boxLayout->addWidget(this->inputsGroup);
+
+				// Inputs are not transmitted to fast simulation while it runs
+				connect(machineSimulator.get(), &MachineSimulator::fastSimulationToggledEvent, this->inputsGroup, &QWidget::setDisabled);
 			}
 			else
 			{
@@ -141,6 +175,12 @@ void SimulatorTab::triggerSimulationMode(bool enabled)
 			delete this->timeManagerGroup;
 			this->timeManagerGroup = nullptr;
 
+			delete this->breakpointsGroup;
+			this->breakpointsGroup = nullptr;
+
+			delete this->coverageGroup;
+			this->coverageGroup = nullptr;
+
 			delete this->inputsGroup;
 			this->inputsGroup = nullptr;
 
@@ -151,3 +191,15 @@ void SimulatorTab::triggerSimulationMode(bool enabled)
 		}
 	}
 }
+
+/**
+ * @brief SimulatorTab::openMultiInstanceSimulation opens the
+ * dialog as a child of the main window, so that it is kept
+ * open when the tab is rebuilt on machine change.
+ */
+void SimulatorTab::openMultiInstanceSimulation()
+{
+	auto dialog = new MultiInstanceSimulationDialog(this->window());
+	dialog->setAttribute(Qt::WA_DeleteOnClose);
+	dialog->show();
+}
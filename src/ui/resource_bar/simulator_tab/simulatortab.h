@@ -48,6 +48,7 @@ public:
 	// Object functions
 private slots:
 	void triggerSimulationMode(bool enabled);
+	void openMultiInstanceSimulation();
 
 	/////
 	// Object variables
@@ -59,6 +60,8 @@ private:
 
 	QGroupBox* configurationGroup = nullptr;
 	QGroupBox* timeManagerGroup   = nullptr;
+	QGroupBox* breakpointsGroup   = nullptr;
+	QGroupBox* coverageGroup      = nullptr;
 	QGroupBox* inputsGroup        = nullptr;
 
 };
@@ -27,10 +27,18 @@
 #include <QPushButton>
 #include <QVBoxLayout>
 #include <QLineEdit>
+#include <QCheckBox>
 
 // StateS classes
 #include "machinemanager.h"
 #include "machinesimulator.h"
+#include "machinestatus.h"
+#include "machine.h"
+#include "simulatedmachine.h"
+#include "simulationhistory.h"
+#include "fsmvhdlexport.h"
+#include "codeexportdialog.h"
+#include "contextmenu.h"
 
 
 SimulatorTimeController::SimulatorTimeController(QWidget* parent) :
@@ -61,16 +69,55 @@ SimulatorTimeController::SimulatorTimeController(QWidget* parent) :
 	autoStepLayout->addWidget(autoStepUnit);
 	autoStepLayout->addWidget(this->buttonTriggerAutoStep);
 
+	auto freezeDisplayLayout = new QHBoxLayout();
+	this->freezeDisplay = new QCheckBox(tr("Do not refresh display when doing one step every less than"));
+	this->freezeDisplay->setChecked(false);
+	this->freezeDisplayValue = new QLineEdit("0.05");
+	auto freezeDisplayUnit = new QLabel(tr("second(s)"));
+	freezeDisplayLayout->addWidget(this->freezeDisplay);
+	freezeDisplayLayout->addWidget(this->freezeDisplayValue);
+	freezeDisplayLayout->addWidget(freezeDisplayUnit);
+
+	auto historyLabel = new QLabel(tr("Previous steps can be restored:"));
+	historyLabel->setWordWrap(true);
+
+	this->currentStepLabel = new QLabel();
+
+	this->buttonStepBack = new QPushButton("< " + tr("Step back") + " <");
+
+	auto goToStepLayout = new QHBoxLayout();
+	auto goToStepText = new QLabel(tr("Go to step"));
+	this->goToStepValue = new QLineEdit("0");
+	this->buttonGoToStep = new QPushButton(tr("Go"));
+	goToStepLayout->addWidget(goToStepText);
+	goToStepLayout->addWidget(this->goToStepValue);
+	goToStepLayout->addWidget(this->buttonGoToStep);
+
+	this->buttonExportTestbench = new QPushButton(tr("Export VHDL testbench…"));
+	this->buttonExportTestbench->setToolTip(tr("Generate a testbench replaying the steps since reset on the exported VHDL"));
+
 	connect(buttonReset,                 &QPushButton::clicked, this, &SimulatorTimeController::buttonResetClicked);
 	connect(this->buttonNextStep,        &QPushButton::clicked, this, &SimulatorTimeController::buttonNextStepClicked);
 	connect(this->buttonTriggerAutoStep, &QPushButton::clicked, this, &SimulatorTimeController::buttonLauchAutoStepClicked);
+	connect(this->buttonStepBack,        &QPushButton::clicked, this, &SimulatorTimeController::buttonStepBackClicked);
+	connect(this->buttonGoToStep,        &QPushButton::clicked, this, &SimulatorTimeController::buttonGoToStepClicked);
+	connect(this->buttonExportTestbench, &QPushButton::clicked, this, &SimulatorTimeController::buttonExportTestbenchClicked);
 
-	connect(machineSimulator.get(), &MachineSimulator::autoSimulationToggledEvent, this, &SimulatorTimeController::autoSimulationToggledEventHandler);
+	connect(machineSimulator.get(), &MachineSimulator::autoSimulationToggledEvent,  this, &SimulatorTimeController::autoSimulationToggledEventHandler);
+	connect(machineSimulator.get(), &MachineSimulator::simulationCycleChangedEvent, this, &SimulatorTimeController::simulationCycleChangedEventHandler);
 
 	mainLayout->addWidget(buttonReset);
 	mainLayout->addWidget(stepLabel);
 	mainLayout->addWidget(this->buttonNextStep);
 	mainLayout->addLayout(autoStepLayout);
+	mainLayout->addLayout(freezeDisplayLayout);
+	mainLayout->addWidget(historyLabel);
+	mainLayout->addWidget(this->currentStepLabel);
+	mainLayout->addWidget(this->buttonStepBack);
+	mainLayout->addLayout(goToStepLayout);
+	mainLayout->addWidget(this->buttonExportTestbench);
+
+	this->simulationCycleChangedEventHandler(machineSimulator->getCurrentCycle(), machineSimulator->getLastCycle());
 }
 
 void SimulatorTimeController::buttonResetClicked()
@@ -99,6 +146,15 @@ void SimulatorTimeController::buttonLauchAutoStepClicked()
 
 	if (this->buttonTriggerAutoStep->isChecked())
 	{
+		if (this->freezeDisplay->isChecked() == true)
+		{
+			machineSimulator->setDisplayFreezePeriod(this->freezeDisplayValue->text().toFloat() * 1000);
+		}
+		else
+		{
+			machineSimulator->setDisplayFreezePeriod(0);
+		}
+
 		float value = this->autoStepValue->text().toFloat() * 1000;
 		if (value != 0)
 		{
@@ -115,6 +171,98 @@ void SimulatorTimeController::buttonLauchAutoStepClicked()
 	}
 }
 
+void SimulatorTimeController::buttonStepBackClicked()
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	machineSimulator->stepBack();
+}
+
+void SimulatorTimeController::buttonGoToStepClicked()
+{
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+
+	bool ok;
+	quint64 step = this->goToStepValue->text().toULongLong(&ok);
+	if (ok == false) return;
+
+
+	machineSimulator->goToCycle(step);
+}
+
+void SimulatorTimeController::buttonExportTestbenchClicked()
+{
+	auto machine = machineManager->getMachine();
+	if (machine == nullptr) return;
+
+
+	shared_ptr<MachineStatus> machineStatus = machineManager->getMachineStatus();
+
+	this->testbenchExportDialog = new CodeExportDialog(machine->getName(), machineStatus->getVhdlExportPath(), true, this);
+	connect(this->testbenchExportDialog, &CodeExportDialog::finished, this, &SimulatorTimeController::testbenchExportDialogClosedEventHandler);
+
+	this->testbenchExportDialog->open();
+}
+
+/**
+ * @brief SimulatorTimeController::testbenchExportDialogClosedEventHandler
+ * writes the testbench for the steps done since reset. Pulse actions on
+ * transitions are registered in the VHDL if the simulator applies them
+ * when the transition is crossed.
+ */
+void SimulatorTimeController::testbenchExportDialogClosedEventHandler(int result)
+{
+	if (this->testbenchExportDialog == nullptr) return;
+
+	auto machineSimulator = machineManager->getMachineSimulator();
+	if (machineSimulator == nullptr) return;
+
+	auto simulatedMachine = machineSimulator->getSimulatedMachine();
+	if (simulatedMachine == nullptr) return;
+
+
+	if (result == QDialog::Accepted)
+	{
+		QString errorText;
+
+		FsmVhdlExport exporter;
+
+		bool registerMealyOutputs = (simulatedMachine->getPulseTransitionActionBehavior() == SimulationBehavior_t::immediately);
+		exporter.setOptions(this->testbenchExportDialog->isResetPositive(), this->testbenchExportDialog->prefixIOs(), HdlStateEncoding_t::symbolic, registerMealyOutputs);
+
+		SimulationHistory::Trace_t trace;
+		if (exporter.matchesSimulationBehavior() == false)
+		{
+			errorText = tr("Simulation actions behavior does not match the VHDL export.");
+		}
+		else if ( (machineSimulator->getHistory()->extractTrace(trace) == false) || (trace.stepsInputs.isEmpty() == true) )
+		{
+			errorText = tr("No step done since reset can be replayed.");
+		}
+		else
+		{
+			QString filePath = this->testbenchExportDialog->getFilePath();
+			if (exporter.writeTestbenchToFile(filePath, trace) == false)
+			{
+				errorText = tr("Unable to write file");
+			}
+		}
+
+		if (errorText.isEmpty() == false)
+		{
+			ContextMenu* menu = ContextMenu::createErrorMenu(errorText);
+			menu->popup(this->buttonExportTestbench->mapToGlobal(QPoint(this->buttonExportTestbench->width(), -menu->sizeHint().height())));
+		}
+	}
+
+	delete this->testbenchExportDialog;
+	this->testbenchExportDialog = nullptr;
+}
+
 void SimulatorTimeController::autoSimulationToggledEventHandler(bool started)
 {
 	if (started == true)
@@ -123,6 +271,12 @@ void SimulatorTimeController::autoSimulationToggledEventHandler(bool started)
 		this->buttonTriggerAutoStep->setChecked(true);
 		this->buttonNextStep->setEnabled(false);
 		this->autoStepValue->setEnabled(false);
+		this->freezeDisplay->setEnabled(false);
+		this->freezeDisplayValue->setEnabled(false);
+		this->buttonStepBack->setEnabled(false);
+		this->goToStepValue->setEnabled(false);
+		this->buttonGoToStep->setEnabled(false);
+		this->buttonExportTestbench->setEnabled(false);
 	}
 	else
 	{
@@ -130,5 +284,16 @@ void SimulatorTimeController::autoSimulationToggledEventHandler(bool started)
 		this->buttonTriggerAutoStep->setChecked(false);
 		this->buttonNextStep->setEnabled(true);
 		this->autoStepValue->setEnabled(true);
+		this->freezeDisplay->setEnabled(true);
+		this->freezeDisplayValue->setEnabled(true);
+		this->buttonStepBack->setEnabled(true);
+		this->goToStepValue->setEnabled(true);
+		this->buttonGoToStep->setEnabled(true);
+		this->buttonExportTestbench->setEnabled(true);
 	}
 }
+
+void SimulatorTimeController::simulationCycleChangedEventHandler(quint64 currentCycle, quint64 lastCycle)
+{
+	this->currentStepLabel->setText(tr("Current step:") + " " + QString::number(currentCycle) + " / " + QString::number(lastCycle));
+}
@@ -28,6 +28,11 @@
 // Qt classes
 class QPushButton;
 class QLineEdit;
+class QCheckBox;
+class QLabel;
+
+// StateS classes
+class CodeExportDialog;
 
 
 class SimulatorTimeController : public QWidget
@@ -45,7 +50,12 @@ private slots:
 	void buttonResetClicked();
 	void buttonNextStepClicked();
 	void buttonLauchAutoStepClicked();
+	void buttonStepBackClicked();
+	void buttonGoToStepClicked();
+	void buttonExportTestbenchClicked();
+	void testbenchExportDialogClosedEventHandler(int result);
 	void autoSimulationToggledEventHandler(bool started);
+	void simulationCycleChangedEventHandler(quint64 currentCycle, quint64 lastCycle);
 
 	/////
 	// Object variables
@@ -53,6 +63,15 @@ private:
 	QPushButton* buttonTriggerAutoStep = nullptr;
 	QPushButton* buttonNextStep        = nullptr;
 	QLineEdit*   autoStepValue         = nullptr;
+	QCheckBox*   freezeDisplay         = nullptr;
+	QLineEdit*   freezeDisplayValue    = nullptr;
+	QPushButton* buttonStepBack        = nullptr;
+	QLineEdit*   goToStepValue         = nullptr;
+	QPushButton* buttonGoToStep        = nullptr;
+	QLabel*      currentStepLabel      = nullptr;
+	QPushButton* buttonExportTestbench = nullptr;
+
+	CodeExportDialog* testbenchExportDialog = nullptr;
 
 };
 
@@ -27,7 +27,6 @@
 #include <QVBoxLayout>
 #include <QListWidget>
 #include <QLabel>
-#include <QCheckBox>
 
 // StateS classes
 #include "machinemanager.h"
@@ -35,6 +34,15 @@
 #include "hintwidget.h"
 #include "truthtable.h"
 #include "fsmverifier.h"
+#include "fsmstatespaceexplorer.h"
+#include "statespaceexplorationrunner.h"
+#include "fsmminimizer.h"
+#include "propertycheckerwidget.h"
+#include "randomregressiondialog.h"
+#include "fsm.h"
+#include "fsmstate.h"
+#include "variable.h"
+#include "simulatedfsm.h"
 
 
 VerifierTab::VerifierTab(QWidget* parent) :
@@ -49,13 +57,28 @@ VerifierTab::VerifierTab(QWidget* parent) :
 	title->setAlignment(Qt::AlignCenter);
 	layout->addWidget(title);
 
-	QCheckBox* checkVhdlExport = new QCheckBox(tr("Check for VHDL export restrictions"), this);
-	connect(checkVhdlExport, &QCheckBox::clicked, this, &VerifierTab::setCheckVhdl);
-	layout->addWidget(checkVhdlExport);
-
 	QPushButton* buttonVerify = new QPushButton(tr("Check machine"), this);
 	connect(buttonVerify, &QPushButton::clicked, this, &VerifierTab::checkNow);
 	layout->addWidget(buttonVerify);
+
+	this->buttonExplore = new QPushButton(tr("Explore reachable states"), this);
+	connect(this->buttonExplore, &QPushButton::clicked, this, &VerifierTab::exploreNow);
+	layout->addWidget(this->buttonExplore);
+
+	QPushButton* buttonMinimize = new QPushButton(tr("Find equivalent states"), this);
+	connect(buttonMinimize, &QPushButton::clicked, this, &VerifierTab::findEquivalentStates);
+	layout->addWidget(buttonMinimize);
+
+	QPushButton* buttonRegression = new QPushButton(tr("Random regression…"), this);
+	connect(buttonRegression, &QPushButton::clicked, this, &VerifierTab::openRandomRegression);
+	layout->addWidget(buttonRegression);
+
+	layout->addWidget(new PropertyCheckerWidget(this));
+}
+
+VerifierTab::~VerifierTab()
+{
+	// Required for unique_ptr on incomplete type
 }
 
 void VerifierTab::checkNow()
@@ -63,7 +86,7 @@ void VerifierTab::checkNow()
 	this->clearDisplay();
 
 	this->verifier = make_unique<FsmVerifier>();
-	const QList<shared_ptr<FsmVerifier::Issue>>& issues = this->verifier->verifyFsm(this->checkVhdl);
+	const QList<shared_ptr<FsmVerifier::Issue>>& issues = this->verifier->verifyFsm();
 
 	if (issues.count() == 0)
 	{
@@ -144,26 +167,287 @@ void VerifierTab::checkNow()
 	connect(this->buttonClear, &QPushButton::clicked, this, &VerifierTab::clearDisplay);
 }
 
+/**
+ * @brief VerifierTab::exploreNow computes all the configurations
+ * reachable from the initial state, and reports unreachable states,
+ * deadlocks, conflicts and reachable outputs combinations.
+ * Exploration is run in a worker thread, and can be stopped.
+ */
+void VerifierTab::exploreNow()
+{
+	if (this->explorationRunner != nullptr)
+	{
+		this->explorationRunner->requestStop();
+		return;
+	}
+
+
+	this->clearDisplay();
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	// Use simulation actions behaviors if simulating
+	auto simulatedFsm = dynamic_pointer_cast<SimulatedFsm>(machineManager->getSimulatedMachine());
+
+	this->explorer = make_shared<FsmStateSpaceExplorer>(fsm, simulatedFsm);
+	this->explorationRunner = make_unique<StateSpaceExplorationRunner>(this->explorer);
+	connect(this->explorationRunner.get(), &StateSpaceExplorationRunner::progressEvent,    this, &VerifierTab::explorationProgressEventHandler);
+	connect(this->explorationRunner.get(), &StateSpaceExplorationRunner::runFinishedEvent, this, &VerifierTab::explorationFinishedEventHandler);
+
+	this->listTitle = new QLabel(tr("Exploring reachable states…"), this);
+	this->listTitle->setWordWrap(true);
+	this->layout()->addWidget(this->listTitle);
+
+	this->buttonExplore->setText(tr("Stop exploration"));
+
+	this->explorationRunner->start();
+}
+
+void VerifierTab::explorationProgressEventHandler(uint configurationsCount, uint depth)
+{
+	if (this->explorationRunner == nullptr) return;
+
+	if (this->listTitle == nullptr) return;
+
+
+	this->listTitle->setText(tr("Exploring reachable states…") + " " + QString::number(configurationsCount) + " " + tr("configurations found in") + " " + QString::number(depth) + " " + tr("steps."));
+}
+
+void VerifierTab::explorationFinishedEventHandler()
+{
+	if (this->explorationRunner == nullptr) return;
+
+	if (this->explorationRunner->isFinished() == false) return;
+
+
+	this->explorationRunner.reset();
+	this->buttonExplore->setText(tr("Explore reachable states"));
+
+	this->displayExplorationReport();
+}
+
+void VerifierTab::displayExplorationReport()
+{
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	const auto& report = this->explorer->getReport();
+	auto status = report.status;
+
+	switch (status)
+	{
+	case ExplorationStatus_t::complete:
+		this->listTitle->setText(tr("Exploration complete:") + " " + QString::number(this->explorer->getConfigurationsCount()) + " " + tr("reachable configurations, reached in at most") + " " + QString::number(report.depth) + " " + tr("steps."));
+		break;
+	case ExplorationStatus_t::configurationsLimitReached:
+		this->listTitle->setText(tr("Exploration stopped after") + " " + QString::number(this->explorer->getConfigurationsCount()) + " " + tr("configurations: results are partial."));
+		break;
+	case ExplorationStatus_t::stopped:
+		this->listTitle->setText(tr("Exploration stopped on user request."));
+		break;
+	case ExplorationStatus_t::tooManyInputs:
+		this->listTitle->setText(tr("Exploration is limited to machines with at most") + " " + QString::number(FsmStateSpaceExplorer::maxInputsBits) + " " + tr("input bits."));
+		break;
+	case ExplorationStatus_t::unsupportedMachine:
+		this->listTitle->setText(tr("Exploration is not available for this machine (variables larger than 64 bits or no initial state)."));
+		break;
+	}
+
+	if ( (status == ExplorationStatus_t::complete) || (status == ExplorationStatus_t::configurationsLimitReached) )
+	{
+		this->list = new QListWidget(this);
+		this->list->setWordWrap(true);
+		this->layout()->addWidget(this->list);
+
+		for (const auto& stateId : report.unreachableStates)
+		{
+			auto state = fsm->getState(stateId);
+			if (state == nullptr) continue;
+
+
+			this->list->addItem(tr("State") + " " + state->getName() + " " + tr("is unreachable."));
+			this->list->item(this->list->count()-1)->setForeground(QBrush(Qt::blue));
+		}
+
+		for (const auto& stateId : report.deadlockStates)
+		{
+			auto state = fsm->getState(stateId);
+			if (state == nullptr) continue;
+
+
+			this->list->addItem(tr("A deadlock can be reached in state") + " " + state->getName() + tr(": no input can make the machine evolve anymore."));
+			this->list->item(this->list->count()-1)->setForeground(QBrush(Qt::red));
+		}
+
+		for (const auto& stateId : report.conflictStates)
+		{
+			auto state = fsm->getState(stateId);
+			if (state == nullptr) continue;
+
+
+			this->list->addItem(tr("Multiple transitions can be crossable at the same time from state") + " " + state->getName() + ".");
+			this->list->item(this->list->count()-1)->setForeground(QBrush(Qt::red));
+		}
+
+		this->list->addItem(QString::number(report.outputsCombinations.count()) + " " + tr("reachable outputs combinations:"));
+		for (const auto& outputsValues : report.outputsCombinations)
+		{
+			QString text;
+			for (int i = 0 ; i < report.outputsIds.count() ; i++)
+			{
+				auto output = fsm->getVariable(report.outputsIds.at(i));
+				if (output == nullptr) continue;
+
+
+				if (text.isEmpty() == false)
+				{
+					text += ", ";
+				}
+				text += output->getName() + " = " + FsmSimulationEngine::unpackValue(outputsValues.at(i), output->getSize()).toString();
+			}
+			this->list->addItem("    " + text);
+		}
+	}
+
+	this->buttonClear = new QPushButton(tr("Clear verification"), this);
+	this->layout()->addWidget(this->buttonClear);
+	connect(this->buttonClear, &QPushButton::clicked, this, &VerifierTab::clearDisplay);
+}
+
+void VerifierTab::openRandomRegression()
+{
+	auto dialog = new RandomRegressionDialog(this);
+	dialog->setAttribute(Qt::WA_DeleteOnClose);
+	dialog->open();
+}
+
+/**
+ * @brief VerifierTab::findEquivalentStates lists the groups of
+ * states behaving identically, which can be merged to obtain a
+ * smaller machine with the same behavior.
+ */
+void VerifierTab::findEquivalentStates()
+{
+	this->clearDisplay();
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	this->minimizer = make_unique<FsmMinimizer>(fsm);
+	this->minimizer->computeEquivalentStates();
+
+	const auto& equivalentStates = this->minimizer->getEquivalentStates();
+
+	this->listTitle = new QLabel(this);
+	this->listTitle->setWordWrap(true);
+	this->layout()->addWidget(this->listTitle);
+
+	if (equivalentStates.isEmpty() == true)
+	{
+		this->listTitle->setText(tr("No equivalent states found."));
+		this->listTitle->setAlignment(Qt::AlignCenter);
+	}
+	else
+	{
+		this->listTitle->setText(tr("The following states are equivalent:"));
+
+		this->list = new QListWidget(this);
+		this->list->setWordWrap(true);
+		this->layout()->addWidget(this->list);
+
+		for (const auto& group : equivalentStates)
+		{
+			QStringList statesNames;
+			for (const auto& stateId : group)
+			{
+				auto state = fsm->getState(stateId);
+				if (state == nullptr) continue;
+
+
+				statesNames.append(state->getName());
+			}
+
+			this->list->addItem(statesNames.join(", ") + " " + tr("can be merged into") + " " + statesNames.first() + ".");
+		}
+
+		this->buttonMerge = new QPushButton(tr("Merge equivalent states"), this);
+		this->buttonMerge->setEnabled(machineManager->getCurrentSimulationMode() == SimulationMode_t::editMode);
+		connect(this->buttonMerge, &QPushButton::clicked, this, &VerifierTab::mergeEquivalentStates);
+		this->layout()->addWidget(this->buttonMerge);
+	}
+
+	this->buttonClear = new QPushButton(tr("Clear verification"), this);
+	this->layout()->addWidget(this->buttonClear);
+	connect(this->buttonClear, &QPushButton::clicked, this, &VerifierTab::clearDisplay);
+}
+
+/**
+ * @brief VerifierTab::mergeEquivalentStates merges the groups
+ * displayed. Machine may have been edited since they were found:
+ * in that case, groups are displayed again instead of merged.
+ */
+void VerifierTab::mergeEquivalentStates()
+{
+	if (this->minimizer == nullptr) return;
+
+	if (machineManager->getCurrentSimulationMode() != SimulationMode_t::editMode) return;
+
+	auto fsm = dynamic_pointer_cast<Fsm>(machineManager->getMachine());
+	if (fsm == nullptr) return;
+
+
+	auto currentMinimizer = make_unique<FsmMinimizer>(fsm);
+	currentMinimizer->computeEquivalentStates();
+
+	if (currentMinimizer->getEquivalentStates() != this->minimizer->getEquivalentStates())
+	{
+		this->findEquivalentStates();
+		return;
+	}
+
+
+	// Machine is about to be edited
+	machineManager->notifyMachineAboutToBeDiffEdited();
+
+	currentMinimizer->mergeEquivalentStates();
+
+	// Machine has been edited: display is cleared on machine update
+	machineManager->notifyMachineRestructured();
+}
+
 void VerifierTab::clearDisplay()
 {
+	// Exploration results would not match the machine anymore
+	if (this->explorationRunner != nullptr)
+	{
+		this->explorationRunner->requestStop();
+		this->explorationRunner->wait();
+
+		this->explorationRunner.reset();
+		this->buttonExplore->setText(tr("Explore reachable states"));
+	}
+
 	delete this->listTitle;
 	delete this->list;
 	delete this->truthTableDisplay;
 	delete this->buttonClear;
+	delete this->buttonMerge;
 	delete this->hintBox;
 
 	this->listTitle         = nullptr;
 	this->list              = nullptr;
 	this->truthTableDisplay = nullptr;
 	this->buttonClear       = nullptr;
+	this->buttonMerge       = nullptr;
 	this->hintBox           = nullptr;
 
 	this->verifier.reset();
-}
-
-void VerifierTab::setCheckVhdl(bool doCheck)
-{
-	this->checkVhdl = doCheck;
+	this->explorer.reset();
+	this->minimizer.reset();
 }
 
 void VerifierTab::proofRequested(QListWidgetItem* item)
@@ -179,7 +463,9 @@ void VerifierTab::proofRequested(QListWidgetItem* item)
 		QList<int> highlights                    = issues[this->list->row(item)]->proofsHighlight;
 
 		this->truthTableDisplay = new TruthTableDisplay(currentTruthTable, highlights);
-		((QVBoxLayout*)this->layout())->insertWidget(5, this->truthTableDisplay);
+		// Display truth table right below the issues list
+		QVBoxLayout* layout = (QVBoxLayout*)this->layout();
+		layout->insertWidget(layout->indexOf(this->list) + 1, this->truthTableDisplay);
 
 		QString text = tr("Lines highlighted in red in the truth table are conflicts resulting in multiple simultaneous transitions being activated.");
 
@@ -37,6 +37,9 @@ class QPushButton;
 
 // StateS classes
 #include "fsmverifier.h"
+class FsmStateSpaceExplorer;
+class StateSpaceExplorationRunner;
+class FsmMinimizer;
 class TruthTableDisplay;
 class HintWidget;
 
@@ -49,26 +52,38 @@ class VerifierTab : public QWidget
 	// Constructors/destructors
 public:
 	explicit VerifierTab(QWidget* parent = nullptr);
+	~VerifierTab();
 
 	/////
 	// Object functions
 private slots:
 	void checkNow();
+	void exploreNow();
+	void explorationProgressEventHandler(uint configurationsCount, uint depth);
+	void explorationFinishedEventHandler();
+	void openRandomRegression();
+	void findEquivalentStates();
+	void mergeEquivalentStates();
 	void clearDisplay();
-	void setCheckVhdl(bool doCheck);
 
 	void proofRequested(QListWidgetItem* item);
 
+private:
+	void displayExplorationReport();
+
 	/////
 	// Object variables
 private:
 	unique_ptr<FsmVerifier> verifier;
+	shared_ptr<FsmStateSpaceExplorer> explorer;
+	unique_ptr<StateSpaceExplorationRunner> explorationRunner;
+	unique_ptr<FsmMinimizer> minimizer;
 
-	bool checkVhdl = false;
-
+	QPushButton*       buttonExplore     = nullptr;
 	QLabel*            listTitle         = nullptr;
 	QListWidget*       list              = nullptr;
 	QPushButton*       buttonClear       = nullptr;
+	QPushButton*       buttonMerge       = nullptr;
 	TruthTableDisplay* truthTableDisplay = nullptr;
 	HintWidget*        hintBox           = nullptr;
 
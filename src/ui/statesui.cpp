@@ -36,9 +36,11 @@
 #include "maintoolbar.h"
 #include "displayarea.h"
 #include "resourcebar.h"
-#include "vhdlexportdialog.h"
+#include "codeexportdialog.h"
 #include "imageexportdialog.h"
 #include "fsmvhdlexport.h"
+#include "fsmsystemverilogexport.h"
+#include "fsmcppexport.h"
 #include "machinestatus.h"
 #include "machineeditorwidget.h"
 #include "timelinewidget.h"
@@ -99,7 +101,7 @@ StatesUi::StatesUi() :
 	connect(this->toolbar, &MainToolBar::loadRequestedEvent,        this, &StatesUi::beginLoadProcedure);
 	connect(this->toolbar, &MainToolBar::newMachineRequestedEvent,  this, &StatesUi::beginNewMachineProcedure);
 	connect(this->toolbar, &MainToolBar::exportImageRequestedEvent, this, &StatesUi::beginExportImageProcedure);
-	connect(this->toolbar, &MainToolBar::exportCodeRequestedEvent,  this, &StatesUi::beginExportVhdlProcedure);
+	connect(this->toolbar, &MainToolBar::exportCodeRequestedEvent,  this, &StatesUi::beginExportCodeProcedure);
 	connect(this->toolbar, &MainToolBar::undo,                      this, &StatesUi::undo);
 	connect(this->toolbar, &MainToolBar::redo,                      this, &StatesUi::redo);
 
@@ -361,7 +363,7 @@ void StatesUi::beginExportImageProcedure()
 	this->imageExportDialog->open();
 }
 
-void StatesUi::beginExportVhdlProcedure()
+void StatesUi::beginExportCodeProcedure()
 {
 	auto machine = machineManager->getMachine();
 	if (machine == nullptr) return;
@@ -369,12 +371,10 @@ void StatesUi::beginExportVhdlProcedure()
 
 	shared_ptr<MachineStatus> machineStatus = machineManager->getMachineStatus();
 
-	auto exporter = make_shared<FsmVhdlExport>();
+	this->codeExportDialog = new CodeExportDialog(machine->getName(), machineStatus->getVhdlExportPath(), false, this);
+	connect(this->codeExportDialog, &CodeExportDialog::finished, this, &StatesUi::codeExportDialogClosedEventHandler);
 
-	this->vhdlExportDialog = new VhdlExportDialog(machine->getName(), machineStatus->getVhdlExportPath(), exporter, this);
-	connect(this->vhdlExportDialog, &VhdlExportDialog::finished, this, &StatesUi::vhdlExportDialogClosedEventHandler);
-
-	this->vhdlExportDialog->open();
+	this->codeExportDialog->open();
 }
 
 void StatesUi::undo()
@@ -511,37 +511,79 @@ void StatesUi::imageExportDialogClosedEventHandler(int result)
 
 		QString comment = tr("Created with") + " StateS v." + StateS::getVersion();
 
-		exporter->doExport(filePath, this->imageExportDialog->getImageFormat(), comment);
-
-		shared_ptr<MachineStatus> machineStatus = machineManager->getMachineStatus();
-		machineStatus->setImageExportPath(filePath);
+		if (exporter->doExport(filePath, this->imageExportDialog->getImageFormat(), comment) == true)
+		{
+			shared_ptr<MachineStatus> machineStatus = machineManager->getMachineStatus();
+			machineStatus->setImageExportPath(filePath);
+		}
+		else
+		{
+			QMessageBox::warning(this, tr("Error"), tr("Unable to write file") + " " + filePath);
+		}
 	}
 
 	delete this->imageExportDialog;
 	this->imageExportDialog = nullptr;
 }
 
-void StatesUi::vhdlExportDialogClosedEventHandler(int result)
+void StatesUi::codeExportDialogClosedEventHandler(int result)
 {
-	if (this->vhdlExportDialog == nullptr) return;
-
-	auto exporter = this->vhdlExportDialog->getFsmVhdlExport();
-	if (exporter == nullptr) return;
+	if (this->codeExportDialog == nullptr) return;
 
 
 	if (result == QDialog::Accepted)
 	{
-		QString filePath = this->vhdlExportDialog->getFilePath();
+		QString filePath = this->codeExportDialog->getFilePath();
+
+		bool resetLogicPositive = this->codeExportDialog->isResetPositive();
+		bool prefixSignals = this->codeExportDialog->prefixIOs();
+		HdlStateEncoding_t stateEncoding = this->codeExportDialog->getStateEncoding();
+		bool registerMealyOutputs = this->codeExportDialog->registerMealyOutputs();
 
-		exporter->setOptions(this->vhdlExportDialog->isResetPositive(), this->vhdlExportDialog->prefixIOs());
-		exporter->writeToFile(filePath);
+		switch (this->codeExportDialog->getLanguage())
+		{
+		case CodeLanguage_t::vhdl:
+		{
+			FsmVhdlExport exporter;
+			exporter.setOptions(resetLogicPositive, prefixSignals, stateEncoding, registerMealyOutputs);
+			if (exporter.writeToFile(filePath) == false)
+			{
+				QMessageBox::warning(this, tr("Error"), tr("Unable to write file") + " " + filePath);
+			}
+			break;
+		}
+		case CodeLanguage_t::systemVerilog:
+		{
+			FsmSystemVerilogExport exporter;
+			exporter.setOptions(resetLogicPositive, prefixSignals, stateEncoding, registerMealyOutputs);
+			if (exporter.writeToFile(filePath) == false)
+			{
+				QMessageBox::warning(this, tr("Error"), tr("Unable to write file") + " " + filePath);
+			}
+			break;
+		}
+		case CodeLanguage_t::cpp:
+		{
+			FsmCppExport exporter;
+			exporter.setOptions(prefixSignals, registerMealyOutputs);
+			if (exporter.isSupported() == false)
+			{
+				QMessageBox::warning(this, tr("Error"), tr("C++ export only supports variables and conditions up to 64 bits, at most 255 variables and at most 65535 states, transitions and actions."));
+			}
+			else if (exporter.writeToFile(filePath) == false)
+			{
+				QMessageBox::warning(this, tr("Error"), tr("Unable to write file") + " " + filePath);
+			}
+			break;
+		}
+		}
 
 		shared_ptr<MachineStatus> machineStatus = machineManager->getMachineStatus();
 		machineStatus->setVhdlExportPath(filePath);
 	}
 
-	delete this->vhdlExportDialog;
-	this->vhdlExportDialog = nullptr;
+	delete this->codeExportDialog;
+	this->codeExportDialog = nullptr;
 }
 
 void StatesUi::resetUi()
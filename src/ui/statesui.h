@@ -38,7 +38,7 @@ class MachineEditorWidget;
 class TimelineWidget;
 class ViewConfiguration;
 class ImageExportDialog;
-class VhdlExportDialog;
+class CodeExportDialog;
 
 
 /**
@@ -92,7 +92,7 @@ private slots:
 	void beginNewMachineProcedure();
 	void beginClearMachineProcedure();
 	void beginExportImageProcedure();
-	void beginExportVhdlProcedure();
+	void beginExportCodeProcedure();
 
 	void undo();
 	void redo();
@@ -111,7 +111,7 @@ private slots:
 	void redoActionAvailabilityChangeEventHandler(bool redoAvailable);
 
 	void imageExportDialogClosedEventHandler(int result);
-	void vhdlExportDialogClosedEventHandler(int result);
+	void codeExportDialogClosedEventHandler(int result);
 
 private:
 	void resetUi();
@@ -132,7 +132,7 @@ private:
 
 	// Dialogs
 	ImageExportDialog* imageExportDialog = nullptr;
-	VhdlExportDialog*  vhdlExportDialog  = nullptr;
+	CodeExportDialog*  codeExportDialog  = nullptr;
 
 };
 